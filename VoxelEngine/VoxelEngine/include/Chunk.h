@@ -0,0 +1,230 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Resource.h"
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include "Maths/IVec3.hpp"
+#include "Maths/ChunkPos.hpp"
+
+namespace Core::Datastructure
+{
+	using BlockId = uint16_t;
+
+	/**
+	 * How the palette indices of a chunk are stored
+	 */
+	enum class EChunkStorage : char
+	{
+		// One index per voxel, bit-packed
+		PALETTE = 0,
+		// Runs of a same index along each vertical column
+		RLE = 1
+	};
+
+	/**
+	 * Voxels of a 32^3 chunk, stored as a palette of the blocks in the chunk and
+	 * one palette index per voxel, packed on as few bits as the palette needs.
+	 * A chunk of a single block stores no index at all, the width then grows
+	 * from 1 to 16 bits as blocks are added. Indices may straddle two words,
+	 * they are read with one unaligned little endian load.
+	 * Terrain columns are mostly long runs, so the indices can also be stored
+	 * run-length encoded along y, whichever of the two is smaller being picked
+	 * when the chunk is filled or compacted
+	 */
+	class Chunk : public Resources::Resource
+	{
+	public:
+		using Coords = Maths::ChunkPos;
+
+		static constexpr unsigned	VOLUME{ Coords::Volume };
+		static constexpr unsigned	MAX_BITS{ 16 };
+		static constexpr unsigned	COLUMNS{ Coords::Size * Coords::Size };
+
+		// A run is its palette entry above the last y it covers
+		static constexpr unsigned	RUN_ENTRY_SHIFT{ Coords::Shift };
+		static constexpr unsigned	MAX_RLE_PALETTE{ 1u << (16 - RUN_ENTRY_SHIFT) };
+
+	protected:
+		std::vector<BlockId>	m_palette;
+		// Number of voxels using each palette entry, an entry at 0 can be reused
+		std::vector<uint16_t>	m_counts;
+		// VOLUME * m_bits bits, plus one word so the last index can be loaded whole
+		std::vector<uint64_t>	m_words;
+		unsigned				m_bits{ 0 };
+		unsigned				m_unusedEntries{ 0 };
+
+		// Runs of every column, column x + z * Size being m_runs[m_columnStarts[column]..m_columnStarts[column + 1]]
+		std::vector<uint16_t>	m_runs;
+		std::vector<uint16_t>	m_columnStarts;
+		EChunkStorage			m_storage{ EChunkStorage::PALETTE };
+
+		inline unsigned	ReadIndex(unsigned index) const noexcept;
+		inline void		WriteIndex(unsigned index, unsigned entry) noexcept;
+		inline unsigned	ReadRun(unsigned index) const noexcept;
+
+		/**
+		 * Decodes the palette entry of every voxel, whatever the storage
+		 */
+		void			ReadEntries(uint16_t* entries) const noexcept;
+
+		/**
+		 * Stores the palette entries of every voxel in the smaller storage, m_bits being set
+		 */
+		void			StoreEntries(const uint16_t* entries) noexcept;
+
+		/**
+		 * Finds the palette entry of a block, adding it and widening the indices if needed
+		 */
+		unsigned		FindOrAdd(BlockId block) noexcept;
+
+		/**
+		 * Repacks every index on a new number of bits, in the palette storage
+		 */
+		void			Repack(unsigned bits) noexcept;
+	public:
+		/**
+		 * Creates a chunk filled with one block
+		 */
+		explicit Chunk(BlockId block = 0) noexcept;
+		~Chunk() noexcept override = default;
+
+		inline BlockId	Get(unsigned index) const noexcept;
+		inline BlockId	Get(const Maths::IVec3& local) const noexcept { return Get(Coords::LocalIndex(local)); }
+
+		/**
+		 * Changes a voxel, a run-length encoded chunk going back to the palette storage
+		 */
+		void			Set(unsigned index, BlockId block) noexcept;
+		void			Set(const Maths::IVec3& local, BlockId block) noexcept { Set(Coords::LocalIndex(local), block); }
+
+		/**
+		 * Fills the whole chunk with one block, freeing the indices
+		 */
+		void			Fill(BlockId block) noexcept;
+
+		/**
+		 * Replaces the whole chunk, the palette is rebuilt from scratch
+		 * @param voxels: VOLUME blocks, in the order of ChunkPos::LocalIndex
+		 */
+		void			Fill(std::span<const BlockId> voxels) noexcept;
+
+		/**
+		 * Decodes the whole chunk
+		 * @param voxels: VOLUME blocks, in the order of ChunkPos::LocalIndex
+		 */
+		void			Read(std::span<BlockId> voxels) const noexcept;
+
+		/**
+		 * Removes the palette entries no voxel uses anymore, narrows the indices if possible,
+		 * and picks the smaller storage again. Set() never shrinks the palette, so removing
+		 * and adding a block back doesn't repack
+		 */
+		void			Compact() noexcept;
+
+		/**
+		 * Calls f(x, z, yBegin, yEnd, block) for every vertical run of a same block,
+		 * yEnd excluded, column by column. Cheapest on a run-length encoded chunk
+		 */
+		template <class F>
+		void			ForEachRun(F&& f) const noexcept;
+
+		EChunkStorage	GetStorage() const noexcept { return m_storage; }
+		size_t			GetRunCount() const noexcept { return m_runs.size(); }
+		bool			IsUniform() const noexcept { return m_bits == 0; }
+		unsigned		GetBitsPerVoxel() const noexcept { return m_bits; }
+		size_t			GetPaletteSize() const noexcept { return m_palette.size() - m_unusedEntries; }
+		const std::vector<BlockId>&	GetPalette() const noexcept { return m_palette; }
+
+		/**
+		 * Heap and object bytes used by the chunk
+		 */
+		size_t			GetMemoryUsage() const noexcept;
+	};
+
+	inline unsigned Chunk::ReadIndex(unsigned index) const noexcept
+	{
+		const size_t	bit{ static_cast<size_t>(index) * m_bits };
+		uint64_t		word;
+		std::memcpy(&word, reinterpret_cast<const char*>(m_words.data()) + (bit >> 3), sizeof(word));
+		return static_cast<unsigned>(word >> (bit & 7)) & ((1u << m_bits) - 1);
+	}
+
+	inline void Chunk::WriteIndex(unsigned index, unsigned entry) noexcept
+	{
+		const size_t	bit{ static_cast<size_t>(index) * m_bits };
+		char*			bytes{ reinterpret_cast<char*>(m_words.data()) + (bit >> 3) };
+		uint64_t		word;
+		std::memcpy(&word, bytes, sizeof(word));
+		word &= ~(static_cast<uint64_t>((1u << m_bits) - 1) << (bit & 7));
+		word |= static_cast<uint64_t>(entry) << (bit & 7);
+		std::memcpy(bytes, &word, sizeof(word));
+	}
+
+	inline unsigned Chunk::ReadRun(unsigned index) const noexcept
+	{
+		const unsigned	column{ (index & Coords::Mask) | (index >> (Coords::Shift * 2)) << Coords::Shift };
+		const unsigned	y{ index >> Coords::Shift & Coords::Mask };
+
+		// Binary search of the first run ending at or above y
+		const uint16_t*	first{ m_runs.data() + m_columnStarts[column] };
+		unsigned		count{ static_cast<unsigned>(m_columnStarts[column + 1] - m_columnStarts[column]) };
+		while (count > 1)
+		{
+			const unsigned	half{ count / 2 };
+			if ((first[half - 1] & Coords::Mask) < y)
+				first += half;
+			count -= half;
+		}
+		return *first >> RUN_ENTRY_SHIFT;
+	}
+
+	inline BlockId Chunk::Get(unsigned index) const noexcept
+	{
+		if (m_storage == EChunkStorage::RLE)
+			return m_palette[ReadRun(index)];
+		return m_bits == 0 ? m_palette[0] : m_palette[ReadIndex(index)];
+	}
+
+	template <class F>
+	inline void Chunk::ForEachRun(F&& f) const noexcept
+	{
+		for (unsigned column{ 0 }; column < COLUMNS; ++column)
+		{
+			const int	x{ static_cast<int>(column & Coords::Mask) };
+			const int	z{ static_cast<int>(column >> Coords::Shift) };
+
+			if (m_storage == EChunkStorage::RLE)
+			{
+				int	begin{ 0 };
+				for (unsigned run{ m_columnStarts[column] }; run < m_columnStarts[column + 1]; ++run)
+				{
+					const int	end{ (m_runs[run] & Coords::Mask) + 1 };
+					f(x, z, begin, end, m_palette[m_runs[run] >> RUN_ENTRY_SHIFT]);
+					begin = end;
+				}
+				continue;
+			}
+
+			// Runs are found while decoding the column
+			const unsigned	base{ Coords::LocalIndex(Maths::IVec3(x, 0, z)) };
+			int				begin{ 0 };
+			BlockId			block{ Get(base) };
+			for (int y{ 1 }; y < Coords::Size; ++y)
+			{
+				const BlockId	next{ Get(base + (static_cast<unsigned>(y) << Coords::Shift)) };
+				if (next != block)
+				{
+					f(x, z, begin, y, block);
+					begin = y;
+					block = next;
+				}
+			}
+			f(x, z, begin, Coords::Size, block);
+		}
+	}
+}
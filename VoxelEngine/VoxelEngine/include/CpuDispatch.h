@@ -0,0 +1,177 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Core::Platform
+{
+	/**
+	 * Instruction sets a SIMD kernel can be written for, from the oldest to the newest
+	 */
+	enum class ESimdLevel : char
+	{
+		SCALAR = 0,
+		SSE2 = 1,
+		SSE4_1 = 2,
+		AVX2 = 3,
+		AVX512 = 4
+	};
+
+	const char*	ToString(ESimdLevel level) noexcept;
+
+	/**
+	 * Features of the CPU, read with cpuid. The AVX ones are only
+	 * set if the OS also saves the wide registers (xgetbv)
+	 */
+	struct CpuFeatures
+	{
+		bool	sse2{ false };
+		bool	sse4_1{ false };
+		bool	avx{ false };
+		bool	avx2{ false };
+		bool	fma{ false };
+		bool	bmi2{ false };
+		bool	f16c{ false };
+		bool	avx512f{ false };
+		bool	avx512bw{ false };
+		bool	avx512vl{ false };
+	};
+
+	/**
+	 * Selects once, at startup, the instruction set used by every dispatched kernel.
+	 * The highest level supported by the CPU is chosen, unless the environment
+	 * variable VOXEL_SIMD ("scalar", "sse2", "sse4.1", "avx2" or "avx512") asks
+	 * for a lower one, to benchmark each path on the same machine
+	 */
+	class CpuDispatch
+	{
+	protected:
+		CpuFeatures		m_features;
+		ESimdLevel		m_supported{ ESimdLevel::SCALAR };
+		ESimdLevel		m_level{ ESimdLevel::SCALAR };
+
+		CpuDispatch() noexcept;
+
+		static const CpuDispatch&	Get() noexcept;
+	public:
+		/**
+		 * Detects the CPU and reports the chosen path through Tracy.
+		 * Called by the engine at startup, the first query does it otherwise
+		 */
+		static void					Init() noexcept;
+
+		static const CpuFeatures&	GetFeatures() noexcept { return Get().m_features; }
+
+		/**
+		 * Highest level supported by the CPU and the OS
+		 */
+		static ESimdLevel			GetSupportedLevel() noexcept { return Get().m_supported; }
+
+		/**
+		 * Level used by the dispatched kernels, lowered by VOXEL_SIMD if set
+		 */
+		static ESimdLevel			GetLevel() noexcept { return Get().m_level; }
+	};
+
+	/**
+	 * Kernel with one implementation per instruction set, resolved on first use to
+	 * the best implementation not above CpuDispatch::GetLevel(). Each implementation
+	 * is usually compiled in its own translation unit with the matching arch flags:
+	 *
+	 *		static DispatchedKernel<void(const float*, float*, size_t)> s_fill{ "NoiseFill",
+	 *			{ { ESimdLevel::SCALAR, &FillScalar }, { ESimdLevel::AVX2, &FillAvx2 } } };
+	 *		s_fill(in, out, count);
+	 *
+	 * @tparam Signature: Function type of the kernel
+	 */
+	template <typename Signature>
+	class DispatchedKernel;
+
+	template <typename Ret, typename... Args>
+	class DispatchedKernel<Ret(Args...)>
+	{
+	public:
+		using Function = Ret(*)(Args...);
+
+	protected:
+		std::string								m_name;
+		std::vector<std::pair<ESimdLevel, Function>>	m_implementations;
+		Function								m_selected{ nullptr };
+		std::once_flag							m_resolved;
+
+		/**
+		 * Finds the best implementation not above the given level
+		 * @param maxLevel: Highest level the implementation may require
+		 * @param selectedLevel: Receives the level of the implementation
+		 * @return The implementation, or nullptr if none is low enough
+		 */
+		Function	Select(ESimdLevel maxLevel, ESimdLevel& selectedLevel) const noexcept
+		{
+			Function	selected{ nullptr };
+			selectedLevel = ESimdLevel::SCALAR;
+			for (const auto& [level, function] : m_implementations)
+			{
+				if (level <= maxLevel && (selected == nullptr || level >= selectedLevel))
+				{
+					selected = function;
+					selectedLevel = level;
+				}
+			}
+			return selected;
+		}
+
+		/**
+		 * Picks the implementation and reports it through Tracy
+		 */
+		void	Resolve() noexcept
+		{
+			ESimdLevel	selectedLevel;
+			m_selected = Select(CpuDispatch::GetLevel(), selectedLevel);
+
+			const std::string	message{ "Dispatch " + m_name + ": " + ToString(selectedLevel) };
+			TracyMessage(message.c_str(), message.size());
+		}
+
+	public:
+		/**
+		 * Registers the implementations of a kernel. One of them should be SCALAR,
+		 * so that every CPU has an implementation
+		 * @param name: Name of the kernel, used in the Tracy report
+		 * @param implementations: Implementations with the level they require
+		 */
+		DispatchedKernel(std::string name, std::initializer_list<std::pair<ESimdLevel, Function>> implementations) noexcept
+			: m_name{ std::move(name) }, m_implementations{ implementations }
+		{
+		}
+
+		/**
+		 * Returns the implementation selected for this CPU
+		 */
+		Function	GetFunction() noexcept
+		{
+			std::call_once(m_resolved, &DispatchedKernel::Resolve, this);
+			return m_selected;
+		}
+
+		/**
+		 * Returns the implementation a CPU limited to the given level would use,
+		 * to compare the paths or benchmark them against each other
+		 * @param level: Highest level allowed, must be supported by this CPU to call the result
+		 */
+		Function	GetFunction(ESimdLevel level) const noexcept
+		{
+			ESimdLevel	selectedLevel;
+			return Select(level, selectedLevel);
+		}
+
+		Ret			operator()(Args... args) noexcept
+		{
+			return GetFunction()(std::forward<Args>(args)...);
+		}
+	};
+}
@@ -25,6 +25,7 @@ namespace Core::Datastructure
 
 		Core::Renderer::Window&				GetWindow() noexcept { return m_window; }
 		Core::Datastructure::InputManager&	GetInputSystem() noexcept { return m_input; }
+		Core::Resources::ResourceManager&	GetResourceManager() noexcept { return m_manager; }
 	};
 }
 
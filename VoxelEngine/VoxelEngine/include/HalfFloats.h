@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <cstdint>
+#include <span>
+
+#include "Maths/Packing.hpp"
+
+namespace Core::Renderer
+{
+	/**
+	 * Converts floats to half floats, 8 at a time with F16C on AVX2 CPUs.
+	 * The values are the same as Maths::Packing::FloatToHalf on every path
+	 * @param floats: Floats to convert
+	 * @param result: Receives the half floats, at least as large as floats
+	 */
+	void	FloatsToHalves(std::span<const float> floats, std::span<uint16_t> result) noexcept;
+
+	/**
+	 * Converts half floats to floats, 8 at a time with F16C on AVX2 CPUs.
+	 * The values are the same as Maths::Packing::HalfToFloat on every path
+	 * @param halves: Half floats to convert
+	 * @param result: Receives the floats, at least as large as halves
+	 */
+	void	HalvesToFloats(std::span<const uint16_t> halves, std::span<float> result) noexcept;
+}
@@ -0,0 +1,109 @@
+#ifndef __AABB__
+#define __AABB__
+
+#include "Maths/MathMinimal.h"
+
+#include <type_traits>
+
+#include "Maths/Vec3.hpp"
+
+namespace Maths
+{
+	/**
+	 * Axis aligned bounding box, stored as its minimum and maximum corners
+	 */
+	struct Aabb
+	{
+		Vec3	min;
+		Vec3	max;
+
+		/**
+		 * Creates an empty box at the origin
+		 */
+		inline constexpr		Aabb() noexcept = default;
+
+		/**
+		 * Creates a box from its corners
+		 * @param boxMin: Minimum corner of the box
+		 * @param boxMax: Maximum corner of the box, not below boxMin on any axis
+		 */
+		inline constexpr		Aabb(const Vec3& boxMin, const Vec3& boxMax) noexcept : min{ boxMin }, max{ boxMax } {}
+
+		/**
+		 * Creates a box from its center and half of its size
+		 * @param center: Center of the box
+		 * @param halfExtents: Half of the size of the box on each axis
+		 * @return Box created
+		 */
+		static inline constexpr Aabb	FromCenter(const Vec3& center, const Vec3& halfExtents) noexcept
+		{
+			return Aabb(center - halfExtents, center + halfExtents);
+		}
+
+		inline constexpr Vec3	Center() const noexcept
+		{
+			return (min + max) * 0.5f;
+		}
+
+		inline constexpr Vec3	HalfExtents() const noexcept
+		{
+			return (max - min) * 0.5f;
+		}
+
+		/**
+		 * Checks if a point is inside the box or on its surface
+		 * @param point: Point to check
+		 * @return Whether the point is inside the box
+		 */
+		inline constexpr bool	Contains(const Vec3& point) const noexcept
+		{
+			return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y
+				&& point.z >= min.z && point.z <= max.z;
+		}
+
+		/**
+		 * Computes the point of the box closest to a point
+		 * @param point: Point to project on the box
+		 * @return The point itself if it is inside, the closest point of the surface otherwise
+		 */
+		inline constexpr Vec3	ClosestPoint(const Vec3& point) const noexcept
+		{
+			return Vec3(point.x < min.x ? min.x : (point.x > max.x ? max.x : point.x),
+						point.y < min.y ? min.y : (point.y > max.y ? max.y : point.y),
+						point.z < min.z ? min.z : (point.z > max.z ? max.z : point.z));
+		}
+
+		/**
+		 * Computes the squared distance from a point to the box, zero inside
+		 * @param point: Point to compute the distance of
+		 * @return Squared distance to the box
+		 */
+		inline constexpr float	SquaredDistance(const Vec3& point) const noexcept
+		{
+			return (ClosestPoint(point) - point).SquaredLength();
+		}
+
+		/**
+		 * Computes the smallest box containing the current box and a point
+		 * @param point: Point to include
+		 * @return Grown box
+		 */
+		inline constexpr Aabb	Merged(const Vec3& point) const noexcept
+		{
+			return Aabb(Vec3(point.x < min.x ? point.x : min.x, point.y < min.y ? point.y : min.y, point.z < min.z ? point.z : min.z),
+						Vec3(point.x > max.x ? point.x : max.x, point.y > max.y ? point.y : max.y, point.z > max.z ? point.z : max.z));
+		}
+
+		/**
+		 * Computes the smallest box containing the current box and another
+		 * @param box: Box to include
+		 * @return Grown box
+		 */
+		inline constexpr Aabb	Merged(const Aabb& box) const noexcept
+		{
+			return Merged(box.min).Merged(box.max);
+		}
+	};
+}
+
+#endif
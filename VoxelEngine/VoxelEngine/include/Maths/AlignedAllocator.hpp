@@ -0,0 +1,67 @@
+#ifndef __ALIGNED_ALLOCATOR__
+#define __ALIGNED_ALLOCATOR__
+
+#include "Maths/MathMinimal.h"
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace Maths
+{
+	/**
+	 * Allocator giving memory aligned for the SIMD registers,
+	 * so that the SoA containers can be loaded a full register at a time
+	 * @tparam T: Type of the allocated values
+	 * @tparam Alignment: Alignment in bytes of the allocations
+	 */
+	template <typename T, size_t Alignment = 32>
+	struct AlignedAllocator
+	{
+		using value_type = T;
+
+		template <typename U>
+		struct rebind
+		{
+			using other = AlignedAllocator<U, Alignment>;
+		};
+
+		inline constexpr	AlignedAllocator() noexcept = default;
+
+		template <typename U>
+		inline constexpr	AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+		/**
+		 * Allocates aligned memory for n values
+		 * @param n: Number of values to allocate
+		 * @return Pointer to the allocated memory
+		 */
+		[[nodiscard]] inline T*	allocate(const size_t n)
+		{
+			return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ Alignment }));
+		}
+
+		/**
+		 * Frees memory given by allocate()
+		 * @param p: Pointer to the memory to free
+		 */
+		inline void				deallocate(T* p, const size_t) noexcept
+		{
+			::operator delete(p, std::align_val_t{ Alignment });
+		}
+
+		template <typename U>
+		inline constexpr bool	operator== (const AlignedAllocator<U, Alignment>&) const noexcept
+		{
+			return true;
+		}
+	};
+
+	/**
+	 * Vector whose storage is aligned for the SIMD registers
+	 */
+	template <typename T>
+	using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef __CAPSULE__
+#define __CAPSULE__
+
+#include "Maths/MathMinimal.h"
+
+#include <type_traits>
+
+#include "Maths/Vec3.hpp"
+
+namespace Maths
+{
+	/**
+	 * Capsule stored as the segment at its core and its radius,
+	 * every point closer to the segment than the radius is inside
+	 */
+	struct Capsule
+	{
+		Vec3	a;
+		Vec3	b;
+		float	radius{ 0.f };
+
+		/**
+		 * Creates a capsule of radius zero at the origin
+		 */
+		inline constexpr		Capsule() noexcept = default;
+
+		/**
+		 * Creates a capsule
+		 * @param segmentA: First end of the segment
+		 * @param segmentB: Second end of the segment
+		 * @param capsuleRadius: Radius of the capsule, not negative
+		 */
+		inline constexpr		Capsule(const Vec3& segmentA, const Vec3& segmentB, const float capsuleRadius) noexcept
+			: a{ segmentA }, b{ segmentB }, radius{ capsuleRadius }
+		{
+		}
+
+		/**
+		 * Computes the point of the segment closest to a point
+		 * @param point: Point to project on the segment
+		 * @return Closest point of the segment
+		 */
+		inline constexpr Vec3	ClosestSegmentPoint(const Vec3& point) const noexcept
+		{
+			const Vec3	ab{ b - a };
+			const float	sqrLength{ ab.SquaredLength() };
+			if (sqrLength <= 0.f)
+				return a;
+
+			const float	t{ (point - a).Dot(ab) / sqrLength };
+			return a + ab * (t < 0.f ? 0.f : (t > 1.f ? 1.f : t));
+		}
+
+		/**
+		 * Checks if a point is inside the capsule or on its surface
+		 * @param point: Point to check
+		 * @return Whether the point is inside the capsule
+		 */
+		inline constexpr bool	Contains(const Vec3& point) const noexcept
+		{
+			return (point - ClosestSegmentPoint(point)).SquaredLength() <= radius * radius;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef __CHUNK_POS__
+#define __CHUNK_POS__
+
+#include "Maths/MathMinimal.h"
+
+#include <type_traits>
+#include <functional>
+
+#include "Maths/Vec3.hpp"
+#include "Maths/IVec3.hpp"
+
+namespace Maths
+{
+	/**
+	 * Position of a chunk in the grid of chunks, for cubic chunks of
+	 * 2^SizeLog2 voxels per side. Every conversion between voxel, local
+	 * and chunk coordinates is a shift or a mask, and stays correct
+	 * for negative coordinates
+	 * @tparam SizeLog2: Log2 of the number of voxels per side of a chunk
+	 */
+	template <unsigned SizeLog2>
+	requires (SizeLog2 > 0 && SizeLog2 <= 10)
+	struct ChunkCoords
+	{
+		static constexpr unsigned	Shift{ SizeLog2 };
+		static constexpr int		Size{ 1 << SizeLog2 };
+		static constexpr int		Mask{ Size - 1 };
+		static constexpr unsigned	Volume{ 1u << (SizeLog2 * 3) };
+
+		IVec3	pos;
+
+		/**
+		 * Default constructor, creates the chunk at the origin
+		 */
+		inline constexpr			ChunkCoords() noexcept = default;
+
+		/**
+		 * Creates a chunk position from its coordinates in the grid of chunks
+		 * @param p: Coordinates of the chunk
+		 */
+		inline constexpr explicit	ChunkCoords(const IVec3& p) noexcept : pos{ p } {}
+
+		/**
+		 * Creates a chunk position from its coordinates in the grid of chunks
+		 * @param x: x coordinate of the chunk
+		 * @param y: y coordinate of the chunk
+		 * @param z: z coordinate of the chunk
+		 */
+		inline constexpr			ChunkCoords(const int x, const int y, const int z) noexcept : pos{ x, y, z } {}
+
+		/**
+		 * Computes the chunk containing the given voxel
+		 * @param voxel: World coordinates of the voxel
+		 * @return Chunk containing the voxel
+		 */
+		static inline constexpr ChunkCoords	FromVoxel(const IVec3& voxel) noexcept
+		{
+			return ChunkCoords(voxel >> Shift);
+		}
+
+		/**
+		 * Computes the chunk containing the given world position
+		 * @param p: World position
+		 * @return Chunk containing the position
+		 */
+		static inline constexpr ChunkCoords	FromWorld(const Vec3& p) noexcept
+		{
+			return FromVoxel(IVec3::Floor(p));
+		}
+
+		/**
+		 * Computes the coordinates of a voxel inside its chunk
+		 * @param voxel: World coordinates of the voxel
+		 * @return Coordinates of the voxel in its chunk, between 0 and Size - 1
+		 */
+		static inline constexpr IVec3		LocalPos(const IVec3& voxel) noexcept
+		{
+			return voxel & Mask;
+		}
+
+		/**
+		 * Packs local coordinates in an index of the chunk storage,
+		 * x varying the fastest and z the slowest
+		 * @param local: Coordinates of the voxel in its chunk
+		 * @return Index of the voxel, lower than Volume
+		 */
+		static inline constexpr unsigned	LocalIndex(const IVec3& local) noexcept
+		{
+			return static_cast<unsigned>(local.x | local.y << Shift | local.z << (Shift * 2));
+		}
+
+		/**
+		 * Unpacks an index of the chunk storage
+		 * @param index: Index of the voxel, lower than Volume
+		 * @return Coordinates of the voxel in its chunk
+		 */
+		static inline constexpr IVec3		FromLocalIndex(const unsigned index) noexcept
+		{
+			return IVec3(static_cast<int>(index) & Mask, static_cast<int>(index >> Shift) & Mask,
+						 static_cast<int>(index >> (Shift * 2)));
+		}
+
+		/**
+		 * Computes the world coordinates of the first voxel of the chunk
+		 * @return Voxel of the chunk with the smallest coordinates
+		 */
+		inline constexpr IVec3				Origin() const noexcept
+		{
+			return pos << Shift;
+		}
+
+		/**
+		 * Computes the world coordinates of a voxel of the chunk
+		 * @param local: Coordinates of the voxel in the chunk
+		 * @return World coordinates of the voxel
+		 */
+		inline constexpr IVec3				ToVoxel(const IVec3& local) const noexcept
+		{
+			return Origin() + local;
+		}
+
+		inline constexpr bool				operator== (const ChunkCoords& c) const noexcept = default;
+
+		/**
+		 * Computes a well distributed hash of the chunk position
+		 * @return Hash of the chunk position
+		 */
+		inline constexpr size_t				Hash() const noexcept
+		{
+			return pos.Hash();
+		}
+	};
+
+	/**
+	 * Chunk position for the chunks of the engine, of 32 voxels per side
+	 */
+	using ChunkPos = ChunkCoords<5>;
+}
+
+template <unsigned SizeLog2>
+struct std::hash<Maths::ChunkCoords<SizeLog2>>
+{
+	inline size_t	operator() (const Maths::ChunkCoords<SizeLog2>& c) const noexcept
+	{
+		return c.Hash();
+	}
+};
+
+#endif
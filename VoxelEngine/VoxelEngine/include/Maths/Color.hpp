@@ -61,9 +61,7 @@ namespace Maths
 		 * Creates a copy of given color
 		 * @param c: Color to be copied
 		 */
-		inline constexpr	Color(const Color& c) noexcept : r{ c.r }, g{ c.g }, b{ c.b }, a{ c.a }
-		{
-		}
+		inline constexpr	Color(const Color& c) noexcept = default;
 
 		/**
 		 * Cast operator to Vec4
@@ -76,17 +74,9 @@ namespace Maths
 		/**
 		 * Copies the given color in current color
 		 * @param c: Color to copy
-		 * @return A copy of the given color
+		 * @return Reference to the current color
 		 */
-		inline constexpr Color	operator=(const Color& v) noexcept
-		{
-			r = v.r;
-			g = v.g;
-			b = v.b;
-			a = v.a;
-
-			return *this;
-		}
+		inline constexpr Color&	operator=(const Color& v) noexcept = default;
 
 		/**
 		 * Compares the given color to the current color
@@ -144,6 +134,8 @@ namespace Maths
 			return std::to_string(r) + " " + std::to_string(g) + " " + std::to_string(b) + " " + std::to_string(a);
 		}
 	};
+
+	static_assert(BitwiseCopyable<Color>);
 }
 
 #endif
@@ -0,0 +1,330 @@
+#ifndef __EXPRESSION__
+#define __EXPRESSION__
+
+#include "Maths/MathMinimal.h"
+
+#include "Maths/Mat.hpp"
+#include "Maths/Vec.hpp"
+#include "Maths/Vec2.hpp"
+#include "Maths/Vec3.hpp"
+#include "Maths/Vec4.hpp"
+
+#include <concepts>
+#include <utility>
+
+/**
+ * Opt-in expression templates for the component-wise arithmetic of the vectors
+ * and matrices. Wrapping an operand in Lazy() makes every operator build a
+ * light expression instead of a temporary, and the whole chain is computed in
+ * a single loop once it is converted or assigned to a vector or matrix:
+ *
+ *		Vec3 p = Expr::Lazy(position) + Expr::Lazy(velocity) * dt;
+ *
+ * The result type of an expression is the type of its left-most operand.
+ * Expressions keep references to their operands, they must be evaluated in the
+ * statement that builds them. Only component-wise operations are supported, so
+ * the destination may also be one of the operands.
+ */
+namespace Maths::Expr
+{
+	/**
+	 * Describes how an expression reads and writes the components of a maths type,
+	 * specialized for each type usable as an expression operand or destination
+	 * @tparam T: Maths type
+	 */
+	template <typename T>
+	struct Storage;
+
+	template <int N>
+	struct Storage<Vec<N>>
+	{
+		static constexpr unsigned Size{ N };
+		static constexpr float*			Data(Vec<N>& v) noexcept { return v.m_vec; }
+		static constexpr const float*	Data(const Vec<N>& v) noexcept { return v.m_vec; }
+	};
+
+	template <unsigned Line, unsigned Column>
+	struct Storage<Mat<Line, Column>>
+	{
+		static constexpr unsigned Size{ Line * Column };
+		static constexpr float*			Data(Mat<Line, Column>& m) noexcept { return m.array; }
+		static constexpr const float*	Data(const Mat<Line, Column>& m) noexcept { return m.array; }
+	};
+
+	template <>
+	struct Storage<Vec2>
+	{
+		static constexpr unsigned Size{ 2 };
+		static constexpr float*			Data(Vec2& v) noexcept { return v.xy; }
+		static constexpr const float*	Data(const Vec2& v) noexcept { return v.xy; }
+	};
+
+	template <>
+	struct Storage<Vec3>
+	{
+		static constexpr unsigned Size{ 3 };
+		static constexpr float*			Data(Vec3& v) noexcept { return v.xyz; }
+		static constexpr const float*	Data(const Vec3& v) noexcept { return v.xyz; }
+	};
+
+	template <>
+	struct Storage<Vec4>
+	{
+		static constexpr unsigned Size{ 4 };
+		static constexpr float*			Data(Vec4& v) noexcept { return v.xyzw; }
+		static constexpr const float*	Data(const Vec4& v) noexcept { return v.xyzw; }
+	};
+
+	/**
+	 * Maths type that can be used as an expression operand or destination
+	 */
+	template <typename T>
+	concept Storable = requires { Storage<T>::Size; };
+
+	/**
+	 * Computes every component before writing them, unrolled, so that the destination
+	 * aliasing the operands doesn't force a reload after each store,
+	 * private function you're not supposed to use
+	 */
+	template <typename E, unsigned... I>
+	inline constexpr void	Store_IMPL(float* data, const E& expr, std::integer_sequence<unsigned, I...>) noexcept
+	{
+		const float	values[]{ expr[I]... };
+		((data[I] = values[I]), ...);
+	}
+
+	/**
+	 * Writes an expression to the components of a vector or matrix, only unrolled
+	 * up to the size of a 4x4 matrix, private function you're not supposed to use
+	 */
+	template <typename E>
+	inline constexpr void	Store_IMPL(float* data, const E& expr) noexcept
+	{
+		if constexpr (E::Size <= 16)
+		{
+			Store_IMPL(data, expr, std::make_integer_sequence<unsigned, E::Size>());
+		}
+		else
+		{
+			for (unsigned i{ 0 }; i < E::Size; ++i)
+				data[i] = expr[i];
+		}
+	}
+
+	/**
+	 * Base of every expression node, giving the conversion to its result type
+	 * @tparam Derived: Type of the expression node
+	 * @tparam ResultType: Maths type the expression evaluates to
+	 */
+	template <typename Derived, Storable ResultType>
+	struct Expression
+	{
+		using Result = ResultType;
+		static constexpr unsigned Size{ Storage<ResultType>::Size };
+
+		/**
+		 * Computes the whole expression
+		 * @return The result of the expression
+		 */
+		inline constexpr Result		Evaluate() const noexcept
+		{
+			Result	result;
+			Store_IMPL(Storage<Result>::Data(result), static_cast<const Derived&>(*this));
+			return result;
+		}
+
+		/**
+		 * Computes the whole expression
+		 */
+		inline constexpr			operator Result() const noexcept
+		{
+			return Evaluate();
+		}
+	};
+
+	/**
+	 * Any expression node
+	 */
+	template <typename E>
+	concept IsExpression = requires { typename E::Result; } && std::derived_from<E, Expression<E, typename E::Result>>;
+
+	/**
+	 * Leaf of an expression, referencing a vector or matrix
+	 * @tparam T: Type of the referenced vector or matrix
+	 */
+	template <Storable T>
+	struct Terminal : Expression<Terminal<T>, T>
+	{
+		const float* data;
+
+		inline constexpr explicit	Terminal(const T& value) noexcept : data{ Storage<T>::Data(value) } {}
+
+		inline constexpr float		operator[] (const unsigned i) const noexcept { return data[i]; }
+	};
+
+	/**
+	 * Component-wise operation between two expressions of the same size
+	 * @tparam L: Type of the left expression
+	 * @tparam R: Type of the right expression
+	 * @tparam Op: Operation applied to the components
+	 */
+	template <IsExpression L, IsExpression R, typename Op>
+	requires (L::Size == R::Size)
+	struct Binary : Expression<Binary<L, R, Op>, typename L::Result>
+	{
+		L	left;
+		R	right;
+
+		inline constexpr			Binary(const L& l, const R& r) noexcept : left{ l }, right{ r } {}
+
+		inline constexpr float		operator[] (const unsigned i) const noexcept { return Op::Apply(left[i], right[i]); }
+	};
+
+	/**
+	 * Operation between an expression and a scalar
+	 * @tparam E: Type of the expression
+	 * @tparam Op: Operation applied to the components
+	 * @tparam ScalarLeft: Whether the scalar is the left operand
+	 */
+	template <IsExpression E, typename Op, bool ScalarLeft>
+	struct Scalar : Expression<Scalar<E, Op, ScalarLeft>, typename E::Result>
+	{
+		E		expr;
+		float	scalar;
+
+		inline constexpr			Scalar(const E& e, const float f) noexcept : expr{ e }, scalar{ f } {}
+
+		inline constexpr float		operator[] (const unsigned i) const noexcept
+		{
+			if constexpr (ScalarLeft)
+				return Op::Apply(scalar, expr[i]);
+			else
+				return Op::Apply(expr[i], scalar);
+		}
+	};
+
+	/**
+	 * Negation of an expression
+	 * @tparam E: Type of the expression
+	 */
+	template <IsExpression E>
+	struct Negate : Expression<Negate<E>, typename E::Result>
+	{
+		E	expr;
+
+		inline constexpr explicit	Negate(const E& e) noexcept : expr{ e } {}
+
+		inline constexpr float		operator[] (const unsigned i) const noexcept { return -expr[i]; }
+	};
+
+	struct Add { static constexpr float Apply(const float a, const float b) noexcept { return a + b; } };
+	struct Sub { static constexpr float Apply(const float a, const float b) noexcept { return a - b; } };
+	struct Mul { static constexpr float Apply(const float a, const float b) noexcept { return a * b; } };
+	struct Div { static constexpr float Apply(const float a, const float b) noexcept { return a / b; } };
+
+	/**
+	 * Starts an expression from the given vector or matrix
+	 * @param value: Vector or matrix to reference, must outlive the expression
+	 * @return Leaf expression referencing value
+	 */
+	template <Storable T>
+	inline constexpr Terminal<T>	Lazy(const T& value) noexcept
+	{
+		return Terminal<T>(value);
+	}
+
+	/**
+	 * Computes the given expression in an existing vector or matrix,
+	 * without going through a temporary
+	 * @param dst: Destination of the expression, may be referenced by the expression
+	 * @param expr: Expression to compute
+	 */
+	template <Storable T, IsExpression E>
+	requires (Storage<T>::Size == E::Size)
+	inline constexpr void			Assign(T& dst, const E& expr) noexcept
+	{
+		Store_IMPL(Storage<T>::Data(dst), expr);
+	}
+
+	/**
+	 * Component-wise addition of two expressions
+	 */
+	template <IsExpression L, IsExpression R>
+	inline constexpr Binary<L, R, Add>		operator+ (const L& l, const R& r) noexcept { return { l, r }; }
+
+	/**
+	 * Component-wise substraction of two expressions
+	 */
+	template <IsExpression L, IsExpression R>
+	inline constexpr Binary<L, R, Sub>		operator- (const L& l, const R& r) noexcept { return { l, r }; }
+
+	/**
+	 * Component-wise multiplication of two expressions
+	 */
+	template <IsExpression L, IsExpression R>
+	inline constexpr Binary<L, R, Mul>		operator* (const L& l, const R& r) noexcept { return { l, r }; }
+
+	/**
+	 * Component-wise division of two expressions
+	 */
+	template <IsExpression L, IsExpression R>
+	inline constexpr Binary<L, R, Div>		operator/ (const L& l, const R& r) noexcept { return { l, r }; }
+
+	/**
+	 * Multiplication of an expression by a scalar
+	 */
+	template <IsExpression E>
+	inline constexpr Scalar<E, Mul, false>	operator* (const E& e, const float f) noexcept { return { e, f }; }
+
+	/**
+	 * Multiplication of an expression by a scalar
+	 */
+	template <IsExpression E>
+	inline constexpr Scalar<E, Mul, true>	operator* (const float f, const E& e) noexcept { return { e, f }; }
+
+	/**
+	 * Division of an expression by a scalar
+	 */
+	template <IsExpression E>
+	inline constexpr Scalar<E, Div, false>	operator/ (const E& e, const float f) noexcept { return { e, f }; }
+
+	/**
+	 * Addition of a scalar to every component of an expression
+	 */
+	template <IsExpression E>
+	inline constexpr Scalar<E, Add, false>	operator+ (const E& e, const float f) noexcept { return { e, f }; }
+
+	/**
+	 * Substraction of a scalar to every component of an expression
+	 */
+	template <IsExpression E>
+	inline constexpr Scalar<E, Sub, false>	operator- (const E& e, const float f) noexcept { return { e, f }; }
+
+	/**
+	 * Negation of an expression
+	 */
+	template <IsExpression E>
+	inline constexpr Negate<E>				operator- (const E& e) noexcept { return Negate<E>(e); }
+
+	/**
+	 * Mixing an expression with a plain vector or matrix references it
+	 */
+	template <IsExpression E, Storable T>
+	inline constexpr auto	operator+ (const E& e, const T& t) noexcept { return e + Lazy(t); }
+	template <Storable T, IsExpression E>
+	inline constexpr auto	operator+ (const T& t, const E& e) noexcept { return Lazy(t) + e; }
+	template <IsExpression E, Storable T>
+	inline constexpr auto	operator- (const E& e, const T& t) noexcept { return e - Lazy(t); }
+	template <Storable T, IsExpression E>
+	inline constexpr auto	operator- (const T& t, const E& e) noexcept { return Lazy(t) - e; }
+	template <IsExpression E, Storable T>
+	inline constexpr auto	operator* (const E& e, const T& t) noexcept { return e * Lazy(t); }
+	template <Storable T, IsExpression E>
+	inline constexpr auto	operator* (const T& t, const E& e) noexcept { return Lazy(t) * e; }
+	template <IsExpression E, Storable T>
+	inline constexpr auto	operator/ (const E& e, const T& t) noexcept { return e / Lazy(t); }
+	template <Storable T, IsExpression E>
+	inline constexpr auto	operator/ (const T& t, const E& e) noexcept { return Lazy(t) / e; }
+}
+
+#endif
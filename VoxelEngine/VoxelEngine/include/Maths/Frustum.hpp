@@ -0,0 +1,200 @@
+#ifndef __FRUSTUM__
+#define __FRUSTUM__
+
+#include "Maths/MathMinimal.h"
+
+#include <span>
+
+#include "Maths/Vec3.hpp"
+#include "Maths/Vec4.hpp"
+#include "Maths/Mat4.hpp"
+#include "Maths/Vec3Stream.hpp"
+#include "Maths/Simd.hpp"
+
+namespace Maths
+{
+	/**
+	 * Six planes bounding the volume seen by a camera, used to cull the
+	 * objects out of view. Every plane is stored as (unit normal, distance),
+	 * pointing toward the inside of the frustum
+	 */
+	struct Frustum
+	{
+		/**
+		 * Position of each plane in planes
+		 */
+		enum class ESide : char
+		{
+			LEFT = 0,
+			RIGHT = 1,
+			BOTTOM = 2,
+			TOP = 3,
+			NEAR_PLANE = 4,
+			FAR_PLANE = 5,
+			COUNT = 6
+		};
+
+		static constexpr unsigned	PLANE_COUNT{ static_cast<unsigned>(ESide::COUNT) };
+
+		Vec4	planes[PLANE_COUNT];
+
+		/**
+		 * Creates a frustum with every plane at zero, which contains everything
+		 */
+		inline constexpr	Frustum() noexcept = default;
+
+		/**
+		 * Extracts the planes of a view projection matrix (Gribb-Hartmann). The matrix
+		 * is expected to project to an OpenGL clip space, with z between -w and w
+		 * @param viewProjection: Projection matrix multiplied by the view matrix
+		 */
+		inline explicit		Frustum(const Mat4& viewProjection) noexcept
+		{
+			Vec4	rows[4];
+			for (unsigned line{ 0 }; line < 4; ++line)
+				rows[line] = Vec4(viewProjection.Get(line, 0), viewProjection.Get(line, 1),
+								  viewProjection.Get(line, 2), viewProjection.Get(line, 3));
+
+			for (unsigned axis{ 0 }; axis < 3; ++axis)
+			{
+				planes[axis * 2] = rows[3] + rows[axis];
+				planes[axis * 2 + 1] = rows[3] - rows[axis];
+			}
+
+			for (Vec4& plane : planes)
+			{
+				const float	length{ Vec3(plane.x, plane.y, plane.z).Length() };
+				if (length > 0.f)
+					plane = Vec4(plane.x / length, plane.y / length, plane.z / length, plane.w / length);
+			}
+		}
+
+		/**
+		 * Computes the signed distance of a point to one of the planes,
+		 * positive on the inside of the frustum
+		 * @param side: Plane to compute the distance to
+		 * @param point: Point to compute the distance of
+		 * @return Signed distance of the point to the plane
+		 */
+		inline constexpr float	Distance(const ESide side, const Vec3& point) const noexcept
+		{
+			const Vec4&	plane{ planes[static_cast<unsigned>(side)] };
+			return plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w;
+		}
+
+		/**
+		 * Checks if a point is inside the frustum
+		 * @param point: Point to check
+		 * @return Whether the point is inside the frustum
+		 */
+		inline constexpr bool	ContainsPoint(const Vec3& point) const noexcept
+		{
+			for (unsigned side{ 0 }; side < PLANE_COUNT; ++side)
+				if (Distance(static_cast<ESide>(side), point) < 0.f)
+					return false;
+			return true;
+		}
+
+		/**
+		 * Checks if a sphere is at least partially inside the frustum
+		 * @param center: Center of the sphere
+		 * @param radius: Radius of the sphere
+		 * @return Whether the sphere may be visible
+		 */
+		inline constexpr bool	IntersectsSphere(const Vec3& center, const float radius) const noexcept
+		{
+			for (unsigned side{ 0 }; side < PLANE_COUNT; ++side)
+				if (Distance(static_cast<ESide>(side), center) < -radius)
+					return false;
+			return true;
+		}
+
+		/**
+		 * Checks if an axis aligned box is at least partially inside the frustum.
+		 * Boxes crossing two planes near a corner of the frustum may be kept
+		 * even if they are outside, which is conservative for culling
+		 * @param min: Minimum corner of the box
+		 * @param max: Maximum corner of the box
+		 * @return Whether the box may be visible
+		 */
+		inline constexpr bool	IntersectsAabb(const Vec3& min, const Vec3& max) const noexcept
+		{
+			for (unsigned side{ 0 }; side < PLANE_COUNT; ++side)
+			{
+				const Vec4&	plane{ planes[side] };
+				// Corner of the box furthest along the plane normal
+				const Vec3	corner{ plane.x >= 0.f ? max.x : min.x, plane.y >= 0.f ? max.y : min.y, plane.z >= 0.f ? max.z : min.z };
+				if (Distance(static_cast<ESide>(side), corner) < 0.f)
+					return false;
+			}
+			return true;
+		}
+
+		/**
+		 * Culls axis aligned boxes stored in SoA, 8 boxes at a time on AVX2 CPUs
+		 * and 4 with SSE otherwise (see Simd::CullAabbSoA). Same test as IntersectsAabb
+		 * @param min: x, y and z arrays of the minimum corners of the boxes
+		 * @param max: x, y and z arrays of the maximum corners of the boxes
+		 * @param count: Number of boxes
+		 * @param visible: Receives the indices of the visible boxes in increasing order, at least of count
+		 * @return Number of visible boxes, the size of the list written in visible
+		 */
+		inline size_t	CullAabbs(const float* const min[3], const float* const max[3], const size_t count,
+								  std::span<unsigned> visible) const noexcept
+		{
+			float	p[PLANE_COUNT][4];
+			PlanesArray_IMPL(p);
+			return Simd::CullAabbSoA(p, min, max, count, visible.data());
+		}
+
+		/**
+		 * Culls spheres stored in SoA, 8 spheres at a time on AVX2 CPUs
+		 * and 4 with SSE otherwise (see Simd::CullSphereSoA). Same test as IntersectsSphere
+		 * @param center: x, y and z arrays of the centers of the spheres
+		 * @param radius: Array of the radii of the spheres
+		 * @param count: Number of spheres
+		 * @param visible: Receives the indices of the visible spheres in increasing order, at least of count
+		 * @return Number of visible spheres, the size of the list written in visible
+		 */
+		inline size_t	CullSpheres(const float* const center[3], const float* radius, const size_t count,
+									std::span<unsigned> visible) const noexcept
+		{
+			float	p[PLANE_COUNT][4];
+			PlanesArray_IMPL(p);
+			return Simd::CullSphereSoA(p, center, radius, count, visible.data());
+		}
+
+		/**
+		 * Culls spheres whose centers are stored in a stream
+		 * @param centers: Centers of the spheres
+		 * @param radii: Radii of the spheres, at least of centers.Size()
+		 * @param visible: Receives the indices of the visible spheres in increasing order, at least of centers.Size()
+		 * @return Number of visible spheres, the size of the list written in visible
+		 */
+		inline size_t	CullSpheres(const Vec3Stream& centers, std::span<const float> radii,
+									std::span<unsigned> visible) const noexcept
+		{
+			const float* const	center[3]{ centers.X(), centers.Y(), centers.Z() };
+			return CullSpheres(center, radii.data(), centers.Size(), visible);
+		}
+
+	protected:
+		/**
+		 * Copies the planes to the layout of the culling kernels,
+		 * private member you're not supposed to use
+		 * @param p: Array receiving the planes
+		 */
+		inline void		PlanesArray_IMPL(float (&p)[PLANE_COUNT][4]) const noexcept
+		{
+			for (unsigned side{ 0 }; side < PLANE_COUNT; ++side)
+			{
+				p[side][0] = planes[side].x;
+				p[side][1] = planes[side].y;
+				p[side][2] = planes[side].z;
+				p[side][3] = planes[side].w;
+			}
+		}
+	};
+}
+
+#endif
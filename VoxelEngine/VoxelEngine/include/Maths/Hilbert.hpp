@@ -0,0 +1,163 @@
+#ifndef __HILBERT__
+#define __HILBERT__
+
+#include "Maths/MathMinimal.h"
+
+#include <cstdint>
+
+#include "Maths/IVec2.hpp"
+#include "Maths/IVec3.hpp"
+#include "Maths/Morton.hpp"
+
+/**
+ * Hilbert curve indices. Unlike Morton codes, two consecutive indices are
+ * always neighbours in space, which gives a better locality when ordering
+ * regions or chunks, at the price of a slower encoding
+ */
+namespace Maths::Hilbert
+{
+	/**
+	 * Rotates a quadrant of the 2D curve, private function you're not supposed to use
+	 */
+	inline constexpr void		Rotate2D_IMPL(const uint32_t n, uint32_t& x, uint32_t& y, const uint32_t rx, const uint32_t ry) noexcept
+	{
+		if (ry != 0)
+			return;
+		if (rx != 0)
+		{
+			x = n - 1 - x;
+			y = n - 1 - y;
+		}
+		const uint32_t	t{ x };
+		x = y;
+		y = t;
+	}
+
+	/**
+	 * Computes the index of a position on the 2D Hilbert curve
+	 * @param position: Position, each coordinate between 0 and 2^bits - 1
+	 * @param bits: Number of bits per axis, at most 31
+	 * @return Index of the position on the curve
+	 */
+	inline constexpr uint64_t	Encode2D(const IVec2& position, const unsigned bits) noexcept
+	{
+		const uint32_t	n{ 1u << bits };
+		uint32_t		x{ static_cast<uint32_t>(position.x) & (n - 1) };
+		uint32_t		y{ static_cast<uint32_t>(position.y) & (n - 1) };
+		uint64_t		index{ 0 };
+		for (uint32_t s{ n >> 1 }; s > 0; s >>= 1)
+		{
+			const uint32_t	rx{ (x & s) != 0 ? 1u : 0u };
+			const uint32_t	ry{ (y & s) != 0 ? 1u : 0u };
+			index += static_cast<uint64_t>(s) * s * ((3 * rx) ^ ry);
+			Rotate2D_IMPL(n, x, y, rx, ry);
+		}
+		return index;
+	}
+
+	/**
+	 * Computes the position of an index on the 2D Hilbert curve
+	 * @param index: Index on the curve
+	 * @param bits: Number of bits per axis, at most 31
+	 * @return Position of the index
+	 */
+	inline constexpr IVec2		Decode2D(uint64_t index, const unsigned bits) noexcept
+	{
+		const uint32_t	n{ 1u << bits };
+		uint32_t		x{ 0 };
+		uint32_t		y{ 0 };
+		for (uint32_t s{ 1 }; s < n; s <<= 1)
+		{
+			const uint32_t	rx{ static_cast<uint32_t>(index >> 1) & 1u };
+			const uint32_t	ry{ static_cast<uint32_t>(index ^ rx) & 1u };
+			Rotate2D_IMPL(s, x, y, rx, ry);
+			x += s * rx;
+			y += s * ry;
+			index >>= 2;
+		}
+		return IVec2(static_cast<int>(x), static_cast<int>(y));
+	}
+
+	/**
+	 * Computes the index of a position on the 3D Hilbert curve,
+	 * with Skilling's transpose algorithm
+	 * @param position: Position, each coordinate between 0 and 2^bits - 1
+	 * @param bits: Number of bits per axis, at most 21
+	 * @return Index of the position on the curve
+	 */
+	inline constexpr uint64_t	Encode3D(const IVec3& position, const unsigned bits) noexcept
+	{
+		const uint32_t	mask{ (1u << bits) - 1 };
+		uint32_t		axes[3]{ static_cast<uint32_t>(position.x) & mask, static_cast<uint32_t>(position.y) & mask,
+								 static_cast<uint32_t>(position.z) & mask };
+
+		// Inverse undo
+		for (uint32_t q{ 1u << (bits - 1) }; q > 1; q >>= 1)
+		{
+			const uint32_t	p{ q - 1 };
+			for (uint32_t& axis : axes)
+			{
+				if (axis & q)
+					axes[0] ^= p;
+				else
+				{
+					const uint32_t	t{ (axes[0] ^ axis) & p };
+					axes[0] ^= t;
+					axis ^= t;
+				}
+			}
+		}
+
+		// Gray encode
+		axes[1] ^= axes[0];
+		axes[2] ^= axes[1];
+		uint32_t	t{ 0 };
+		for (uint32_t q{ 1u << (bits - 1) }; q > 1; q >>= 1)
+			if (axes[2] & q)
+				t ^= q - 1;
+		for (uint32_t& axis : axes)
+			axis ^= t;
+
+		// The first axis gives the most significant bit of each triple
+		return Morton::Encode64(axes[2], axes[1], axes[0]);
+	}
+
+	/**
+	 * Computes the position of an index on the 3D Hilbert curve
+	 * @param index: Index on the curve
+	 * @param bits: Number of bits per axis, at most 21
+	 * @return Position of the index
+	 */
+	inline constexpr IVec3		Decode3D(const uint64_t index, const unsigned bits) noexcept
+	{
+		const IVec3	transposed{ Morton::Decode64(index) };
+		uint32_t	axes[3]{ static_cast<uint32_t>(transposed.z), static_cast<uint32_t>(transposed.y),
+							 static_cast<uint32_t>(transposed.x) };
+
+		// Gray decode
+		const uint32_t	t{ axes[2] >> 1 };
+		axes[2] ^= axes[1];
+		axes[1] ^= axes[0];
+		axes[0] ^= t;
+
+		// Undo excess work
+		for (uint32_t q{ 2 }; q != (1u << bits); q <<= 1)
+		{
+			const uint32_t	p{ q - 1 };
+			for (int i{ 2 }; i >= 0; --i)
+			{
+				if (axes[i] & q)
+					axes[0] ^= p;
+				else
+				{
+					const uint32_t	u{ (axes[0] ^ axes[i]) & p };
+					axes[0] ^= u;
+					axes[i] ^= u;
+				}
+			}
+		}
+		return IVec3(static_cast<int>(axes[0]), static_cast<int>(axes[1]), static_cast<int>(axes[2]));
+	}
+}
+
+#endif
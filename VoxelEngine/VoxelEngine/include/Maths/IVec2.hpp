@@ -0,0 +1,156 @@
+#ifndef __IVEC2__
+#define __IVEC2__
+
+#include "Maths/MathMinimal.h"
+
+#include <type_traits>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <iostream>
+
+#include "Maths/Vec2.hpp"
+
+namespace Maths
+{
+	/**
+	 * Mixes the bits of a 64 bits key (splitmix64 finalizer), so that
+	 * close coordinates give unrelated hashes
+	 * @param key: Key to mix
+	 * @return Hash of the key
+	 */
+	inline constexpr uint64_t	HashMix(uint64_t key) noexcept
+	{
+		key ^= key >> 30;
+		key *= 0xbf58476d1ce4e5b9ull;
+		key ^= key >> 27;
+		key *= 0x94d049bb133111ebull;
+		return key ^ (key >> 31);
+	}
+
+	/**
+	 * Integer vector with predefined size of 2, used to address columns of voxels
+	 */
+	struct IVec2
+	{
+		int	x;
+		int	y;
+
+		/**
+		 * Default constructor, creates a vec zero
+		 */
+		inline constexpr		IVec2() noexcept : x{ 0 }, y{ 0 } {}
+
+		/**
+		 * Creates a vector with all its values initialized at the given value
+		 * @param i: Value to witch vector is initialized
+		 */
+		inline constexpr explicit	IVec2(const int i) noexcept : x{ i }, y{ i } {}
+
+		/**
+		 * Creates a vector with the given values
+		 * @param X: x value of the vector
+		 * @param Y: y value of the vector
+		 */
+		inline constexpr		IVec2(const int X, const int Y) noexcept : x{ X }, y{ Y } {}
+
+		/**
+		 * Computes the integer coordinates of the cell containing the given point
+		 * @param v: Point to compute the cell of
+		 * @return The components of v rounded toward negative infinity
+		 */
+		static inline constexpr IVec2	Floor(const Vec2& v) noexcept
+		{
+			return IVec2(FloorToInt(v.x), FloorToInt(v.y));
+		}
+
+		/**
+		 * Conversion to a float vector
+		 */
+		inline constexpr explicit	operator Vec2() const noexcept
+		{
+			return Vec2(static_cast<float>(x), static_cast<float>(y));
+		}
+
+		inline constexpr bool		operator== (const IVec2& v) const noexcept = default;
+
+		inline constexpr IVec2		operator+ (const IVec2& v) const noexcept { return IVec2(x + v.x, y + v.y); }
+		inline constexpr IVec2		operator- (const IVec2& v) const noexcept { return IVec2(x - v.x, y - v.y); }
+		inline constexpr IVec2		operator- () const noexcept { return IVec2(-x, -y); }
+		inline constexpr IVec2		operator* (const int i) const noexcept { return IVec2(x * i, y * i); }
+		inline constexpr IVec2&		operator+= (const IVec2& v) noexcept { x += v.x; y += v.y; return *this; }
+		inline constexpr IVec2&		operator-= (const IVec2& v) noexcept { x -= v.x; y -= v.y; return *this; }
+
+		/**
+		 * Arithmetic shifts, which are floor divisions and multiplications by powers of two
+		 * @param shift: Power of two to divide or multiply by
+		 */
+		inline constexpr IVec2		operator>> (const unsigned shift) const noexcept { return IVec2(x >> shift, y >> shift); }
+		inline constexpr IVec2		operator<< (const unsigned shift) const noexcept { return IVec2(x << shift, y << shift); }
+
+		/**
+		 * Bitwise and of every component, which is a floor modulo by mask + 1
+		 * when mask + 1 is a power of two
+		 * @param mask: Mask to apply
+		 */
+		inline constexpr IVec2		operator& (const int mask) const noexcept { return IVec2(x & mask, y & mask); }
+
+		/**
+		 * Divides every component, rounding toward negative infinity
+		 * @param d: Positive divisor
+		 * @return The vector divided
+		 */
+		inline constexpr IVec2		FloorDiv(const int d) const noexcept
+		{
+			return IVec2(Maths::FloorDiv(x, d), Maths::FloorDiv(y, d));
+		}
+
+		/**
+		 * Computes the remainder of FloorDiv for every component
+		 * @param d: Positive divisor
+		 * @return Components between 0 and d - 1
+		 */
+		inline constexpr IVec2		FloorMod(const int d) const noexcept
+		{
+			return IVec2(Maths::FloorMod(x, d), Maths::FloorMod(y, d));
+		}
+
+		/**
+		 * Computes a well distributed hash of the vector
+		 * @return Hash of the vector
+		 */
+		inline constexpr size_t		Hash() const noexcept
+		{
+			return static_cast<size_t>(HashMix(static_cast<uint64_t>(static_cast<uint32_t>(x)) |
+											   static_cast<uint64_t>(static_cast<uint32_t>(y)) << 32));
+		}
+
+		/**
+		 * Converts vector to string format
+		 * @return String version of the current vector
+		 */
+		inline std::string			ToString() const noexcept
+		{
+			return std::to_string(x) + " " + std::to_string(y);
+		}
+
+		/**
+		 * Print current vector to the console
+		 */
+		inline void					Print() const noexcept
+		{
+			std::cout << ToString() << std::endl;
+		}
+	};
+}
+
+template <>
+struct std::hash<Maths::IVec2>
+{
+	inline size_t	operator() (const Maths::IVec2& v) const noexcept
+	{
+		return v.Hash();
+	}
+};
+
+#endif
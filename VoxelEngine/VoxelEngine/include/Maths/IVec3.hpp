@@ -0,0 +1,153 @@
+#ifndef __IVEC3__
+#define __IVEC3__
+
+#include "Maths/MathMinimal.h"
+
+#include <type_traits>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <iostream>
+
+#include "Maths/Vec3.hpp"
+#include "Maths/IVec2.hpp"
+
+namespace Maths
+{
+	/**
+	 * Integer vector with predefined size of 3, used to address voxels and chunks
+	 */
+	struct IVec3
+	{
+		int	x;
+		int	y;
+		int	z;
+
+		/**
+		 * Default constructor, creates a vec zero
+		 */
+		inline constexpr		IVec3() noexcept : x{ 0 }, y{ 0 }, z{ 0 } {}
+
+		/**
+		 * Creates a vector with all its values initialized at the given value
+		 * @param i: Value to witch vector is initialized
+		 */
+		inline constexpr explicit	IVec3(const int i) noexcept : x{ i }, y{ i }, z{ i } {}
+
+		/**
+		 * Creates a vector with the given values
+		 * @param X: x value of the vector
+		 * @param Y: y value of the vector
+		 * @param Z: z value of the vector
+		 */
+		inline constexpr		IVec3(const int X, const int Y, const int Z) noexcept : x{ X }, y{ Y }, z{ Z } {}
+
+		/**
+		 * Computes the integer coordinates of the voxel containing the given point
+		 * @param v: Point to compute the voxel of
+		 * @return The components of v rounded toward negative infinity
+		 */
+		static inline constexpr IVec3	Floor(const Vec3& v) noexcept
+		{
+			return IVec3(FloorToInt(v.x), FloorToInt(v.y), FloorToInt(v.z));
+		}
+
+		/**
+		 * Conversion to a float vector
+		 */
+		inline constexpr explicit	operator Vec3() const noexcept
+		{
+			return Vec3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+		}
+
+		/**
+		 * Returns the horizontal coordinates of the vector, x and z
+		 * @return Column of the vector
+		 */
+		inline constexpr IVec2		XZ() const noexcept { return IVec2(x, z); }
+
+		inline constexpr bool		operator== (const IVec3& v) const noexcept = default;
+
+		inline constexpr IVec3		operator+ (const IVec3& v) const noexcept { return IVec3(x + v.x, y + v.y, z + v.z); }
+		inline constexpr IVec3		operator- (const IVec3& v) const noexcept { return IVec3(x - v.x, y - v.y, z - v.z); }
+		inline constexpr IVec3		operator- () const noexcept { return IVec3(-x, -y, -z); }
+		inline constexpr IVec3		operator* (const int i) const noexcept { return IVec3(x * i, y * i, z * i); }
+		inline constexpr IVec3&		operator+= (const IVec3& v) noexcept { x += v.x; y += v.y; z += v.z; return *this; }
+		inline constexpr IVec3&		operator-= (const IVec3& v) noexcept { x -= v.x; y -= v.y; z -= v.z; return *this; }
+
+		/**
+		 * Arithmetic shifts, which are floor divisions and multiplications by powers of two
+		 * @param shift: Power of two to divide or multiply by
+		 */
+		inline constexpr IVec3		operator>> (const unsigned shift) const noexcept { return IVec3(x >> shift, y >> shift, z >> shift); }
+		inline constexpr IVec3		operator<< (const unsigned shift) const noexcept { return IVec3(x << shift, y << shift, z << shift); }
+
+		/**
+		 * Bitwise and of every component, which is a floor modulo by mask + 1
+		 * when mask + 1 is a power of two
+		 * @param mask: Mask to apply
+		 */
+		inline constexpr IVec3		operator& (const int mask) const noexcept { return IVec3(x & mask, y & mask, z & mask); }
+
+		/**
+		 * Divides every component, rounding toward negative infinity
+		 * @param d: Positive divisor
+		 * @return The vector divided
+		 */
+		inline constexpr IVec3		FloorDiv(const int d) const noexcept
+		{
+			return IVec3(Maths::FloorDiv(x, d), Maths::FloorDiv(y, d), Maths::FloorDiv(z, d));
+		}
+
+		/**
+		 * Computes the remainder of FloorDiv for every component
+		 * @param d: Positive divisor
+		 * @return Components between 0 and d - 1
+		 */
+		inline constexpr IVec3		FloorMod(const int d) const noexcept
+		{
+			return IVec3(Maths::FloorMod(x, d), Maths::FloorMod(y, d), Maths::FloorMod(z, d));
+		}
+
+		/**
+		 * Computes a well distributed hash of the vector. Components
+		 * are packed on 21 bits each before being mixed
+		 * @return Hash of the vector
+		 */
+		inline constexpr size_t		Hash() const noexcept
+		{
+			constexpr uint64_t	mask{ (1ull << 21) - 1 };
+			return static_cast<size_t>(HashMix((static_cast<uint64_t>(x) & mask) |
+											   (static_cast<uint64_t>(y) & mask) << 21 |
+											   (static_cast<uint64_t>(z) & mask) << 42));
+		}
+
+		/**
+		 * Converts vector to string format
+		 * @return String version of the current vector
+		 */
+		inline std::string			ToString() const noexcept
+		{
+			return std::to_string(x) + " " + std::to_string(y) + " " + std::to_string(z);
+		}
+
+		/**
+		 * Print current vector to the console
+		 */
+		inline void					Print() const noexcept
+		{
+			std::cout << ToString() << std::endl;
+		}
+	};
+}
+
+template <>
+struct std::hash<Maths::IVec3>
+{
+	inline size_t	operator() (const Maths::IVec3& v) const noexcept
+	{
+		return v.Hash();
+	}
+};
+
+#endif
@@ -0,0 +1,616 @@
+#ifndef __INTERSECTION__
+#define __INTERSECTION__
+
+#include "Maths/MathMinimal.h"
+
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <span>
+
+#include "Maths/Vec3.hpp"
+#include "Maths/Vec3Stream.hpp"
+#include "Maths/Aabb.hpp"
+#include "Maths/Obb.hpp"
+#include "Maths/Sphere.hpp"
+#include "Maths/Plane.hpp"
+#include "Maths/Ray.hpp"
+#include "Maths/Capsule.hpp"
+#include "Maths/Simd.hpp"
+
+namespace Maths
+{
+	/**
+	 * Overlap tests between every pair of primitives. Shapes touching on their
+	 * surface intersect. Planes are infinite surfaces, not half spaces: a shape
+	 * intersects a plane when it has points on both sides or on the plane.
+	 * The ray queries return the distance to the first hit along the ray,
+	 * zero when the origin is inside the shape
+	 */
+	namespace Intersection
+	{
+		/**
+		 * Tolerance of the tests between flat or thin shapes (parallel planes, crossing rays)
+		 */
+		constexpr float	EPSILON{ 1e-5f };
+
+		/**
+		 * Minimum as computed by the SIMD instructions, b is returned when a value is NaN,
+		 * private function you're not supposed to use
+		 */
+		inline constexpr float	Min_IMPL(const float a, const float b) noexcept { return a < b ? a : b; }
+		inline constexpr float	Max_IMPL(const float a, const float b) noexcept { return a > b ? a : b; }
+		inline constexpr float	Clamp_IMPL(const float f, const float lower, const float upper) noexcept
+		{
+			return f < lower ? lower : (f > upper ? upper : f);
+		}
+
+		/**
+		 * Computes the squared distance between two segments p1 + s * d1 and p2 + t * d2, with s in
+		 * [0, sMax] and t in [0, tMax]. An infinite bound turns a segment into a ray (Ericson, 5.1.9),
+		 * private function you're not supposed to use
+		 * @param s: Receives the parameter of the closest point of the first segment
+		 * @param t: Receives the parameter of the closest point of the second segment
+		 * @return Squared distance between the closest points
+		 */
+		inline constexpr float	SegmentSegment_IMPL(const Vec3& p1, const Vec3& d1, const float sMax,
+													const Vec3& p2, const Vec3& d2, const float tMax,
+													float& s, float& t) noexcept
+		{
+			const Vec3	r{ p1 - p2 };
+			const float	a{ d1.SquaredLength() };
+			const float	e{ d2.SquaredLength() };
+			const float	f{ d2.Dot(r) };
+
+			if (a <= 0.f && e <= 0.f)
+			{
+				s = t = 0.f;
+				return r.SquaredLength();
+			}
+			if (a <= 0.f)
+			{
+				s = 0.f;
+				t = Clamp_IMPL(f / e, 0.f, tMax);
+			}
+			else
+			{
+				const float	c{ d1.Dot(r) };
+				if (e <= 0.f)
+				{
+					t = 0.f;
+					s = Clamp_IMPL(-c / a, 0.f, sMax);
+				}
+				else
+				{
+					const float	b{ d1.Dot(d2) };
+					const float	denom{ a * e - b * b };
+
+					// Parallel segments have a range of closest points, any one of them fits
+					s = denom > 0.f ? Clamp_IMPL((b * f - c * e) / denom, 0.f, sMax) : 0.f;
+					t = (b * s + f) / e;
+					if (t < 0.f)
+					{
+						t = 0.f;
+						s = Clamp_IMPL(-c / a, 0.f, sMax);
+					}
+					else if (t > tMax)
+					{
+						t = tMax;
+						s = Clamp_IMPL((b * tMax - c) / a, 0.f, sMax);
+					}
+				}
+			}
+			return (p1 + d1 * s - (p2 + d2 * t)).SquaredLength();
+		}
+
+		/**
+		 * Clips the line p + s * d to the slabs of a box with the operands ordered like
+		 * Simd::RayAabbSoA, private function you're not supposed to use
+		 * @param nearT: Start of the interval to clip, receives the entry parameter
+		 * @param farT: End of the interval to clip, receives the exit parameter
+		 * @return Whether the clipped interval is not empty
+		 */
+		inline constexpr bool	ClipSlabs_IMPL(const Aabb& box, const Vec3& p, const Vec3& d, float& nearT, float& farT) noexcept
+		{
+			for (unsigned axis{ 0 }; axis < 3; ++axis)
+			{
+				const float	inv{ 1.f / d.xyz[axis] };
+				const float	t1{ (box.min.xyz[axis] - p.xyz[axis]) * inv };
+				const float	t2{ (box.max.xyz[axis] - p.xyz[axis]) * inv };
+				nearT = Max_IMPL(Min_IMPL(t1, t2), nearT);
+				farT = Min_IMPL(Max_IMPL(t1, t2), farT);
+			}
+			return nearT <= farT;
+		}
+
+		/**
+		 * Computes the squared distance between a segment and a box, zero if they
+		 * intersect. Otherwise the closest points are on an end of the segment or on
+		 * an edge of the box, private function you're not supposed to use
+		 */
+		inline constexpr float	SegmentAabb_IMPL(const Vec3& a, const Vec3& b, const Aabb& box) noexcept
+		{
+			float	nearT{ 0.f }, farT{ 1.f };
+			if (ClipSlabs_IMPL(box, a, b - a, nearT, farT))
+				return 0.f;
+
+			const Vec3	ab{ b - a };
+			float		best{ Min_IMPL(box.SquaredDistance(a), box.SquaredDistance(b)) };
+			float		s{ 0.f }, t{ 0.f };
+			for (unsigned axis{ 0 }; axis < 3; ++axis)
+			{
+				const unsigned	u{ (axis + 1) % 3 }, v{ (axis + 2) % 3 };
+				Vec3			edge;
+				edge.xyz[axis] = box.max.xyz[axis] - box.min.xyz[axis];
+				for (unsigned corner{ 0 }; corner < 4; ++corner)
+				{
+					Vec3	start{ box.min };
+					start.xyz[u] = (corner & 1) ? box.max.xyz[u] : box.min.xyz[u];
+					start.xyz[v] = (corner & 2) ? box.max.xyz[v] : box.min.xyz[v];
+					best = Min_IMPL(SegmentSegment_IMPL(a, ab, 1.f, start, edge, 1.f, s, t), best);
+				}
+			}
+			return best;
+		}
+
+		/**
+		 * Computes the radius of a box projected on an axis
+		 * private function you're not supposed to use
+		 */
+		inline constexpr float	ProjectedRadius_IMPL(const Obb& box, const Vec3& axis) noexcept
+		{
+			float	radius{ 0.f };
+			for (unsigned i{ 0 }; i < 3; ++i)
+			{
+				const float	d{ box.axes[i].Dot(axis) };
+				radius += (d < 0.f ? -d : d) * box.halfExtents.xyz[i];
+			}
+			return radius;
+		}
+
+		inline constexpr Aabb	LocalAabb_IMPL(const Obb& box) noexcept
+		{
+			return Aabb(Vec3() - box.halfExtents, box.halfExtents);
+		}
+
+		/* Aabb */
+
+		inline constexpr bool	Intersects(const Aabb& a, const Aabb& b) noexcept
+		{
+			return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y
+				&& a.min.z <= b.max.z && b.min.z <= a.max.z;
+		}
+
+		inline constexpr bool	Intersects(const Aabb& box, const Sphere& sphere) noexcept
+		{
+			return box.SquaredDistance(sphere.center) <= sphere.radius * sphere.radius;
+		}
+
+		inline constexpr bool	Intersects(const Aabb& box, const Plane& plane) noexcept
+		{
+			const Vec3	n{ plane.normal };
+			const Vec3	e{ box.HalfExtents() };
+			const float	radius{ e.x * (n.x < 0.f ? -n.x : n.x) + e.y * (n.y < 0.f ? -n.y : n.y) + e.z * (n.z < 0.f ? -n.z : n.z) };
+			const float	d{ plane.Distance(box.Center()) };
+			return (d < 0.f ? -d : d) <= radius;
+		}
+
+		inline constexpr bool	Intersects(const Aabb& box, const Capsule& capsule) noexcept
+		{
+			return SegmentAabb_IMPL(capsule.a, capsule.b, box) <= capsule.radius * capsule.radius;
+		}
+
+		/**
+		 * Intersects a ray with a box with the slab test
+		 * @param ray: Ray to cast
+		 * @param box: Box to intersect
+		 * @param t: Receives the distance along the ray of the first hit, unchanged on a miss
+		 * @param maxDistance: Distance after which the box is missed
+		 * @return Whether the ray hits the box
+		 */
+		inline constexpr bool	Raycast(const Ray& ray, const Aabb& box, float& t,
+										const float maxDistance = std::numeric_limits<float>::infinity()) noexcept
+		{
+			float	nearT{ 0.f }, farT{ maxDistance };
+			if (!ClipSlabs_IMPL(box, ray.origin, ray.direction, nearT, farT))
+				return false;
+			t = nearT;
+			return true;
+		}
+
+		/* Obb */
+
+		/**
+		 * Separating axis test, on the axes of both boxes and their 9 cross products
+		 */
+		inline bool	Intersects(const Obb& a, const Obb& b) noexcept
+		{
+			const Vec3	d{ b.center - a.center };
+			float		r[3][3], absR[3][3];
+			for (unsigned i{ 0 }; i < 3; ++i)
+				for (unsigned j{ 0 }; j < 3; ++j)
+				{
+					r[i][j] = a.axes[i].Dot(b.axes[j]);
+					// The epsilon keeps the cross products of near parallel axes from separating
+					absR[i][j] = std::fabs(r[i][j]) + EPSILON;
+				}
+
+			// d in the frame of a
+			const float	t[3]{ d.Dot(a.axes[0]), d.Dot(a.axes[1]), d.Dot(a.axes[2]) };
+			const Vec3&	ea{ a.halfExtents };
+			const Vec3&	eb{ b.halfExtents };
+
+			for (unsigned i{ 0 }; i < 3; ++i)
+				if (std::fabs(t[i]) > ea.xyz[i] + eb.x * absR[i][0] + eb.y * absR[i][1] + eb.z * absR[i][2])
+					return false;
+
+			for (unsigned j{ 0 }; j < 3; ++j)
+				if (std::fabs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j])
+					> ea.x * absR[0][j] + ea.y * absR[1][j] + ea.z * absR[2][j] + eb.xyz[j])
+					return false;
+
+			for (unsigned i{ 0 }; i < 3; ++i)
+			{
+				const unsigned	i1{ (i + 1) % 3 }, i2{ (i + 2) % 3 };
+				for (unsigned j{ 0 }; j < 3; ++j)
+				{
+					const unsigned	j1{ (j + 1) % 3 }, j2{ (j + 2) % 3 };
+					// Axis a.axes[i] x b.axes[j]
+					const float	ra{ ea.xyz[i1] * absR[i2][j] + ea.xyz[i2] * absR[i1][j] };
+					const float	rb{ eb.xyz[j1] * absR[i][j2] + eb.xyz[j2] * absR[i][j1] };
+					if (std::fabs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > ra + rb)
+						return false;
+				}
+			}
+			return true;
+		}
+
+		inline bool				Intersects(const Aabb& box, const Obb& obb) noexcept
+		{
+			return Intersects(Obb(box), obb);
+		}
+
+		inline constexpr bool	Intersects(const Obb& box, const Sphere& sphere) noexcept
+		{
+			return LocalAabb_IMPL(box).SquaredDistance(box.ToLocal(sphere.center)) <= sphere.radius * sphere.radius;
+		}
+
+		inline constexpr bool	Intersects(const Obb& box, const Plane& plane) noexcept
+		{
+			const float	d{ plane.Distance(box.center) };
+			return (d < 0.f ? -d : d) <= ProjectedRadius_IMPL(box, plane.normal);
+		}
+
+		inline constexpr bool	Intersects(const Obb& box, const Capsule& capsule) noexcept
+		{
+			return SegmentAabb_IMPL(box.ToLocal(capsule.a), box.ToLocal(capsule.b), LocalAabb_IMPL(box))
+				<= capsule.radius * capsule.radius;
+		}
+
+		/**
+		 * Intersects a ray with an oriented box, in the frame of the box
+		 * @param ray: Ray to cast
+		 * @param box: Box to intersect
+		 * @param t: Receives the distance along the ray of the first hit, unchanged on a miss
+		 * @param maxDistance: Distance after which the box is missed
+		 * @return Whether the ray hits the box
+		 */
+		inline constexpr bool	Raycast(const Ray& ray, const Obb& box, float& t,
+										const float maxDistance = std::numeric_limits<float>::infinity()) noexcept
+		{
+			return Raycast(Ray(box.ToLocal(ray.origin), box.ToLocalDirection(ray.direction)), LocalAabb_IMPL(box), t, maxDistance);
+		}
+
+		/* Sphere */
+
+		inline constexpr bool	Intersects(const Sphere& a, const Sphere& b) noexcept
+		{
+			const float	radius{ a.radius + b.radius };
+			return (b.center - a.center).SquaredLength() <= radius * radius;
+		}
+
+		inline constexpr bool	Intersects(const Sphere& sphere, const Plane& plane) noexcept
+		{
+			const float	d{ plane.Distance(sphere.center) };
+			return (d < 0.f ? -d : d) <= sphere.radius;
+		}
+
+		inline constexpr bool	Intersects(const Sphere& sphere, const Capsule& capsule) noexcept
+		{
+			const float	radius{ sphere.radius + capsule.radius };
+			return (sphere.center - capsule.ClosestSegmentPoint(sphere.center)).SquaredLength() <= radius * radius;
+		}
+
+		/**
+		 * Intersects a ray with a sphere
+		 * @param ray: Ray to cast, with a unit direction
+		 * @param sphere: Sphere to intersect
+		 * @param t: Receives the distance along the ray of the first hit, unchanged on a miss
+		 * @param maxDistance: Distance after which the sphere is missed
+		 * @return Whether the ray hits the sphere
+		 */
+		inline bool				Raycast(const Ray& ray, const Sphere& sphere, float& t,
+										const float maxDistance = std::numeric_limits<float>::infinity()) noexcept
+		{
+			const Vec3	oc{ ray.origin - sphere.center };
+			const float	b{ oc.Dot(ray.direction) };
+			const float	c{ oc.SquaredLength() - sphere.radius * sphere.radius };
+			if (c <= 0.f)
+			{
+				t = 0.f;
+				return true;
+			}
+
+			const float	h{ b * b - c };
+			if (b > 0.f || h < 0.f)
+				return false;
+
+			const float	hit{ -b - std::sqrt(h) };
+			if (hit > maxDistance)
+				return false;
+			t = hit;
+			return true;
+		}
+
+		/* Plane */
+
+		inline constexpr bool	Intersects(const Plane& a, const Plane& b) noexcept
+		{
+			// Two planes always cross unless they are parallel and apart
+			if (a.normal.Cross(b.normal).SquaredLength() > EPSILON * EPSILON)
+				return true;
+			const float	d{ a.normal.Dot(b.normal) < 0.f ? a.distance + b.distance : a.distance - b.distance };
+			return (d < 0.f ? -d : d) <= EPSILON;
+		}
+
+		inline constexpr bool	Intersects(const Plane& plane, const Capsule& capsule) noexcept
+		{
+			const float	da{ plane.Distance(capsule.a) };
+			const float	db{ plane.Distance(capsule.b) };
+			if ((da <= 0.f) != (db <= 0.f))
+				return true;
+			const float	closest{ Min_IMPL(da < 0.f ? -da : da, db < 0.f ? -db : db) };
+			return closest <= capsule.radius;
+		}
+
+		/**
+		 * Intersects a ray with a plane, from either side
+		 * @param ray: Ray to cast
+		 * @param plane: Plane to intersect
+		 * @param t: Receives the distance along the ray of the hit, unchanged on a miss
+		 * @param maxDistance: Distance after which the plane is missed
+		 * @return Whether the ray hits the plane
+		 */
+		inline constexpr bool	Raycast(const Ray& ray, const Plane& plane, float& t,
+										const float maxDistance = std::numeric_limits<float>::infinity()) noexcept
+		{
+			const float	d{ plane.Distance(ray.origin) };
+			if (d == 0.f)
+			{
+				t = 0.f;
+				return true;
+			}
+
+			// Parallel and off the plane, the division would give an infinite hit
+			const float	denom{ plane.normal.Dot(ray.direction) };
+			if (denom == 0.f)
+				return false;
+
+			const float	hit{ -d / denom };
+			if (!(hit >= 0.f && hit <= maxDistance))
+				return false;
+			t = hit;
+			return true;
+		}
+
+		/* Capsule */
+
+		inline constexpr bool	Intersects(const Capsule& a, const Capsule& b) noexcept
+		{
+			float		s{ 0.f }, t{ 0.f };
+			const float	radius{ a.radius + b.radius };
+			return SegmentSegment_IMPL(a.a, a.b - a.a, 1.f, b.a, b.b - b.a, 1.f, s, t) <= radius * radius;
+		}
+
+		/**
+		 * Intersects a ray with a capsule, as a cylinder closed by two spheres
+		 * @param ray: Ray to cast, with a unit direction
+		 * @param capsule: Capsule to intersect
+		 * @param t: Receives the distance along the ray of the first hit, unchanged on a miss
+		 * @param maxDistance: Distance after which the capsule is missed
+		 * @return Whether the ray hits the capsule
+		 */
+		inline bool				Raycast(const Ray& ray, const Capsule& capsule, float& t,
+										const float maxDistance = std::numeric_limits<float>::infinity()) noexcept
+		{
+			if (capsule.Contains(ray.origin))
+			{
+				t = 0.f;
+				return true;
+			}
+
+			const Vec3	ba{ capsule.b - capsule.a };
+			const Vec3	oa{ ray.origin - capsule.a };
+			const float	baba{ ba.SquaredLength() };
+			const float	bard{ ba.Dot(ray.direction) };
+			const float	baoa{ ba.Dot(oa) };
+			const float	a{ baba - bard * bard };
+			float		hit{ maxDistance };
+			bool		found{ false };
+
+			// Cylinder, kept if the hit is between the two ends
+			if (a > 0.f)
+			{
+				const float	b{ baba * ray.direction.Dot(oa) - baoa * bard };
+				const float	c{ baba * oa.SquaredLength() - baoa * baoa - capsule.radius * capsule.radius * baba };
+				const float	h{ b * b - a * c };
+				if (h >= 0.f)
+				{
+					const float	cylinder{ (-b - std::sqrt(h)) / a };
+					const float	y{ baoa + cylinder * bard };
+					if (cylinder >= 0.f && cylinder <= hit && y >= 0.f && y <= baba)
+					{
+						hit = cylinder;
+						found = true;
+					}
+				}
+			}
+
+			// Spheres at both ends
+			for (const Vec3& end : { capsule.a, capsule.b })
+			{
+				float	sphereHit;
+				if (Raycast(ray, Sphere(end, capsule.radius), sphereHit, hit))
+				{
+					hit = sphereHit;
+					found = true;
+				}
+			}
+
+			if (found)
+				t = hit;
+			return found;
+		}
+
+		/* Ray, the queries testing a ray without the distance of the hit */
+
+		inline constexpr bool	Intersects(const Ray& ray, const Aabb& box) noexcept
+		{
+			float	t{ 0.f };
+			return Raycast(ray, box, t);
+		}
+
+		inline constexpr bool	Intersects(const Ray& ray, const Obb& box) noexcept
+		{
+			float	t{ 0.f };
+			return Raycast(ray, box, t);
+		}
+
+		inline bool				Intersects(const Ray& ray, const Sphere& sphere) noexcept
+		{
+			float	t{ 0.f };
+			return Raycast(ray, sphere, t);
+		}
+
+		inline constexpr bool	Intersects(const Ray& ray, const Plane& plane) noexcept
+		{
+			float	t{ 0.f };
+			return Raycast(ray, plane, t);
+		}
+
+		inline constexpr bool	Intersects(const Ray& ray, const Capsule& capsule) noexcept
+		{
+			float		s{ 0.f }, t{ 0.f };
+			const float	inf{ std::numeric_limits<float>::infinity() };
+			return SegmentSegment_IMPL(ray.origin, ray.direction, inf, capsule.a, capsule.b - capsule.a, 1.f, s, t)
+				<= capsule.radius * capsule.radius;
+		}
+
+		/**
+		 * Checks if two rays cross, within EPSILON
+		 */
+		inline constexpr bool	Intersects(const Ray& a, const Ray& b) noexcept
+		{
+			float		s{ 0.f }, t{ 0.f };
+			const float	inf{ std::numeric_limits<float>::infinity() };
+			return SegmentSegment_IMPL(a.origin, a.direction, inf, b.origin, b.direction, inf, s, t) <= EPSILON * EPSILON;
+		}
+
+		/* Symmetric overloads, so that any order of a pair compiles */
+
+		inline bool				Intersects(const Obb& obb, const Aabb& box) noexcept { return Intersects(box, obb); }
+		inline constexpr bool	Intersects(const Sphere& sphere, const Aabb& box) noexcept { return Intersects(box, sphere); }
+		inline constexpr bool	Intersects(const Plane& plane, const Aabb& box) noexcept { return Intersects(box, plane); }
+		inline constexpr bool	Intersects(const Capsule& capsule, const Aabb& box) noexcept { return Intersects(box, capsule); }
+		inline constexpr bool	Intersects(const Aabb& box, const Ray& ray) noexcept { return Intersects(ray, box); }
+		inline constexpr bool	Intersects(const Sphere& sphere, const Obb& box) noexcept { return Intersects(box, sphere); }
+		inline constexpr bool	Intersects(const Plane& plane, const Obb& box) noexcept { return Intersects(box, plane); }
+		inline constexpr bool	Intersects(const Capsule& capsule, const Obb& box) noexcept { return Intersects(box, capsule); }
+		inline constexpr bool	Intersects(const Obb& box, const Ray& ray) noexcept { return Intersects(ray, box); }
+		inline constexpr bool	Intersects(const Plane& plane, const Sphere& sphere) noexcept { return Intersects(sphere, plane); }
+		inline constexpr bool	Intersects(const Capsule& capsule, const Sphere& sphere) noexcept { return Intersects(sphere, capsule); }
+		inline bool				Intersects(const Sphere& sphere, const Ray& ray) noexcept { return Intersects(ray, sphere); }
+		inline constexpr bool	Intersects(const Capsule& capsule, const Plane& plane) noexcept { return Intersects(plane, capsule); }
+		inline constexpr bool	Intersects(const Plane& plane, const Ray& ray) noexcept { return Intersects(ray, plane); }
+		inline constexpr bool	Intersects(const Capsule& capsule, const Ray& ray) noexcept { return Intersects(ray, capsule); }
+
+		/* Batches against boxes stored in SoA, dispatched at runtime (see Simd::RayAabbSoA) */
+
+		/**
+		 * Casts a ray against a list of boxes
+		 * @param ray: Ray to cast
+		 * @param min: x, y and z arrays of the minimum corners of the boxes
+		 * @param max: x, y and z arrays of the maximum corners of the boxes
+		 * @param count: Number of boxes
+		 * @param hits: Receives the indices of the boxes hit in increasing order, at least of count
+		 * @param distances: Receives the distance of each hit like Raycast, empty if not needed
+		 * @param maxDistance: Distance after which the boxes are missed
+		 * @return Number of boxes hit
+		 */
+		inline size_t	RaycastAabbs(const Ray& ray, const float* const min[3], const float* const max[3], const size_t count,
+									 std::span<unsigned> hits, std::span<float> distances = {},
+									 const float maxDistance = std::numeric_limits<float>::infinity()) noexcept
+		{
+			const Vec3	inv{ ray.InverseDirection() };
+			return Simd::RayAabbSoA(ray.origin.xyz, inv.xyz, maxDistance, min, max, count, hits.data(),
+									distances.empty() ? nullptr : distances.data());
+		}
+
+		inline size_t	RaycastAabbs(const Ray& ray, const Vec3Stream& mins, const Vec3Stream& maxs, std::span<unsigned> hits,
+									 std::span<float> distances = {},
+									 const float maxDistance = std::numeric_limits<float>::infinity()) noexcept
+		{
+			const float* const	min[3]{ mins.X(), mins.Y(), mins.Z() };
+			const float* const	max[3]{ maxs.X(), maxs.Y(), maxs.Z() };
+			return RaycastAabbs(ray, min, max, mins.Size(), hits, distances, maxDistance);
+		}
+
+		/**
+		 * Finds the boxes of a list overlapping a sphere
+		 * @param sphere: Sphere to test
+		 * @param min: x, y and z arrays of the minimum corners of the boxes
+		 * @param max: x, y and z arrays of the maximum corners of the boxes
+		 * @param count: Number of boxes
+		 * @param hits: Receives the indices of the overlapping boxes in increasing order, at least of count
+		 * @return Number of overlapping boxes
+		 */
+		inline size_t	OverlapAabbs(const Sphere& sphere, const float* const min[3], const float* const max[3],
+									 const size_t count, std::span<unsigned> hits) noexcept
+		{
+			return Simd::SphereAabbSoA(sphere.center.xyz, sphere.radius, min, max, count, hits.data());
+		}
+
+		inline size_t	OverlapAabbs(const Sphere& sphere, const Vec3Stream& mins, const Vec3Stream& maxs,
+									 std::span<unsigned> hits) noexcept
+		{
+			const float* const	min[3]{ mins.X(), mins.Y(), mins.Z() };
+			const float* const	max[3]{ maxs.X(), maxs.Y(), maxs.Z() };
+			return OverlapAabbs(sphere, min, max, mins.Size(), hits);
+		}
+
+		/**
+		 * Finds the boxes of a list overlapping a box
+		 * @param box: Box to test
+		 * @param min: x, y and z arrays of the minimum corners of the boxes
+		 * @param max: x, y and z arrays of the maximum corners of the boxes
+		 * @param count: Number of boxes
+		 * @param hits: Receives the indices of the overlapping boxes in increasing order, at least of count
+		 * @return Number of overlapping boxes
+		 */
+		inline size_t	OverlapAabbs(const Aabb& box, const float* const min[3], const float* const max[3],
+									 const size_t count, std::span<unsigned> hits) noexcept
+		{
+			return Simd::AabbAabbSoA(box.min.xyz, box.max.xyz, min, max, count, hits.data());
+		}
+
+		inline size_t	OverlapAabbs(const Aabb& box, const Vec3Stream& mins, const Vec3Stream& maxs,
+									 std::span<unsigned> hits) noexcept
+		{
+			const float* const	min[3]{ mins.X(), mins.Y(), mins.Z() };
+			const float* const	max[3]{ maxs.X(), maxs.Y(), maxs.Z() };
+			return OverlapAabbs(box, min, max, mins.Size(), hits);
+		}
+	}
+}
+
+#endif
@@ -44,13 +44,13 @@ namespace Maths
 		 * Creates a copy of the matrix
 		 * @param m: Matrix to be copied
 		 */
-		inline constexpr							Mat(const Mat<Line, Column>& m) noexcept;
+		inline constexpr							Mat(const Mat<Line, Column>& m) noexcept = default;
 
 		/**
 		 * Moves a matrix to another memory location
 		 * @param m: Matrix to be moved
 		 */
-		inline constexpr							Mat(Mat<Line, Column>&& m) noexcept;
+		inline constexpr							Mat(Mat<Line, Column>&& m) noexcept = default;
 
 		/**
 		 * Returns the number of lines of this matrix
@@ -188,6 +188,43 @@ namespace Maths
 		 */
 		inline constexpr Mat<Line, Column>	Inversed() const noexcept requires MatSquare<Line, Column>;
 
+		/**
+		 * Computes the LU decomposition with partial pivoting of the current matrix,
+		 * such that the lines of the current matrix permuted by pivots equal L * U.
+		 * L (with an implicit unit diagonal) and U are stored together in lu
+		 * @param lu: Matrix to emplace the L and U factors
+		 * @param pivots: Array to emplace the line permutation, pivots[i] being
+		 * the line of the current matrix found at line i of lu
+		 * @return Sign of the permutation (1 or -1), or 0 if the matrix is singular
+		 */
+		inline constexpr float				LUDecomposition(Mat<Line, Column>& lu, unsigned (&pivots)[Line]) const noexcept requires MatSquare<Line, Column>;
+
+		/**
+		 * Solves the linear system current matrix * x = b through
+		 * an LU decomposition of the current matrix
+		 * @param b: Right hand side of the system
+		 * @return Solution x of the system, or a zero matrix if
+		 * the current matrix is singular
+		 */
+		inline constexpr Mat<Line, 1>		Solve(const Mat<Line, 1>& b) const noexcept requires MatSquare<Line, Column>;
+	protected:
+		/**
+		 * Solves lu * x = b in place from an LU decomposition,
+		 * private member you're not supposed to use.
+		 * @param lu: LU factors given by LUDecomposition()
+		 * @param b: Right hand side of the system, already permuted by the
+		 * pivots given by LUDecomposition(). Receives the solution
+		 */
+		FORCEINLINE static constexpr void	LUSolve_IMPL(const Mat<Line, Column>& lu, float (&b)[Line]) noexcept;
+		/**
+		 * Implementation of Inversed() through an LU decomposition,
+		 * private member you're not supposed to use.
+		 * @param result: matrix to emplace the result of the operation
+		 * @return Whether the matrix could be inversed
+		 */
+		FORCEINLINE constexpr bool			LUInversed_IMPL(Mat<Line, Column>& result) const noexcept;
+	public:
+
 		/**
 		 * Print current matrix to the console
 		 */
@@ -367,15 +404,15 @@ namespace Maths
 		/**
 		 * Copies the given matrix in current matrix
 		 * @param m: Matrix to copy
-		 * @return A copy of the matrix
+		 * @return Reference to the current matrix
 		 */
-		inline constexpr Mat<Line, Column>	operator= (const Mat<Line, Column>& m) noexcept;
+		inline constexpr Mat<Line, Column>&	operator= (const Mat<Line, Column>& m) noexcept = default;
 		/** 
 		 * Moves the given matrix to the current matrix
 		 * @param m: Matrix to move
-		 * @return A copy of the matrix
+		 * @return Reference to the current matrix
 		 */
-		inline constexpr Mat<Line, Column>	operator= (Mat<Line, Column>&& m) noexcept;
+		inline constexpr Mat<Line, Column>&	operator= (Mat<Line, Column>&& m) noexcept = default;
 	protected:
 		/**
 		 * Implementation of operator* (const Mat<SecLine, SecColumn>&), 
@@ -407,20 +444,6 @@ namespace Maths
 		}
 	}
 
-	template <unsigned Line, unsigned Column>
-	constexpr	Mat<Line, Column>::Mat(const Mat<Line, Column>& m) noexcept : array()
-	{
-		for (unsigned i{ 0 }; i < Size; ++i)
-			array[i] = m(i);
-	}
-
-	template <unsigned Line, unsigned Column>
-	constexpr	Mat<Line, Column>::Mat(Mat<Line, Column>&& m) noexcept : array()
-	{
-		for (unsigned i{ 0 }; i < Line * Column; ++i)
-			array[i] = std::move(m(i));
-	}
-
 	template <unsigned Line, unsigned Column>
 	constexpr unsigned	Mat<Line, Column>::Lines() const noexcept
 	{
@@ -581,14 +604,11 @@ namespace Maths
 		}
 		else if constexpr (Size >= 5U)
 		{
-			float det{ 0 };
-			for (unsigned i{ 0 }; i < Size; ++i)
-			{
-				if (i % 2 == 0)
-					det += Get(0, i) * GetSubMatrix(0, i).Det();
-				else
-					det -= Get(0, i) * GetSubMatrix(0, i).Det();
-			}
+			Mat<Line, Column>	lu;
+			unsigned			pivots[Line]{};
+			float				det{ LUDecomposition(lu, pivots) };
+			for (unsigned i{ 0 }; i < Size && det != 0; ++i)
+				det *= lu(i, i);
 			return det;
 		}
 	}
@@ -668,21 +688,144 @@ namespace Maths
 	template<unsigned Line, unsigned Column>
 	inline constexpr void Maths::Mat<Line, Column>::Inverse() requires MatSquare<Line, Column>
 	{
-		float	det{ Det() };
-		if (det == 0)
-			throw "Mat cannot be inversed: det is 0";
+		if constexpr (Line > 3U)
+		{
+			Mat<Line, Column>	result;
+			if (!LUInversed_IMPL(result))
+				throw "Mat cannot be inversed: det is 0";
 
-		*this = 
-			((GetCofactorMatrix().Transposed()) / det);
+			*this = result;
+		}
+		else
+		{
+			float	det{ Det() };
+			if (det == 0)
+				throw "Mat cannot be inversed: det is 0";
+
+			*this = 
+				((GetCofactorMatrix().Transposed()) / det);
+		}
 	}
 
 	template<unsigned Line, unsigned Column>
 	inline constexpr Mat<Line, Column> Maths::Mat<Line, Column>::Inversed() const noexcept requires MatSquare<Line, Column>
 	{
-		float	det{ Det() };
-		if (det == 0)
-			return Mat<Line, Column>();
-		return (GetCofactorMatrix().Transposed() / det);
+		if constexpr (Line > 3U)
+		{
+			Mat<Line, Column>	result;
+			if (!LUInversed_IMPL(result))
+				return Mat<Line, Column>();
+			return result;
+		}
+		else
+		{
+			float	det{ Det() };
+			if (det == 0)
+				return Mat<Line, Column>();
+			return (GetCofactorMatrix().Transposed() / det);
+		}
+	}
+
+	template<unsigned Line, unsigned Column>
+	inline constexpr float Mat<Line, Column>::LUDecomposition(Mat<Line, Column>& lu, unsigned (&pivots)[Line]) const noexcept requires MatSquare<Line, Column>
+	{
+		float	sign{ 1.f };
+
+		lu = *this;
+		for (unsigned i{ 0 }; i < Line; ++i)
+			pivots[i] = i;
+
+		for (unsigned k{ 0 }, i{ 0 }, j{ 0 }; k < Line; ++k)
+		{
+			unsigned	pivot{ k };
+			float		pivotAbs{ lu(k, k) < 0 ? -lu(k, k) : lu(k, k) };
+			for (i = k + 1; i < Line; ++i)
+			{
+				const float	value{ lu(i, k) < 0 ? -lu(i, k) : lu(i, k) };
+				if (value > pivotAbs)
+				{
+					pivot = i;
+					pivotAbs = value;
+				}
+			}
+
+			if (pivotAbs == 0)
+				return 0;
+
+			if (pivot != k)
+			{
+				for (j = 0; j < Column; ++j)
+					std::swap(lu(k, j), lu(pivot, j));
+				std::swap(pivots[k], pivots[pivot]);
+				sign = -sign;
+			}
+
+			const float	rPivot{ 1.f / lu(k, k) };
+			for (i = k + 1; i < Line; ++i)
+			{
+				const float	factor{ lu(i, k) * rPivot };
+				lu(i, k) = factor;
+				for (j = k + 1; j < Column; ++j)
+					lu(i, j) -= factor * lu(k, j);
+			}
+		}
+
+		return sign;
+	}
+
+	template<unsigned Line, unsigned Column>
+	inline constexpr Mat<Line, 1> Mat<Line, Column>::Solve(const Mat<Line, 1>& b) const noexcept requires MatSquare<Line, Column>
+	{
+		Mat<Line, Column>	lu;
+		unsigned			pivots[Line]{};
+		if (LUDecomposition(lu, pivots) == 0)
+			return Mat<Line, 1>();
+
+		float	x[Line]{};
+		for (unsigned i{ 0 }; i < Line; ++i)
+			x[i] = b(pivots[i]);
+		LUSolve_IMPL(lu, x);
+
+		Mat<Line, 1>	result;
+		for (unsigned i{ 0 }; i < Line; ++i)
+			result(i) = x[i];
+		return result;
+	}
+
+	template<unsigned Line, unsigned Column>
+	FORCEINLINE constexpr void Mat<Line, Column>::LUSolve_IMPL(const Mat<Line, Column>& lu, float (&b)[Line]) noexcept
+	{
+		// Forward substitution with L, then back substitution with U
+		for (unsigned i{ 1 }, j{ 0 }; i < Line; ++i)
+			for (j = 0; j < i; ++j)
+				b[i] -= lu(i, j) * b[j];
+
+		for (unsigned i{ Line }, j{ 0 }; i-- > 0;)
+		{
+			for (j = i + 1; j < Line; ++j)
+				b[i] -= lu(i, j) * b[j];
+			b[i] /= lu(i, i);
+		}
+	}
+
+	template<unsigned Line, unsigned Column>
+	FORCEINLINE constexpr bool Mat<Line, Column>::LUInversed_IMPL(Mat<Line, Column>& result) const noexcept
+	{
+		Mat<Line, Column>	lu;
+		unsigned			pivots[Line]{};
+		if (LUDecomposition(lu, pivots) == 0)
+			return false;
+
+		float	column[Line]{};
+		for (unsigned c{ 0 }, i{ 0 }; c < Column; ++c)
+		{
+			for (i = 0; i < Line; ++i)
+				column[i] = pivots[i] == c ? 1.f : 0.f;
+			LUSolve_IMPL(lu, column);
+			for (i = 0; i < Line; ++i)
+				result(i, c) = column[i];
+		}
+		return true;
 	}
 
 	template<unsigned Line, unsigned Column>
@@ -931,24 +1074,6 @@ namespace Maths
 					return true;
 		return false;
 	}
-	
-	template<unsigned Line, unsigned Column>
-	inline constexpr Mat<Line, Column> Maths::Mat<Line, Column>::operator=(const Mat<Line, Column>& m) noexcept
-	{
-		for (unsigned i{ 0 }, j{ 0 }; i < Line; ++i)
-			for (j = 0; j < Column; ++j)
-				Get(i, j) = m(i, j);
-
-		return *this;
-	}
-	
-	template<unsigned Line, unsigned Column>
-	inline constexpr Mat<Line, Column> Mat<Line, Column>::operator=(Mat<Line, Column>&& m) noexcept
-	{
-		for (unsigned i{ 0 }; i < Line * Column; ++i)
-			array[i] = std::move(m.array[i]);
-		return *this;
-	}
 }
 
 
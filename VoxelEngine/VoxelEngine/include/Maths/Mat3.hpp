@@ -0,0 +1,251 @@
+#ifndef __MAT3__
+#define __MAT3__
+
+#include "Maths/MathMinimal.h"
+
+#include <type_traits>
+
+#include "Maths/Mat.hpp"
+#include "Maths/Mat4.hpp"
+#include "Maths/Vec3.hpp"
+#include "Maths/Quaternion.hpp"
+
+namespace Maths
+{
+	/**
+	 * Matrix class with predefined size of 3 by 3, for rotations, scales
+	 * and normal matrices. Its determinant and inverse are computed in
+	 * closed form from the cross products of its lines
+	 */
+	struct Mat3
+	{
+		union
+		{
+			float		array[9];
+			float		m_mat[3][3];
+			Mat<3, 3>	mat;
+		};
+
+		/**
+		 * Generates matrix zero
+		 */
+		inline constexpr			Mat3() noexcept : array() {}
+
+		/**
+		 * Creates a copy of given matrix
+		 * @param m: Matrix to be copied
+		 */
+		inline constexpr			Mat3(const Mat3& m) noexcept = default;
+
+		/**
+		 * Moves given matrix to new matrix
+		 * @param m: Matrix to be moved
+		 */
+		inline constexpr			Mat3(Mat3&& m) noexcept = default;
+
+		/**
+		 * Creates a copy of given templated matrix
+		 * @param m: Templated matrix to be copied
+		 */
+		inline constexpr			Mat3(const Mat<3, 3>& m) noexcept : array()
+		{
+			for (unsigned i{ 0 }; i < 9; ++i)
+				array[i] = m.array[i];
+		}
+
+		/**
+		 * Creates a matrix from its three lines
+		 * @param l0: First line of the matrix
+		 * @param l1: Second line of the matrix
+		 * @param l2: Third line of the matrix
+		 */
+		inline constexpr			Mat3(const Vec3& l0, const Vec3& l1, const Vec3& l2) noexcept
+			: array{ l0.x, l0.y, l0.z, l1.x, l1.y, l1.z, l2.x, l2.y, l2.z }
+		{
+		}
+
+		/**
+		 * Extracts the upper left 3 by 3 block of a 4 by 4 matrix,
+		 * its rotation and scale
+		 * @param m: Matrix to extract the block from
+		 */
+		inline constexpr explicit	Mat3(const Mat4& m) noexcept
+			: array{ m.Get(0, 0), m.Get(0, 1), m.Get(0, 2),
+					 m.Get(1, 0), m.Get(1, 1), m.Get(1, 2),
+					 m.Get(2, 0), m.Get(2, 1), m.Get(2, 2) }
+		{
+		}
+
+		/**
+		 * Computes the rotation matrix of a unit quaternion
+		 * @param q: Quaternion of length one
+		 * @return Rotation matrix of the quaternion
+		 */
+		static inline constexpr Mat3	FromQuaternion(const Quaternion& q) noexcept
+		{
+			return Mat3(Vec3(1.f - 2.f * (q.y * q.y + q.z * q.z), 2.f * (q.x * q.y - q.z * q.w), 2.f * (q.x * q.z + q.w * q.y)),
+						Vec3(2.f * (q.x * q.y + q.w * q.z), 1.f - 2.f * (q.x * q.x + q.z * q.z), 2.f * (q.y * q.z - q.w * q.x)),
+						Vec3(2.f * (q.x * q.z - q.w * q.y), 2.f * (q.y * q.z + q.w * q.x), 1.f - 2.f * (q.x * q.x + q.y * q.y)));
+		}
+
+		/**
+		 * Create Matrix inducing no transformation
+		 * @return Identity Matrix
+		 */
+		static inline constexpr Mat3	Identity() noexcept
+		{
+			return Mat3(Vec3(1.f, 0.f, 0.f), Vec3(0.f, 1.f, 0.f), Vec3(0.f, 0.f, 1.f));
+		}
+
+		inline constexpr Mat3&		operator= (const Mat3& m) noexcept = default;
+		inline constexpr Mat3&		operator= (Mat3&& m) noexcept = default;
+
+		/**
+		 * Getter of a value of the matrix
+		 * @param line: Line of the value
+		 * @param column: Column of the value
+		 * @return Value requested
+		 */
+		inline constexpr float		Get(const unsigned line, const unsigned column) const noexcept
+		{
+			return array[line * 3 + column];
+		}
+
+		/**
+		 * Setter of a value of the matrix
+		 * @param line: Line of the value
+		 * @param column: Column of the value
+		 * @param f: Value to be set
+		 */
+		inline constexpr void		Set(const unsigned line, const unsigned column, const float f) noexcept
+		{
+			array[line * 3 + column] = f;
+		}
+
+		/**
+		 * Getter of a line of the matrix
+		 * @param line: Line requested
+		 * @return Copy of the line
+		 */
+		inline constexpr Vec3		Line(const unsigned line) const noexcept
+		{
+			return Vec3(array[line * 3], array[line * 3 + 1], array[line * 3 + 2]);
+		}
+
+		/**
+		 * Computes the determinant of the matrix
+		 * @return Determinant of the matrix
+		 */
+		inline constexpr float		Det() const noexcept
+		{
+			return Line(0).Dot(Line(1).Cross(Line(2)));
+		}
+
+		/**
+		 * Computes the cofactor matrix, whose lines are the cross products of
+		 * the other two lines. It equals the inverse transposed times the determinant
+		 * @return Cofactor matrix
+		 */
+		inline constexpr Mat3		Cofactor() const noexcept
+		{
+			const Vec3	l0{ Line(0) }, l1{ Line(1) }, l2{ Line(2) };
+			return Mat3(l1.Cross(l2), l2.Cross(l0), l0.Cross(l1));
+		}
+
+		/**
+		 * Computes the transposed version of the matrix
+		 * @return Transposed matrix
+		 */
+		inline constexpr Mat3		Transposed() const noexcept
+		{
+			Mat3	m;
+			for (unsigned l{ 0 }; l < 3; ++l)
+				for (unsigned c{ 0 }; c < 3; ++c)
+					m.Set(l, c, Get(c, l));
+			return m;
+		}
+
+		/**
+		 * Computes the inverse of the matrix, which must not be singular
+		 * @return Inversed matrix
+		 */
+		inline constexpr Mat3		Inversed() const noexcept
+		{
+			const Mat3	cof{ Cofactor() };
+			const float	rDet{ 1.f / Line(0).Dot(cof.Line(0)) };
+			Mat3		m;
+			for (unsigned l{ 0 }; l < 3; ++l)
+				for (unsigned c{ 0 }; c < 3; ++c)
+					m.Set(l, c, cof.Get(c, l) * rDet);
+			return m;
+		}
+
+		/**
+		 * Multiplies two matrices
+		 * @param m: Matrix to multiply current matrix with
+		 * @return Product of the two matrices
+		 */
+		inline constexpr Mat3		operator* (const Mat3& m) const noexcept
+		{
+			Mat3	result;
+			for (unsigned l{ 0 }; l < 3; ++l)
+				for (unsigned c{ 0 }; c < 3; ++c)
+					result.Set(l, c, Get(l, 0) * m.Get(0, c) + Get(l, 1) * m.Get(1, c) + Get(l, 2) * m.Get(2, c));
+			return result;
+		}
+
+		/**
+		 * Transforms a vector by the matrix
+		 * @param v: Vector to transform
+		 * @return Transformed vector
+		 */
+		inline constexpr Vec3		operator* (const Vec3& v) const noexcept
+		{
+			return Vec3(Line(0).Dot(v), Line(1).Dot(v), Line(2).Dot(v));
+		}
+
+		/**
+		 * Builds the 4 by 4 matrix with the current matrix as its
+		 * upper left block and no translation
+		 * @return 4 by 4 matrix
+		 */
+		inline constexpr Mat4		ToMat4() const noexcept
+		{
+			Mat4	m;
+			for (unsigned l{ 0 }; l < 3; ++l)
+				for (unsigned c{ 0 }; c < 3; ++c)
+					m.Set(l, c, Get(l, c));
+			m.Set(3, 3, 1.f);
+			return m;
+		}
+
+		/**
+		 * Computes the quaternion of the rotation matrix
+		 * @return Quaternion of the rotation
+		 */
+		inline Quaternion			ToQuaternion() const noexcept
+		{
+			return Quaternion(ToMat4());
+		}
+	};
+
+	/**
+	 * Computes the matrix transforming the normals of a model matrix, with the
+	 * direction of its inverse transposed. The cofactor of the upper left block
+	 * is used instead of the inverse: the normals only need to be renormalized,
+	 * so the division by the determinant is replaced by its sign
+	 * @param model: Matrix transforming the positions
+	 * @return Normal matrix, not normalized
+	 */
+	inline constexpr Mat3	NormalMatrix(const Mat4& model) noexcept
+	{
+		const Mat3	m{ model };
+		Mat3		cof{ m.Cofactor() };
+		if (m.Line(0).Dot(cof.Line(0)) < 0.f)
+			for (float& f : cof.array)
+				f = -f;
+		return cof;
+	}
+}
+
+#endif
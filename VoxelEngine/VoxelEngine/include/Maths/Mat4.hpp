@@ -5,6 +5,9 @@
 
 #include "Mat.hpp"
 #include "Vec4.hpp"
+#include "Simd.hpp"
+
+#include <span>
 
 namespace Maths
 {
@@ -33,7 +36,7 @@ namespace Maths
 		 * Creates a copy of given matrix
 		 * @param m: Matrix to be copied
 		 */
-		inline constexpr			Mat4(const Mat4& m) noexcept;
+		inline constexpr			Mat4(const Mat4& m) noexcept = default;
 
 		/**
 		 * Creates a copy of given templated matrix
@@ -45,7 +48,7 @@ namespace Maths
 		 * Moves given matrix to new matrix
 		 * @param m: Matrix to be moved
 		 */
-		inline constexpr			Mat4(const Mat4&& m) noexcept;
+		inline constexpr			Mat4(Mat4&& m) noexcept = default;
 
 		/**
 		 * Moves given templated matrix to new matrix
@@ -62,13 +65,21 @@ namespace Maths
 		/**
 		 * Copies a templated matrix into current matrix
 		 * @param m: Templated matrix to be copied
+		 * @return Reference to the current matrix
 		 */
-		inline constexpr Mat4		operator= (const Mat<4, 4> & m) noexcept;
+		inline constexpr Mat4&		operator= (const Mat<4, 4> & m) noexcept;
 		/**
 		 * Copies a matrix into current matrix
 		 * @param m: Matrix to be copied
+		 * @return Reference to the current matrix
 		 */
-		inline constexpr Mat4		operator= (const Mat4 & m) noexcept;
+		inline constexpr Mat4&		operator= (const Mat4 & m) noexcept = default;
+		/**
+		 * Moves a matrix into current matrix
+		 * @param m: Matrix to be moved
+		 * @return Reference to the current matrix
+		 */
+		inline constexpr Mat4&		operator= (Mat4 && m) noexcept = default;
 
 
 		// Getters and setters
@@ -281,6 +292,123 @@ namespace Maths
 			requires Mat4MultVarMat<Line>
 		//template <unsigned Line, unsigned Column, typename = std::enable_if_t<Line == 4>>
 		inline Mat<4, Column>	operator* (const Mat<Line, Column>& m) const noexcept;
+
+		// Batched transforms
+		/**
+		 * Transforms the given points in place, as if their w component was 1.
+		 * The results are not divided by w
+		 * @param points: Points to transform
+		 */
+		inline void				TransformPoints(std::span<Vec3> points) const noexcept;
+		/**
+		 * Transforms the given points, as if their w component was 1.
+		 * The results are not divided by w
+		 * @param points: Points to transform
+		 * @param result: Span receiving the transformed points, must be as big as points.
+		 * It may be points itself, but must not partially overlap it
+		 */
+		inline void				TransformPoints(std::span<const Vec3> points, std::span<Vec3> result) const noexcept;
+		/**
+		 * Transforms the given vectors in place, w included
+		 * @param vectors: Vectors to transform
+		 */
+		inline void				TransformPoints(std::span<Vec4> vectors) const noexcept;
+		/**
+		 * Transforms the given vectors, w included
+		 * @param vectors: Vectors to transform
+		 * @param result: Span receiving the transformed vectors, must be as big as vectors.
+		 * It may be vectors itself, but must not partially overlap it
+		 */
+		inline void				TransformPoints(std::span<const Vec4> vectors, std::span<Vec4> result) const noexcept;
+		/**
+		 * Transforms the given points in place, stored as separate x, y and z arrays
+		 * @param x: X components of the points
+		 * @param y: Y components of the points
+		 * @param z: Z components of the points
+		 * @param count: Number of points to transform
+		 */
+		inline void				TransformPoints(float* x, float* y, float* z, size_t count) const noexcept;
+		/**
+		 * Transforms the given points, stored as separate x, y and z arrays
+		 * @param x: X components of the points
+		 * @param y: Y components of the points
+		 * @param z: Z components of the points
+		 * @param outX: X components of the results, may be x itself
+		 * @param outY: Y components of the results, may be y itself
+		 * @param outZ: Z components of the results, may be z itself
+		 * @param count: Number of points to transform
+		 */
+		inline void				TransformPoints(const float* x, const float* y, const float* z,
+									float* outX, float* outY, float* outZ, size_t count) const noexcept;
+		/**
+		 * Transforms the given directions in place, as if their w component was 0.
+		 * The translation of the matrix is not applied
+		 * @param directions: Directions to transform
+		 */
+		inline void				TransformDirections(std::span<Vec3> directions) const noexcept;
+		/**
+		 * Transforms the given directions, as if their w component was 0.
+		 * The translation of the matrix is not applied
+		 * @param directions: Directions to transform
+		 * @param result: Span receiving the transformed directions, must be as big as directions.
+		 * It may be directions itself, but must not partially overlap it
+		 */
+		inline void				TransformDirections(std::span<const Vec3> directions, std::span<Vec3> result) const noexcept;
+		/**
+		 * Transforms the given vectors in place, ignoring their w component
+		 * and taking it as 0
+		 * @param directions: Directions to transform
+		 */
+		inline void				TransformDirections(std::span<Vec4> directions) const noexcept;
+		/**
+		 * Transforms the given vectors, ignoring their w component
+		 * and taking it as 0
+		 * @param directions: Directions to transform
+		 * @param result: Span receiving the transformed directions, must be as big as directions.
+		 * It may be directions itself, but must not partially overlap it
+		 */
+		inline void				TransformDirections(std::span<const Vec4> directions, std::span<Vec4> result) const noexcept;
+		/**
+		 * Transforms the given directions in place, stored as separate x, y and z arrays
+		 * @param x: X components of the directions
+		 * @param y: Y components of the directions
+		 * @param z: Z components of the directions
+		 * @param count: Number of directions to transform
+		 */
+		inline void				TransformDirections(float* x, float* y, float* z, size_t count) const noexcept;
+		/**
+		 * Transforms the given directions, stored as separate x, y and z arrays
+		 * @param x: X components of the directions
+		 * @param y: Y components of the directions
+		 * @param z: Z components of the directions
+		 * @param outX: X components of the results, may be x itself
+		 * @param outY: Y components of the results, may be y itself
+		 * @param outZ: Z components of the results, may be z itself
+		 * @param count: Number of directions to transform
+		 */
+		inline void				TransformDirections(const float* x, const float* y, const float* z,
+									float* outX, float* outY, float* outZ, size_t count) const noexcept;
+	protected:
+		/**
+		 * Implementation of the Vec3 batched transforms,
+		 * private member you're not supposed to use.
+		 * @param w: Implicit w component of the vectors
+		 */
+		inline void				TransformVec3_IMPL(const Vec3* v, Vec3* result, size_t count, float w) const noexcept;
+		/**
+		 * Implementation of the Vec4 batched transforms,
+		 * private member you're not supposed to use.
+		 * @param directions: Whether the w component is taken as 0
+		 */
+		inline void				TransformVec4_IMPL(const Vec4* v, Vec4* result, size_t count, bool directions) const noexcept;
+		/**
+		 * Implementation of the SoA batched transforms,
+		 * private member you're not supposed to use.
+		 * @param w: Implicit w component of the vectors
+		 */
+		inline void				TransformSoA_IMPL(const float* x, const float* y, const float* z,
+									float* outX, float* outY, float* outZ, size_t count, float w) const noexcept;
+	public:
 		
 		/**
 		 * Inverses current matrix
@@ -292,6 +420,22 @@ namespace Maths
 		 */
 		inline constexpr Mat4				Inversed() const noexcept;
 
+		/**
+		 * Computes the inverse of the current matrix, assuming it is affine
+		 * (last line being 0 0 0 1). Only inverses the 3x3 block and
+		 * applies it to the opposite of the translation
+		 * @return Inverse of current matrix
+		 */
+		inline constexpr Mat4				InversedAffine() const noexcept;
+
+		/**
+		 * Computes the inverse of the current matrix, assuming it is affine
+		 * and that its 3x3 block is orthonormal (rotation without scale).
+		 * The 3x3 block is simply transposed
+		 * @return Inverse of current matrix
+		 */
+		inline constexpr Mat4				InversedOrthonormal() const noexcept;
+
 		/**
 		 * Computes the determinant of the current matrix
 		 * @return Determinant of current matrix
@@ -320,38 +464,19 @@ namespace Maths
 		}
 	};
 
-	constexpr Maths::Mat4::Mat4(const Mat4& m) noexcept : array()
-	{
-		for (unsigned i{ 0 }; i < 16; ++i)
-			array[i] = m.array[i];
-	}
-	
 	constexpr Maths::Mat4::Mat4(const Mat<4, 4> & m) noexcept : array()
 	{
 		for (unsigned i{ 0 }; i < 16; ++i)
 			array[i] = m.array[i];
 	}
 
-	constexpr Mat4 Maths::Mat4::operator=(const Mat<4, 4>& m) noexcept
+	constexpr Mat4& Maths::Mat4::operator=(const Mat<4, 4>& m) noexcept
 	{
 		for (unsigned i{ 0 }; i < 16; ++i)
 			array[i] = m.array[i];
 		return *this;
 	}
 
-	constexpr Mat4 Maths::Mat4::operator=(const Mat4& m) noexcept
-	{
-		for (unsigned i{ 0 }; i < 16; ++i)
-			array[i] = m.array[i];
-		return *this;
-	}
-
-	constexpr Mat4::Mat4(const Mat4&& m) noexcept : array()
-	{
-		for (unsigned i{ 0 }; i < 16; ++i)
-			array[i] = std::move(m.array[i]);
-	}
-
 	constexpr Mat4::Mat4(const Mat<4, 4>&& m) noexcept : array()
 	{
 		for (unsigned i{ 0 }; i < 16; ++i)
@@ -497,6 +622,13 @@ namespace Maths
 	constexpr Mat4 Mat4::operator*(const Mat4& m) const noexcept
 	{
 		Mat4 result{};
+#if MATHS_SSE
+		if (!std::is_constant_evaluated())
+		{
+			Simd::Mat4Multiply(array, m.array, result.array);
+			return result;
+		}
+#endif
 
 		result.Set<0, 0>(Get<0, 0>() * m.Get<0, 0>() +
 			Get<0, 1>() * m.Get<1, 0>() +
@@ -568,78 +700,20 @@ namespace Maths
 
 	constexpr Mat4& Mat4::operator*=(const Mat4& m) noexcept
 	{
-		Mat4 result{};
-		result.Set<0, 0>(Get<0, 0>() * m.Get<0, 0>() +
-			Get<0, 1>() * m.Get<1, 0>() +
-			Get<0, 2>() * m.Get<2, 0>() +
-			Get<0, 3>() * m.Get<3, 0>());
-		result.Set<0, 1>(Get<0, 0>() * m.Get<0, 1>() +
-			Get<0, 1>() * m.Get<1, 1>() +
-			Get<0, 2>() * m.Get<2, 1>() +
-			Get<0, 3>() * m.Get<3, 1>());
-		result.Set<0, 2>(Get<0, 0>() * m.Get<0, 2>() +
-			Get<0, 1>() * m.Get<1, 2>() +
-			Get<0, 2>() * m.Get<2, 2>() +
-			Get<0, 3>() * m.Get<3, 2>());
-		result.Set<0, 3>(Get<0, 0>() * m.Get<0, 3>() +
-			Get<0, 1>() * m.Get<1, 3>() +
-			Get<0, 2>() * m.Get<2, 3>() +
-			Get<0, 3>() * m.Get<3, 3>());
-		result.Set<1, 0>(Get<1, 0>() * m.Get<0, 0>() +
-			Get<1, 1>() * m.Get<1, 0>() +
-			Get<1, 2>() * m.Get<2, 0>() +
-			Get<1, 3>() * m.Get<3, 0>());
-		result.Set<1, 1>(Get<1, 0>() * m.Get<0, 1>() +
-			Get<1, 1>() * m.Get<1, 1>() +
-			Get<1, 2>() * m.Get<2, 1>() +
-			Get<1, 3>() * m.Get<3, 1>());
-		result.Set<1, 2>(Get<1, 0>() * m.Get<0, 2>() +
-			Get<1, 1>() * m.Get<1, 2>() +
-			Get<1, 2>() * m.Get<2, 2>() +
-			Get<1, 3>() * m.Get<3, 2>());
-		result.Set<1, 3>(Get<1, 0>() * m.Get<0, 3>() +
-			Get<1, 1>() * m.Get<1, 3>() +
-			Get<1, 2>() * m.Get<2, 3>() +
-			Get<1, 3>() * m.Get<3, 3>());
-		result.Set<2, 0>(Get<2, 0>() * m.Get<0, 0>() +
-			Get<2, 1>() * m.Get<1, 0>() +
-			Get<2, 2>() * m.Get<2, 0>() +
-			Get<2, 3>() * m.Get<3, 0>());
-		result.Set<2, 1>(Get<2, 0>() * m.Get<0, 1>() +
-			Get<2, 1>() * m.Get<1, 1>() +
-			Get<2, 2>() * m.Get<2, 1>() +
-			Get<2, 3>() * m.Get<3, 1>());
-		result.Set<2, 2>(Get<2, 0>() * m.Get<0, 2>() +
-			Get<2, 1>() * m.Get<1, 2>() +
-			Get<2, 2>() * m.Get<2, 2>() +
-			Get<2, 3>() * m.Get<3, 2>());
-		result.Set<2, 3>(Get<2, 0>() * m.Get<0, 3>() +
-			Get<2, 1>() * m.Get<1, 3>() +
-			Get<2, 2>() * m.Get<2, 3>() +
-			Get<2, 3>() * m.Get<3, 3>());
-		result.Set<3, 0>(Get<3, 0>() * m.Get<0, 0>() +
-			Get<3, 1>() * m.Get<1, 0>() +
-			Get<3, 2>() * m.Get<2, 0>() +
-			Get<3, 3>() * m.Get<3, 0>());
-		result.Set<3, 1>(Get<3, 0>() * m.Get<0, 1>() +
-			Get<3, 1>() * m.Get<1, 1>() +
-			Get<3, 2>() * m.Get<2, 1>() +
-			Get<3, 3>() * m.Get<3, 1>());
-		result.Set<3, 2>(Get<3, 0>() * m.Get<0, 2>() +
-			Get<3, 1>() * m.Get<1, 2>() +
-			Get<3, 2>() * m.Get<2, 2>() +
-			Get<3, 3>() * m.Get<3, 2>());
-		result.Set<3, 3>(Get<3, 0>() * m.Get<0, 3>() +
-			Get<3, 1>() * m.Get<1, 3>() +
-			Get<3, 2>() * m.Get<2, 3>() +
-			Get<3, 3>() * m.Get<3, 3>());
-		*this = result;
+		*this = *this * m;
 		return *this;
 	}
 
 	constexpr Mat4 Mat4::operator*(const Mat<4, 4>& m) const noexcept
 	{
 		Mat4 result{};
+#if MATHS_SSE
+		if (!std::is_constant_evaluated())
+		{
+			Simd::Mat4Multiply(array, m.array, result.array);
+			return result;
+		}
+#endif
 
 		result.Set<0, 0>(Get<0, 0>() * m.Get<0, 0>() +
 			Get<0, 1>() * m.Get<1, 0>() +
@@ -711,80 +785,20 @@ namespace Maths
 
 	constexpr Mat4& Mat4::operator*=(const Mat<4, 4>& m) noexcept
 	{
-		Mat4 result{};
-
-		result.Set<0, 0>(Get<0, 0>() * m.Get<0, 0>() +
-			Get<0, 1>() * m.Get<1, 0>() +
-			Get<0, 2>() * m.Get<2, 0>() +
-			Get<0, 3>() * m.Get<3, 0>());
-		result.Set<0, 1>(Get<0, 0>() * m.Get<0, 1>() +
-			Get<0, 1>() * m.Get<1, 1>() +
-			Get<0, 2>() * m.Get<2, 1>() +
-			Get<0, 3>() * m.Get<3, 1>());
-		result.Set<0, 2>(Get<0, 0>() * m.Get<0, 2>() +
-			Get<0, 1>() * m.Get<1, 2>() +
-			Get<0, 2>() * m.Get<2, 2>() +
-			Get<0, 3>() * m.Get<3, 2>());
-		result.Set<0, 3>(Get<0, 0>() * m.Get<0, 3>() +
-			Get<0, 1>() * m.Get<1, 3>() +
-			Get<0, 2>() * m.Get<2, 3>() +
-			Get<0, 3>() * m.Get<3, 3>());
-		result.Set<1, 0>(Get<1, 0>() * m.Get<0, 0>() +
-			Get<1, 1>() * m.Get<1, 0>() +
-			Get<1, 2>() * m.Get<2, 0>() +
-			Get<1, 3>() * m.Get<3, 0>());
-		result.Set<1, 1>(Get<1, 0>() * m.Get<0, 1>() +
-			Get<1, 1>() * m.Get<1, 1>() +
-			Get<1, 2>() * m.Get<2, 1>() +
-			Get<1, 3>() * m.Get<3, 1>());
-		result.Set<1, 2>(Get<1, 0>() * m.Get<0, 2>() +
-			Get<1, 1>() * m.Get<1, 2>() +
-			Get<1, 2>() * m.Get<2, 2>() +
-			Get<1, 3>() * m.Get<3, 2>());
-		result.Set<1, 3>(Get<1, 0>() * m.Get<0, 3>() +
-			Get<1, 1>() * m.Get<1, 3>() +
-			Get<1, 2>() * m.Get<2, 3>() +
-			Get<1, 3>() * m.Get<3, 3>());
-		result.Set<2, 0>(Get<2, 0>() * m.Get<0, 0>() +
-			Get<2, 1>() * m.Get<1, 0>() +
-			Get<2, 2>() * m.Get<2, 0>() +
-			Get<2, 3>() * m.Get<3, 0>());
-		result.Set<2, 1>(Get<2, 0>() * m.Get<0, 1>() +
-			Get<2, 1>() * m.Get<1, 1>() +
-			Get<2, 2>() * m.Get<2, 1>() +
-			Get<2, 3>() * m.Get<3, 1>());
-		result.Set<2, 2>(Get<2, 0>() * m.Get<0, 2>() +
-			Get<2, 1>() * m.Get<1, 2>() +
-			Get<2, 2>() * m.Get<2, 2>() +
-			Get<2, 3>() * m.Get<3, 2>());
-		result.Set<2, 3>(Get<2, 0>() * m.Get<0, 3>() +
-			Get<2, 1>() * m.Get<1, 3>() +
-			Get<2, 2>() * m.Get<2, 3>() +
-			Get<2, 3>() * m.Get<3, 3>());
-		result.Set<3, 0>(Get<3, 0>() * m.Get<0, 0>() +
-			Get<3, 1>() * m.Get<1, 0>() +
-			Get<3, 2>() * m.Get<2, 0>() +
-			Get<3, 3>() * m.Get<3, 0>());
-		result.Set<3, 1>(Get<3, 0>() * m.Get<0, 1>() +
-			Get<3, 1>() * m.Get<1, 1>() +
-			Get<3, 2>() * m.Get<2, 1>() +
-			Get<3, 3>() * m.Get<3, 1>());
-		result.Set<3, 2>(Get<3, 0>() * m.Get<0, 2>() +
-			Get<3, 1>() * m.Get<1, 2>() +
-			Get<3, 2>() * m.Get<2, 2>() +
-			Get<3, 3>() * m.Get<3, 2>());
-		result.Set<3, 3>(Get<3, 0>() * m.Get<0, 3>() +
-			Get<3, 1>() * m.Get<1, 3>() +
-			Get<3, 2>() * m.Get<2, 3>() +
-			Get<3, 3>() * m.Get<3, 3>());
-
-		*this = result;
+		*this = *this * m;
 		return *this;
 	}
 
 	inline constexpr Vec<4> Mat4::operator*(const Vec<4> & v) const noexcept
 	{
 		Vec<4>	result;
+#if MATHS_SSE
+		if (!std::is_constant_evaluated())
+		{
+			Simd::Mat4MultiplyVec4(array, v.m_vec, result.m_vec);
+			return result;
+		}
+#endif
 
 		result[0] = Get<0, 0>() * v[0] + Get<0, 1>() * v[1] +
 			Get<0, 2>() * v[2] + Get<0, 3>() * v[3];
@@ -801,6 +815,13 @@ namespace Maths
 	inline constexpr Vec4 Mat4::operator*(const Vec4& v) const noexcept
 	{
 		Vec4	result;
+#if MATHS_SSE
+		if (!std::is_constant_evaluated())
+		{
+			Simd::Mat4MultiplyVec4(array, v.xyzw, result.xyzw);
+			return result;
+		}
+#endif
 
 		result.x = Get<0, 0>() * v.x + Get<0, 1>() * v.y +
 			Get<0, 2>() * v.z + Get<0, 3>() * v.w;
@@ -835,6 +856,113 @@ namespace Maths
 		return result;
 	}
 
+	inline void	Mat4::TransformPoints(std::span<Vec3> points) const noexcept
+	{
+		TransformVec3_IMPL(points.data(), points.data(), points.size(), 1.f);
+	}
+
+	inline void	Mat4::TransformPoints(std::span<const Vec3> points, std::span<Vec3> result) const noexcept
+	{
+		TransformVec3_IMPL(points.data(), result.data(), points.size(), 1.f);
+	}
+
+	inline void	Mat4::TransformPoints(std::span<Vec4> vectors) const noexcept
+	{
+		TransformVec4_IMPL(vectors.data(), vectors.data(), vectors.size(), false);
+	}
+
+	inline void	Mat4::TransformPoints(std::span<const Vec4> vectors, std::span<Vec4> result) const noexcept
+	{
+		TransformVec4_IMPL(vectors.data(), result.data(), vectors.size(), false);
+	}
+
+	inline void	Mat4::TransformPoints(float* x, float* y, float* z, size_t count) const noexcept
+	{
+		TransformSoA_IMPL(x, y, z, x, y, z, count, 1.f);
+	}
+
+	inline void	Mat4::TransformPoints(const float* x, const float* y, const float* z,
+		float* outX, float* outY, float* outZ, size_t count) const noexcept
+	{
+		TransformSoA_IMPL(x, y, z, outX, outY, outZ, count, 1.f);
+	}
+
+	inline void	Mat4::TransformDirections(std::span<Vec3> directions) const noexcept
+	{
+		TransformVec3_IMPL(directions.data(), directions.data(), directions.size(), 0.f);
+	}
+
+	inline void	Mat4::TransformDirections(std::span<const Vec3> directions, std::span<Vec3> result) const noexcept
+	{
+		TransformVec3_IMPL(directions.data(), result.data(), directions.size(), 0.f);
+	}
+
+	inline void	Mat4::TransformDirections(std::span<Vec4> directions) const noexcept
+	{
+		TransformVec4_IMPL(directions.data(), directions.data(), directions.size(), true);
+	}
+
+	inline void	Mat4::TransformDirections(std::span<const Vec4> directions, std::span<Vec4> result) const noexcept
+	{
+		TransformVec4_IMPL(directions.data(), result.data(), directions.size(), true);
+	}
+
+	inline void	Mat4::TransformDirections(float* x, float* y, float* z, size_t count) const noexcept
+	{
+		TransformSoA_IMPL(x, y, z, x, y, z, count, 0.f);
+	}
+
+	inline void	Mat4::TransformDirections(const float* x, const float* y, const float* z,
+		float* outX, float* outY, float* outZ, size_t count) const noexcept
+	{
+		TransformSoA_IMPL(x, y, z, outX, outY, outZ, count, 0.f);
+	}
+
+	inline void	Mat4::TransformVec3_IMPL(const Vec3* v, Vec3* result, size_t count, float w) const noexcept
+	{
+#if MATHS_SSE
+		// Cast without dereferencing, the pointers are null for empty spans
+		Simd::TransformVec3(array, reinterpret_cast<const float*>(v), reinterpret_cast<float*>(result), count, w);
+#else
+		for (size_t i{ 0 }; i < count; ++i)
+		{
+			const Vec3	vec{ v[i] };
+			result[i].x = Get<0, 0>() * vec.x + Get<0, 1>() * vec.y + Get<0, 2>() * vec.z + Get<0, 3>() * w;
+			result[i].y = Get<1, 0>() * vec.x + Get<1, 1>() * vec.y + Get<1, 2>() * vec.z + Get<1, 3>() * w;
+			result[i].z = Get<2, 0>() * vec.x + Get<2, 1>() * vec.y + Get<2, 2>() * vec.z + Get<2, 3>() * w;
+		}
+#endif
+	}
+
+	inline void	Mat4::TransformVec4_IMPL(const Vec4* v, Vec4* result, size_t count, bool directions) const noexcept
+	{
+#if MATHS_SSE
+		Simd::TransformVec4(array, reinterpret_cast<const float*>(v), reinterpret_cast<float*>(result), count, directions);
+#else
+		for (size_t i{ 0 }; i < count; ++i)
+		{
+			const Vec4	vec{ v[i].x, v[i].y, v[i].z, directions ? 0.f : v[i].w };
+			result[i] = *this * vec;
+		}
+#endif
+	}
+
+	inline void	Mat4::TransformSoA_IMPL(const float* x, const float* y, const float* z,
+		float* outX, float* outY, float* outZ, size_t count, float w) const noexcept
+	{
+#if MATHS_SSE
+		Simd::TransformSoA(array, x, y, z, outX, outY, outZ, count, w);
+#else
+		for (size_t i{ 0 }; i < count; ++i)
+		{
+			const float	vx{ x[i] }, vy{ y[i] }, vz{ z[i] };
+			outX[i] = Get<0, 0>() * vx + Get<0, 1>() * vy + Get<0, 2>() * vz + Get<0, 3>() * w;
+			outY[i] = Get<1, 0>() * vx + Get<1, 1>() * vy + Get<1, 2>() * vz + Get<1, 3>() * w;
+			outZ[i] = Get<2, 0>() * vx + Get<2, 1>() * vy + Get<2, 2>() * vz + Get<2, 3>() * w;
+		}
+#endif
+	}
+
 	constexpr float	Mat4::Det() const noexcept
 	{
 		float temp0{ Get<2, 2>() * Get<3, 3>() - Get<2, 3>() * Get<3, 2>() };
@@ -852,6 +980,13 @@ namespace Maths
 	constexpr Mat4	Mat4::Inversed() const noexcept
 	{
 		Mat4 result;
+#if MATHS_SSE
+		if (!std::is_constant_evaluated())
+		{
+			Simd::Mat4Inverse(array, result.array);
+			return result;
+		}
+#endif
 		float temp0{ Get<2, 2>() * Get<3, 3>() - Get<2, 3>() * Get<3, 2>() };
 		float temp1{ Get<1, 2>() * Get<3, 3>() - Get<1, 3>() * Get<3, 2>() };
 		float temp2{ Get<1, 2>() * Get<2, 3>() - Get<1, 3>() * Get<2, 2>() };
@@ -903,6 +1038,47 @@ namespace Maths
 		return result;
 	}
 
+	constexpr Mat4	Mat4::InversedAffine() const noexcept
+	{
+		Mat4 result;
+
+		const float	cof00{ Get<1, 1>() * Get<2, 2>() - Get<1, 2>() * Get<2, 1>() };
+		const float	cof01{ Get<1, 2>() * Get<2, 0>() - Get<1, 0>() * Get<2, 2>() };
+		const float	cof02{ Get<1, 0>() * Get<2, 1>() - Get<1, 1>() * Get<2, 0>() };
+		const float	RDet{ 1.f / (Get<0, 0>() * cof00 + Get<0, 1>() * cof01 + Get<0, 2>() * cof02) };
+
+		result.Set<0, 0>(RDet * cof00);
+		result.Set<0, 1>(RDet * (Get<0, 2>() * Get<2, 1>() - Get<0, 1>() * Get<2, 2>()));
+		result.Set<0, 2>(RDet * (Get<0, 1>() * Get<1, 2>() - Get<0, 2>() * Get<1, 1>()));
+		result.Set<1, 0>(RDet * cof01);
+		result.Set<1, 1>(RDet * (Get<0, 0>() * Get<2, 2>() - Get<0, 2>() * Get<2, 0>()));
+		result.Set<1, 2>(RDet * (Get<0, 2>() * Get<1, 0>() - Get<0, 0>() * Get<1, 2>()));
+		result.Set<2, 0>(RDet * cof02);
+		result.Set<2, 1>(RDet * (Get<0, 1>() * Get<2, 0>() - Get<0, 0>() * Get<2, 1>()));
+		result.Set<2, 2>(RDet * (Get<0, 0>() * Get<1, 1>() - Get<0, 1>() * Get<1, 0>()));
+
+		for (unsigned l{ 0 }; l < 3; ++l)
+			result.Set(l, 3, -(result.Get(l, 0) * Get<0, 3>() + result.Get(l, 1) * Get<1, 3>() + result.Get(l, 2) * Get<2, 3>()));
+		result.Set<3, 3>(1);
+
+		return result;
+	}
+
+	constexpr Mat4	Mat4::InversedOrthonormal() const noexcept
+	{
+		Mat4 result;
+
+		for (unsigned l{ 0 }; l < 3; ++l)
+		{
+			for (unsigned c{ 0 }; c < 3; ++c)
+				result.Set(l, c, Get(c, l));
+			result.Set(l, 3, -(Get(0, l) * Get<0, 3>() + Get(1, l) * Get<1, 3>() + Get(2, l) * Get<2, 3>()));
+		}
+		result.Set<3, 3>(1);
+
+		return result;
+	}
+
 	constexpr void	Mat4::Inverse()
 	{
 		*this = Inversed();
@@ -930,6 +1106,8 @@ namespace Maths
 			std::cout << std::endl;
 		}
 	}
+
+	static_assert(BitwiseCopyable<Mat4>);
 }
 
 #endif
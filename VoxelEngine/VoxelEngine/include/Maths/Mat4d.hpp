@@ -0,0 +1,143 @@
+#ifndef __MAT4D__
+#define __MAT4D__
+
+#include "Maths/MathMinimal.h"
+
+#include <type_traits>
+
+#include "Maths/Mat4.hpp"
+#include "Maths/Vec3d.hpp"
+
+namespace Maths
+{
+	/**
+	 * Double precision row major matrix of 4 by 4, for the world space transforms
+	 * of objects far from the origin. Converted to a float Mat4 relative to the
+	 * camera before rendering, see RelativeTo
+	 */
+	struct Mat4d
+	{
+		double	array[16];
+
+		/**
+		 * Generates matrix zero
+		 */
+		inline constexpr			Mat4d() noexcept : array() {}
+
+		/**
+		 * Creates a double matrix from a float matrix
+		 * @param m: Matrix to be converted
+		 */
+		inline constexpr explicit	Mat4d(const Mat4& m) noexcept : array()
+		{
+			for (unsigned i{ 0 }; i < 16; ++i)
+				array[i] = m.array[i];
+		}
+
+		/**
+		 * Create Matrix inducing no transformation
+		 * @return Identity Matrix
+		 */
+		static inline constexpr Mat4d	Identity() noexcept
+		{
+			Mat4d	m;
+			for (unsigned i{ 0 }; i < 4; ++i)
+				m.Set(i, i, 1.0);
+			return m;
+		}
+
+		/**
+		 * Creates a translation matrix
+		 * @param t: Translation of the matrix
+		 * @return Translation matrix
+		 */
+		static inline constexpr Mat4d	Translation(const Vec3d& t) noexcept
+		{
+			Mat4d	m{ Identity() };
+			m.Set(0, 3, t.x);
+			m.Set(1, 3, t.y);
+			m.Set(2, 3, t.z);
+			return m;
+		}
+
+		/**
+		 * Getter of a value of the matrix
+		 * @param line: Line of the value
+		 * @param column: Column of the value
+		 * @return Value requested
+		 */
+		inline constexpr double		Get(const unsigned line, const unsigned column) const noexcept
+		{
+			return array[line * 4 + column];
+		}
+
+		/**
+		 * Setter of a value of the matrix
+		 * @param line: Line of the value
+		 * @param column: Column of the value
+		 * @param d: Value to be set
+		 */
+		inline constexpr void		Set(const unsigned line, const unsigned column, const double d) noexcept
+		{
+			array[line * 4 + column] = d;
+		}
+
+		/**
+		 * Multiplies two matrices
+		 * @param m: Matrix to multiply current matrix with
+		 * @return Product of the two matrices
+		 */
+		inline constexpr Mat4d		operator* (const Mat4d& m) const noexcept
+		{
+			Mat4d	result;
+			for (unsigned line{ 0 }; line < 4; ++line)
+				for (unsigned column{ 0 }; column < 4; ++column)
+				{
+					double	sum{ 0 };
+					for (unsigned k{ 0 }; k < 4; ++k)
+						sum += Get(line, k) * m.Get(k, column);
+					result.Set(line, column, sum);
+				}
+			return result;
+		}
+
+		/**
+		 * Transforms a position by the matrix, with w = 1
+		 * @param p: Position to transform
+		 * @return Transformed position
+		 */
+		inline constexpr Vec3d		TransformPoint(const Vec3d& p) const noexcept
+		{
+			return Vec3d(Get(0, 0) * p.x + Get(0, 1) * p.y + Get(0, 2) * p.z + Get(0, 3),
+						 Get(1, 0) * p.x + Get(1, 1) * p.y + Get(1, 2) * p.z + Get(1, 3),
+						 Get(2, 0) * p.x + Get(2, 1) * p.y + Get(2, 2) * p.z + Get(2, 3));
+		}
+
+		/**
+		 * Computes the float matrix of the transform in a space whose origin is moved
+		 * to the given position. Equivalent to Translation(-origin) * this, the
+		 * substraction being done in double before the conversion
+		 * @param origin: Origin of the render space, usually the camera position
+		 * @return Float matrix relative to origin
+		 */
+		inline constexpr Mat4		RelativeTo(const Vec3d& origin) const noexcept
+		{
+			const double	o[4]{ origin.x, origin.y, origin.z, 0.0 };
+			Mat4	m;
+			for (unsigned line{ 0 }; line < 4; ++line)
+				for (unsigned column{ 0 }; column < 4; ++column)
+					m.array[line * 4 + column] = static_cast<float>(Get(line, column) - o[line] * Get(3, column));
+			return m;
+		}
+
+		/**
+		 * Conversion to a float matrix, losing precision far from the origin
+		 */
+		inline constexpr explicit	operator Mat4() const noexcept
+		{
+			return RelativeTo(Vec3d());
+		}
+	};
+}
+
+#endif
@@ -3,6 +3,8 @@
 #pragma warning(disable : 4201)
 
 #include <cmath>
+#include <type_traits>
+#include <limits>
 
 namespace Maths
 {
@@ -14,6 +16,43 @@ namespace Maths
 	*/
 	template <unsigned Min, unsigned Max, unsigned Val>
 	concept InRange = Val >= Min && Max > Val;
+
+	/*
+	* Types copied as raw bytes, with memcpy, reinterpreted as float arrays by the SIMD batches or uploaded to the GPU
+	*/
+	template <typename T>
+	concept BitwiseCopyable = std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>;
+
+	/*
+	* Squared lengths under this value are taken as zero by the NormalizeSafe functions
+	*/
+	constexpr float NORMALIZE_EPSILON{ std::numeric_limits<float>::min() };
+
+	/*
+	* Integer division rounded toward negative infinity, b must be positive
+	*/
+	constexpr int FloorDiv(const int a, const int b) noexcept
+	{
+		return a / b - (a % b < 0 ? 1 : 0);
+	}
+
+	/*
+	* Remainder of FloorDiv, always between 0 and b - 1
+	*/
+	constexpr int FloorMod(const int a, const int b) noexcept
+	{
+		const int r{ a % b };
+		return r < 0 ? r + b : r;
+	}
+
+	/*
+	* Largest integer lower or equal to f, without the call to std::floor
+	*/
+	constexpr int FloorToInt(const float f) noexcept
+	{
+		const int i{ static_cast<int>(f) };
+		return f < static_cast<float>(i) ? i - 1 : i;
+	}
 }
 
 #ifndef FORCEINLINE
@@ -24,4 +63,22 @@ namespace Maths
 #else
 #define FORCEINLINE inline
 #endif
+#endif
+
+/*
+* SIMD backends of the maths library. Define MATHS_NO_SIMD to force the scalar code
+*/
+#ifndef MATHS_NO_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATHS_SSE 1
+#endif
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define MATHS_AVX2 1
+#endif
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define MATHS_BMI2 1
+#endif
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define MATHS_F16C 1
+#endif
 #endif
\ No newline at end of file
@@ -9,9 +9,28 @@
 #include "Maths/Vec2.hpp"
 #include "Maths/Vec3.hpp"
 #include "Maths/Vec4.hpp"
+#include "Maths/Vec3Stream.hpp"
+#include "Maths/Vec3d.hpp"
+#include "Maths/Mat4d.hpp"
+#include "Maths/IVec2.hpp"
+#include "Maths/IVec3.hpp"
+#include "Maths/ChunkPos.hpp"
+#include "Maths/Morton.hpp"
+#include "Maths/Hilbert.hpp"
+#include "Maths/Frustum.hpp"
+#include "Maths/Aabb.hpp"
+#include "Maths/Sphere.hpp"
+#include "Maths/Plane.hpp"
+#include "Maths/Ray.hpp"
+#include "Maths/Capsule.hpp"
+#include "Maths/Obb.hpp"
+#include "Maths/Intersection.hpp"
+#include "Maths/Noise.hpp"
+#include "Maths/Packing.hpp"
 #include "Maths/Ref.hpp"
 #include "Maths/Ref3D.hpp"
 #include "Maths/Quaternion.hpp"
+#include "Maths/Mat3.hpp"
 #include "Maths/Color.hpp"
 
 constexpr double RAD2DEG = 180.f / M_PI;
@@ -0,0 +1,221 @@
+#ifndef __MORTON__
+#define __MORTON__
+
+#include "Maths/MathMinimal.h"
+
+#include <cstdint>
+#include <type_traits>
+
+#if MATHS_BMI2
+#include <immintrin.h>
+#endif
+
+#include "Maths/IVec3.hpp"
+
+/**
+ * Morton (Z-order) codes, interleaving the bits of the coordinates so that
+ * voxels close in space are close in memory. Bit 3n of a code is bit n of x,
+ * bit 3n + 1 is bit n of y and bit 3n + 2 is bit n of z. 32 bits codes hold
+ * 10 bits per axis, 64 bits codes 21 bits per axis.
+ * The encodings use pdep/pext when MATHS_BMI2 is defined, and shifts and
+ * magic masks otherwise and at compile time. Note that pdep/pext are
+ * microcoded and slower than the masks on AMD processors before Zen 3
+ */
+namespace Maths::Morton
+{
+	// Bits of each axis in a 32 bits code
+	inline constexpr uint32_t	MASK_X32{ 0x09249249u };
+	inline constexpr uint32_t	MASK_Y32{ MASK_X32 << 1 };
+	inline constexpr uint32_t	MASK_Z32{ MASK_X32 << 2 };
+
+	// Bits of each axis in a 64 bits code
+	inline constexpr uint64_t	MASK_X64{ 0x1249249249249249ull };
+	inline constexpr uint64_t	MASK_Y64{ MASK_X64 << 1 };
+	inline constexpr uint64_t	MASK_Z64{ MASK_X64 << 2 };
+
+	/**
+	 * Inserts two zero bits between each of the 10 lower bits of v,
+	 * private function you're not supposed to use
+	 */
+	inline constexpr uint32_t	Spread32_IMPL(uint32_t v) noexcept
+	{
+		v &= 0x000003ffu;
+		v = (v | v << 16) & 0x030000ffu;
+		v = (v | v << 8) & 0x0300f00fu;
+		v = (v | v << 4) & 0x030c30c3u;
+		return (v | v << 2) & MASK_X32;
+	}
+
+	/**
+	 * Inverse of Spread32_IMPL, private function you're not supposed to use
+	 */
+	inline constexpr uint32_t	Compact32_IMPL(uint32_t v) noexcept
+	{
+		v &= MASK_X32;
+		v = (v ^ v >> 2) & 0x030c30c3u;
+		v = (v ^ v >> 4) & 0x0300f00fu;
+		v = (v ^ v >> 8) & 0x030000ffu;
+		return (v ^ v >> 16) & 0x000003ffu;
+	}
+
+	/**
+	 * Inserts two zero bits between each of the 21 lower bits of v,
+	 * private function you're not supposed to use
+	 */
+	inline constexpr uint64_t	Spread64_IMPL(uint64_t v) noexcept
+	{
+		v &= 0x1fffffull;
+		v = (v | v << 32) & 0x001f00000000ffffull;
+		v = (v | v << 16) & 0x001f0000ff0000ffull;
+		v = (v | v << 8) & 0x100f00f00f00f00full;
+		v = (v | v << 4) & 0x10c30c30c30c30c3ull;
+		return (v | v << 2) & MASK_X64;
+	}
+
+	/**
+	 * Inverse of Spread64_IMPL, private function you're not supposed to use
+	 */
+	inline constexpr uint64_t	Compact64_IMPL(uint64_t v) noexcept
+	{
+		v &= MASK_X64;
+		v = (v ^ v >> 2) & 0x10c30c30c30c30c3ull;
+		v = (v ^ v >> 4) & 0x100f00f00f00f00full;
+		v = (v ^ v >> 8) & 0x001f0000ff0000ffull;
+		v = (v ^ v >> 16) & 0x001f00000000ffffull;
+		return (v ^ v >> 32) & 0x1fffffull;
+	}
+
+	/**
+	 * Computes the 32 bits Morton code of a position
+	 * @param x: x coordinate, only its 10 lower bits are used
+	 * @param y: y coordinate, only its 10 lower bits are used
+	 * @param z: z coordinate, only its 10 lower bits are used
+	 * @return Morton code of the position
+	 */
+	inline constexpr uint32_t	Encode32(const uint32_t x, const uint32_t y, const uint32_t z) noexcept
+	{
+#if MATHS_BMI2
+		if (!std::is_constant_evaluated())
+			return _pdep_u32(x, MASK_X32) | _pdep_u32(y, MASK_Y32) | _pdep_u32(z, MASK_Z32);
+#endif
+		return Spread32_IMPL(x) | Spread32_IMPL(y) << 1 | Spread32_IMPL(z) << 2;
+	}
+
+	/**
+	 * Computes the position of a 32 bits Morton code
+	 * @param code: Morton code
+	 * @return Position of the code, each coordinate between 0 and 1023
+	 */
+	inline constexpr IVec3		Decode32(const uint32_t code) noexcept
+	{
+#if MATHS_BMI2
+		if (!std::is_constant_evaluated())
+			return IVec3(static_cast<int>(_pext_u32(code, MASK_X32)), static_cast<int>(_pext_u32(code, MASK_Y32)),
+						 static_cast<int>(_pext_u32(code, MASK_Z32)));
+#endif
+		return IVec3(static_cast<int>(Compact32_IMPL(code)), static_cast<int>(Compact32_IMPL(code >> 1)),
+					 static_cast<int>(Compact32_IMPL(code >> 2)));
+	}
+
+	/**
+	 * Computes the 64 bits Morton code of a position
+	 * @param x: x coordinate, only its 21 lower bits are used
+	 * @param y: y coordinate, only its 21 lower bits are used
+	 * @param z: z coordinate, only its 21 lower bits are used
+	 * @return Morton code of the position
+	 */
+	inline constexpr uint64_t	Encode64(const uint32_t x, const uint32_t y, const uint32_t z) noexcept
+	{
+#if MATHS_BMI2 && (defined(__x86_64__) || defined(_M_X64))
+		if (!std::is_constant_evaluated())
+			return _pdep_u64(x, MASK_X64) | _pdep_u64(y, MASK_Y64) | _pdep_u64(z, MASK_Z64);
+#endif
+		return Spread64_IMPL(x) | Spread64_IMPL(y) << 1 | Spread64_IMPL(z) << 2;
+	}
+
+	/**
+	 * Computes the position of a 64 bits Morton code
+	 * @param code: Morton code
+	 * @return Position of the code, each coordinate between 0 and 2^21 - 1
+	 */
+	inline constexpr IVec3		Decode64(const uint64_t code) noexcept
+	{
+#if MATHS_BMI2 && (defined(__x86_64__) || defined(_M_X64))
+		if (!std::is_constant_evaluated())
+			return IVec3(static_cast<int>(_pext_u64(code, MASK_X64)), static_cast<int>(_pext_u64(code, MASK_Y64)),
+						 static_cast<int>(_pext_u64(code, MASK_Z64)));
+#endif
+		return IVec3(static_cast<int>(Compact64_IMPL(code)), static_cast<int>(Compact64_IMPL(code >> 1)),
+					 static_cast<int>(Compact64_IMPL(code >> 2)));
+	}
+
+	/**
+	 * Adds two Morton codes axis by axis, without decoding them. Each axis
+	 * wraps around, so adding the code of a negative offset, with its
+	 * coordinates masked to the bits of an axis, substracts it
+	 * @param a: First Morton code
+	 * @param b: Second Morton code
+	 * @return Morton code of the sum of the positions
+	 */
+	template <typename Code>
+	requires (std::is_same_v<Code, uint32_t> || std::is_same_v<Code, uint64_t>)
+	inline constexpr Code		Add(const Code a, const Code b) noexcept
+	{
+		constexpr Code	maskX{ std::is_same_v<Code, uint32_t> ? Code(MASK_X32) : Code(MASK_X64) };
+		constexpr Code	maskY{ maskX << 1 };
+		constexpr Code	maskZ{ maskX << 2 };
+
+		// Filling the bits of the other axis with ones carries across them
+		const Code	x{ ((a | ~maskX) + (b & maskX)) & maskX };
+		const Code	y{ ((a | ~maskY) + (b & maskY)) & maskY };
+		const Code	z{ ((a | ~maskZ) + (b & maskZ)) & maskZ };
+		return x | y | z;
+	}
+
+	/**
+	 * Substracts two Morton codes axis by axis, without decoding them
+	 * @param a: Morton code to substract from
+	 * @param b: Morton code to substract
+	 * @return Morton code of the difference of the positions
+	 */
+	template <typename Code>
+	requires (std::is_same_v<Code, uint32_t> || std::is_same_v<Code, uint64_t>)
+	inline constexpr Code		Sub(const Code a, const Code b) noexcept
+	{
+		constexpr Code	maskX{ std::is_same_v<Code, uint32_t> ? Code(MASK_X32) : Code(MASK_X64) };
+		constexpr Code	maskY{ maskX << 1 };
+		constexpr Code	maskZ{ maskX << 2 };
+
+		const Code	x{ ((a & maskX) - (b & maskX)) & maskX };
+		const Code	y{ ((a & maskY) - (b & maskY)) & maskY };
+		const Code	z{ ((a & maskZ) - (b & maskZ)) & maskZ };
+		return x | y | z;
+	}
+
+	/**
+	 * Computes the code of a neighbour of a position from its 32 bits Morton code.
+	 * Loops walking the same offset many times can encode it once and call Add
+	 * @param code: Morton code of the position
+	 * @param offset: Offset to the neighbour, may be negative
+	 * @return Morton code of the neighbour, wrapped around on each axis
+	 */
+	inline constexpr uint32_t	Neighbour32(const uint32_t code, const IVec3& offset) noexcept
+	{
+		return Add(code, Encode32(static_cast<uint32_t>(offset.x), static_cast<uint32_t>(offset.y),
+								  static_cast<uint32_t>(offset.z)));
+	}
+
+	/**
+	 * Computes the code of a neighbour of a position from its 64 bits Morton code
+	 * @param code: Morton code of the position
+	 * @param offset: Offset to the neighbour, may be negative
+	 * @return Morton code of the neighbour, wrapped around on each axis
+	 */
+	inline constexpr uint64_t	Neighbour64(const uint64_t code, const IVec3& offset) noexcept
+	{
+		return Add(code, Encode64(static_cast<uint32_t>(offset.x), static_cast<uint32_t>(offset.y),
+								  static_cast<uint32_t>(offset.z)));
+	}
+}
+
+#endif
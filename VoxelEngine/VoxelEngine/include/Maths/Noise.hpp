@@ -0,0 +1,637 @@
+#ifndef __NOISE__
+#define __NOISE__
+
+#include "Maths/MathMinimal.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "Maths/Vec2.hpp"
+#include "Maths/Vec3.hpp"
+#include "Maths/IVec2.hpp"
+#include "Maths/IVec3.hpp"
+
+#if MATHS_AVX2
+#include <immintrin.h>
+#endif
+
+/**
+ * Gradient and cellular noises for the procedural generation. Every noise
+ * is written once as a template over its lane type: float for the scalar
+ * path, Float8 for 8 samples at a time with AVX2. Both run the same
+ * operations in the same order, so a grid filled with AVX2 is bit identical
+ * to the scalar Evaluate of each sample, as long as the compiler does not fuse
+ * the multiply adds (MSVC default, -ffp-contract=off for GCC and Clang).
+ * Hashes use integer coordinates, the inputs must stay within the int range
+ */
+namespace Maths::Noise
+{
+	enum class ENoiseType : char
+	{
+		PERLIN = 0,
+		SIMPLEX = 1,
+		OPEN_SIMPLEX2 = 2,
+		CELLULAR = 3
+	};
+
+	enum class EFractalType : char
+	{
+		NONE = 0,
+		FBM = 1,
+		RIDGED = 2
+	};
+
+	/**
+	 * Parameters of a noise, sampled at position * frequency. Each octave of
+	 * a fractal multiplies the frequency by lacunarity, the amplitude by gain
+	 * and uses the next seed
+	 */
+	struct Settings
+	{
+		ENoiseType		type{ ENoiseType::OPEN_SIMPLEX2 };
+		EFractalType	fractal{ EFractalType::FBM };
+		int				seed{ 1337 };
+		float			frequency{ 0.01f };
+		unsigned		octaves{ 4 };
+		float			lacunarity{ 2.f };
+		float			gain{ 0.5f };
+	};
+
+	/* Scalar lane */
+
+	/**
+	 * Types of a lane: Int holds the hashes, Mask the comparisons,
+	 * private member you're not supposed to use
+	 */
+	template <typename F>
+	struct LaneTraits_IMPL;
+
+	template <>
+	struct LaneTraits_IMPL<float>
+	{
+		using Int = uint32_t;
+		using Mask = bool;
+		static constexpr size_t	WIDTH{ 1 };
+	};
+
+	inline float	LaneLoad(const float* p, float) noexcept { return *p; }
+	inline void		LaneStore(float* p, const float f) noexcept { *p = f; }
+	inline float	LaneFloor(const float f) noexcept { return static_cast<float>(FloorToInt(f)); }
+	inline uint32_t	LaneToInt(const float f) noexcept { return static_cast<uint32_t>(static_cast<int32_t>(f)); }
+	inline float	LaneToFloat(const uint32_t i) noexcept { return static_cast<float>(static_cast<int32_t>(i)); }
+	inline float	LaneSelect(const bool m, const float a, const float b) noexcept { return m ? a : b; }
+	inline uint32_t	LaneSelect(const bool m, const uint32_t a, const uint32_t b) noexcept { return m ? a : b; }
+	inline bool		LaneAnd(const bool a, const bool b) noexcept { return a && b; }
+	inline bool		LaneOr(const bool a, const bool b) noexcept { return a || b; }
+	inline bool		LaneNot(const bool a) noexcept { return !a; }
+	// Same as the instructions, b is returned when a value is NaN
+	inline float	LaneMin(const float a, const float b) noexcept { return a < b ? a : b; }
+	inline float	LaneMax(const float a, const float b) noexcept { return a > b ? a : b; }
+	inline float	LaneAbs(const float f) noexcept { return std::fabs(f); }
+	inline float	LaneSqrt(const float f) noexcept { return std::sqrt(f); }
+
+	/**
+	 * Flips the sign of f when bit 31 of bits is set
+	 */
+	inline float	LaneXorSign(const float f, const uint32_t bits) noexcept
+	{
+		return std::bit_cast<float>(std::bit_cast<uint32_t>(f) ^ (bits & 0x80000000u));
+	}
+
+#if MATHS_AVX2
+	/* AVX2 lane, 8 samples per register */
+
+	struct Mask8 { __m256 v; };
+	struct Int8
+	{
+		__m256i	v;
+
+		inline			Int8(const __m256i i) noexcept : v{ i } {}
+		inline explicit	Int8(const uint32_t i) noexcept : v{ _mm256_set1_epi32(static_cast<int>(i)) } {}
+	};
+	struct Float8
+	{
+		__m256	v;
+
+		inline			Float8(const __m256 f) noexcept : v{ f } {}
+		inline explicit	Float8(const float f) noexcept : v{ _mm256_set1_ps(f) } {}
+	};
+
+	template <>
+	struct LaneTraits_IMPL<Float8>
+	{
+		using Int = Int8;
+		using Mask = Mask8;
+		static constexpr size_t	WIDTH{ 8 };
+	};
+
+	inline Float8	operator+ (const Float8 a, const Float8 b) noexcept { return _mm256_add_ps(a.v, b.v); }
+	inline Float8	operator- (const Float8 a, const Float8 b) noexcept { return _mm256_sub_ps(a.v, b.v); }
+	inline Float8	operator* (const Float8 a, const Float8 b) noexcept { return _mm256_mul_ps(a.v, b.v); }
+	inline Mask8	operator< (const Float8 a, const Float8 b) noexcept { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+	inline Mask8	operator> (const Float8 a, const Float8 b) noexcept { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+	inline Mask8	operator>= (const Float8 a, const Float8 b) noexcept { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+
+	inline Int8		operator+ (const Int8 a, const Int8 b) noexcept { return _mm256_add_epi32(a.v, b.v); }
+	inline Int8		operator- (const Int8 a, const Int8 b) noexcept { return _mm256_sub_epi32(a.v, b.v); }
+	inline Int8		operator* (const Int8 a, const Int8 b) noexcept { return _mm256_mullo_epi32(a.v, b.v); }
+	inline Int8		operator^ (const Int8 a, const Int8 b) noexcept { return _mm256_xor_si256(a.v, b.v); }
+	inline Int8		operator& (const Int8 a, const Int8 b) noexcept { return _mm256_and_si256(a.v, b.v); }
+	inline Int8		operator>> (const Int8 a, const int shift) noexcept { return _mm256_srli_epi32(a.v, shift); }
+	inline Int8		operator<< (const Int8 a, const int shift) noexcept { return _mm256_slli_epi32(a.v, shift); }
+	// Signed comparisons, only used on small positive values
+	inline Mask8	operator< (const Int8 a, const Int8 b) noexcept { return { _mm256_castsi256_ps(_mm256_cmpgt_epi32(b.v, a.v)) }; }
+	inline Mask8	operator== (const Int8 a, const Int8 b) noexcept { return { _mm256_castsi256_ps(_mm256_cmpeq_epi32(a.v, b.v)) }; }
+
+	inline Float8	LaneLoad(const float* p, Float8) noexcept { return _mm256_loadu_ps(p); }
+	inline void		LaneStore(float* p, const Float8 f) noexcept { _mm256_storeu_ps(p, f.v); }
+	inline Float8	LaneFloor(const Float8 f) noexcept { return _mm256_floor_ps(f.v); }
+	inline Int8		LaneToInt(const Float8 f) noexcept { return _mm256_cvttps_epi32(f.v); }
+	inline Float8	LaneToFloat(const Int8 i) noexcept { return _mm256_cvtepi32_ps(i.v); }
+	inline Float8	LaneSelect(const Mask8 m, const Float8 a, const Float8 b) noexcept { return _mm256_blendv_ps(b.v, a.v, m.v); }
+	inline Int8		LaneSelect(const Mask8 m, const Int8 a, const Int8 b) noexcept
+	{
+		return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(b.v), _mm256_castsi256_ps(a.v), m.v));
+	}
+	inline Mask8	LaneAnd(const Mask8 a, const Mask8 b) noexcept { return { _mm256_and_ps(a.v, b.v) }; }
+	inline Mask8	LaneOr(const Mask8 a, const Mask8 b) noexcept { return { _mm256_or_ps(a.v, b.v) }; }
+	inline Mask8	LaneNot(const Mask8 a) noexcept { return { _mm256_xor_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(-1))) }; }
+	inline Float8	LaneMin(const Float8 a, const Float8 b) noexcept { return _mm256_min_ps(a.v, b.v); }
+	inline Float8	LaneMax(const Float8 a, const Float8 b) noexcept { return _mm256_max_ps(a.v, b.v); }
+	inline Float8	LaneAbs(const Float8 f) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), f.v); }
+	inline Float8	LaneSqrt(const Float8 f) noexcept { return _mm256_sqrt_ps(f.v); }
+	inline Float8	LaneXorSign(const Float8 f, const Int8 bits) noexcept
+	{
+		return _mm256_xor_ps(f.v, _mm256_castsi256_ps(_mm256_and_si256(bits.v, _mm256_set1_epi32(static_cast<int>(0x80000000u)))));
+	}
+#endif
+
+	/* Lattice helpers */
+
+	// Large primes multiplying the integer coordinates before hashing
+	constexpr uint32_t	PRIME_X{ 501125321u };
+	constexpr uint32_t	PRIME_Y{ 1136930381u };
+	constexpr uint32_t	PRIME_Z{ 1720413743u };
+
+	/**
+	 * Hashes premultiplied lattice coordinates, the high bits are folded in
+	 * the low ones which pick the gradients,
+	 * private function you're not supposed to use
+	 */
+	template <typename I>
+	inline I	Hash_IMPL(const I seed, const I x, const I y) noexcept
+	{
+		const I	h{ (seed ^ x ^ y) * I(0x27d4eb2du) };
+		return h ^ (h >> 15);
+	}
+
+	template <typename I>
+	inline I	Hash_IMPL(const I seed, const I x, const I y, const I z) noexcept
+	{
+		const I	h{ (seed ^ x ^ y ^ z) * I(0x27d4eb2du) };
+		return h ^ (h >> 15);
+	}
+
+	/**
+	 * Dot product of the offset with one of 8 gradients (Gustavson),
+	 * private function you're not supposed to use
+	 */
+	template <typename F, typename I>
+	inline F	Grad2_IMPL(const I hash, const F x, const F y) noexcept
+	{
+		const auto	low{ (hash & I(7u)) < I(4u) };
+		const F		u{ LaneSelect(low, x, y) };
+		const F		v{ LaneSelect(low, y, x) };
+		return LaneXorSign(u, hash << 31) + LaneXorSign(v + v, hash << 30);
+	}
+
+	/**
+	 * Dot product of the offset with one of the 12 edge gradients of
+	 * the improved Perlin noise, private function you're not supposed to use
+	 */
+	template <typename F, typename I>
+	inline F	Grad3_IMPL(const I hash, const F x, const F y, const F z) noexcept
+	{
+		const I	h{ hash & I(15u) };
+		const F	u{ LaneSelect(h < I(8u), x, y) };
+		const F	v{ LaneSelect(h < I(4u), y, LaneSelect(LaneOr(h == I(12u), h == I(14u)), x, z)) };
+		return LaneXorSign(u, h << 31) + LaneXorSign(v, h << 30);
+	}
+
+	template <typename F>
+	inline F	Fade_IMPL(const F t) noexcept
+	{
+		return t * t * t * (t * (t * F(6.f) - F(15.f)) + F(10.f));
+	}
+
+	template <typename F>
+	inline F	Lerp_IMPL(const F a, const F b, const F t) noexcept
+	{
+		return a + t * (b - a);
+	}
+
+	/**
+	 * Contribution of a simplex corner, (r2 - d^2)^4 * gradient,
+	 * private function you're not supposed to use
+	 */
+	template <typename F, typename I>
+	inline F	Corner2_IMPL(const I hash, const F x, const F y, const float r2) noexcept
+	{
+		const F	t{ LaneMax(F(r2) - x * x - y * y, F(0.f)) };
+		const F	t2{ t * t };
+		return t2 * t2 * Grad2_IMPL(hash, x, y);
+	}
+
+	template <typename F, typename I>
+	inline F	Corner3_IMPL(const I hash, const F x, const F y, const F z, const float r2) noexcept
+	{
+		const F	t{ LaneMax(F(r2) - x * x - y * y - z * z, F(0.f)) };
+		const F	t2{ t * t };
+		return t2 * t2 * Grad3_IMPL(hash, x, y, z);
+	}
+
+	/* Noises, each roughly in [-1, 1] */
+
+	/**
+	 * Improved Perlin noise on the square lattice, private function you're not supposed to use
+	 */
+	template <typename F, typename I = typename LaneTraits_IMPL<F>::Int>
+	inline F	Perlin2_IMPL(const F x, const F y, const I seed) noexcept
+	{
+		const F	fx{ LaneFloor(x) }, fy{ LaneFloor(y) };
+		const I	x0{ LaneToInt(fx) * I(PRIME_X) }, y0{ LaneToInt(fy) * I(PRIME_Y) };
+		const I	x1{ x0 + I(PRIME_X) }, y1{ y0 + I(PRIME_Y) };
+		const F	dx0{ x - fx }, dy0{ y - fy };
+		const F	dx1{ dx0 - F(1.f) }, dy1{ dy0 - F(1.f) };
+		const F	u{ Fade_IMPL(dx0) }, v{ Fade_IMPL(dy0) };
+
+		const F	a{ Lerp_IMPL(Grad2_IMPL(Hash_IMPL(seed, x0, y0), dx0, dy0), Grad2_IMPL(Hash_IMPL(seed, x1, y0), dx1, dy0), u) };
+		const F	b{ Lerp_IMPL(Grad2_IMPL(Hash_IMPL(seed, x0, y1), dx0, dy1), Grad2_IMPL(Hash_IMPL(seed, x1, y1), dx1, dy1), u) };
+		return Lerp_IMPL(a, b, v) * F(0.65f);
+	}
+
+	template <typename F, typename I = typename LaneTraits_IMPL<F>::Int>
+	inline F	Perlin3_IMPL(const F x, const F y, const F z, const I seed) noexcept
+	{
+		const F	fx{ LaneFloor(x) }, fy{ LaneFloor(y) }, fz{ LaneFloor(z) };
+		const I	x0{ LaneToInt(fx) * I(PRIME_X) }, y0{ LaneToInt(fy) * I(PRIME_Y) }, z0{ LaneToInt(fz) * I(PRIME_Z) };
+		const I	x1{ x0 + I(PRIME_X) }, y1{ y0 + I(PRIME_Y) }, z1{ z0 + I(PRIME_Z) };
+		const F	dx0{ x - fx }, dy0{ y - fy }, dz0{ z - fz };
+		const F	dx1{ dx0 - F(1.f) }, dy1{ dy0 - F(1.f) }, dz1{ dz0 - F(1.f) };
+		const F	u{ Fade_IMPL(dx0) }, v{ Fade_IMPL(dy0) }, w{ Fade_IMPL(dz0) };
+
+		const F	a0{ Lerp_IMPL(Grad3_IMPL(Hash_IMPL(seed, x0, y0, z0), dx0, dy0, dz0), Grad3_IMPL(Hash_IMPL(seed, x1, y0, z0), dx1, dy0, dz0), u) };
+		const F	b0{ Lerp_IMPL(Grad3_IMPL(Hash_IMPL(seed, x0, y1, z0), dx0, dy1, dz0), Grad3_IMPL(Hash_IMPL(seed, x1, y1, z0), dx1, dy1, dz0), u) };
+		const F	a1{ Lerp_IMPL(Grad3_IMPL(Hash_IMPL(seed, x0, y0, z1), dx0, dy0, dz1), Grad3_IMPL(Hash_IMPL(seed, x1, y0, z1), dx1, dy0, dz1), u) };
+		const F	b1{ Lerp_IMPL(Grad3_IMPL(Hash_IMPL(seed, x0, y1, z1), dx0, dy1, dz1), Grad3_IMPL(Hash_IMPL(seed, x1, y1, z1), dx1, dy1, dz1), u) };
+		return Lerp_IMPL(Lerp_IMPL(a0, b0, v), Lerp_IMPL(a1, b1, v), w) * F(0.97f);
+	}
+
+	/**
+	 * Simplex noise on the triangular lattice, private function you're not supposed to use
+	 */
+	template <typename F, typename I = typename LaneTraits_IMPL<F>::Int>
+	inline F	Simplex2_IMPL(const F x, const F y, const I seed) noexcept
+	{
+		constexpr float	F2{ 0.36602540378f };	// (sqrt(3) - 1) / 2
+		constexpr float	G2{ 0.21132486540f };	// (3 - sqrt(3)) / 6
+
+		const F	s{ (x + y) * F(F2) };
+		const F	fi{ LaneFloor(x + s) }, fj{ LaneFloor(y + s) };
+		const F	t{ (fi + fj) * F(G2) };
+		const F	x0{ x - (fi - t) }, y0{ y - (fj - t) };
+
+		// Second corner of the triangle, along the largest offset
+		const auto	xFirst{ x0 > y0 };
+		const F		x1{ x0 - LaneSelect(xFirst, F(1.f), F(0.f)) + F(G2) };
+		const F		y1{ y0 - LaneSelect(xFirst, F(0.f), F(1.f)) + F(G2) };
+		const F		x2{ x0 + F(2.f * G2 - 1.f) }, y2{ y0 + F(2.f * G2 - 1.f) };
+
+		const I	i{ LaneToInt(fi) * I(PRIME_X) }, j{ LaneToInt(fj) * I(PRIME_Y) };
+		const F	n0{ Corner2_IMPL(Hash_IMPL(seed, i, j), x0, y0, 0.5f) };
+		const F	n1{ Corner2_IMPL(Hash_IMPL(seed, i + LaneSelect(xFirst, I(PRIME_X), I(0u)), j + LaneSelect(xFirst, I(0u), I(PRIME_Y))), x1, y1, 0.5f) };
+		const F	n2{ Corner2_IMPL(Hash_IMPL(seed, i + I(PRIME_X), j + I(PRIME_Y)), x2, y2, 0.5f) };
+		return (n0 + n1 + n2) * F(44.f);
+	}
+
+	template <typename F, typename I = typename LaneTraits_IMPL<F>::Int>
+	inline F	Simplex3_IMPL(const F x, const F y, const F z, const I seed) noexcept
+	{
+		constexpr float	F3{ 1.f / 3.f };
+		constexpr float	G3{ 1.f / 6.f };
+
+		const F	s{ (x + y + z) * F(F3) };
+		const F	fi{ LaneFloor(x + s) }, fj{ LaneFloor(y + s) }, fk{ LaneFloor(z + s) };
+		const F	t{ (fi + fj + fk) * F(G3) };
+		const F	x0{ x - (fi - t) }, y0{ y - (fj - t) }, z0{ z - (fk - t) };
+
+		// Second and third corners of the tetrahedron, from the order of the offsets
+		const auto	xy{ x0 >= y0 }, yz{ y0 >= z0 }, xz{ x0 >= z0 };
+		const auto	i1{ LaneAnd(xy, xz) }, j1{ LaneAnd(LaneNot(xy), yz) }, k1{ LaneAnd(LaneNot(xz), LaneNot(yz)) };
+		const auto	i2{ LaneOr(xy, xz) }, j2{ LaneOr(LaneNot(xy), yz) }, k2{ LaneNot(LaneAnd(xz, yz)) };
+
+		const F	x1{ x0 - LaneSelect(i1, F(1.f), F(0.f)) + F(G3) };
+		const F	y1{ y0 - LaneSelect(j1, F(1.f), F(0.f)) + F(G3) };
+		const F	z1{ z0 - LaneSelect(k1, F(1.f), F(0.f)) + F(G3) };
+		const F	x2{ x0 - LaneSelect(i2, F(1.f), F(0.f)) + F(2.f * G3) };
+		const F	y2{ y0 - LaneSelect(j2, F(1.f), F(0.f)) + F(2.f * G3) };
+		const F	z2{ z0 - LaneSelect(k2, F(1.f), F(0.f)) + F(2.f * G3) };
+		const F	x3{ x0 + F(3.f * G3 - 1.f) }, y3{ y0 + F(3.f * G3 - 1.f) }, z3{ z0 + F(3.f * G3 - 1.f) };
+
+		const I	i{ LaneToInt(fi) * I(PRIME_X) }, j{ LaneToInt(fj) * I(PRIME_Y) }, k{ LaneToInt(fk) * I(PRIME_Z) };
+		const F	n0{ Corner3_IMPL(Hash_IMPL(seed, i, j, k), x0, y0, z0, 0.6f) };
+		const F	n1{ Corner3_IMPL(Hash_IMPL(seed, i + LaneSelect(i1, I(PRIME_X), I(0u)), j + LaneSelect(j1, I(PRIME_Y), I(0u)),
+										   k + LaneSelect(k1, I(PRIME_Z), I(0u))), x1, y1, z1, 0.6f) };
+		const F	n2{ Corner3_IMPL(Hash_IMPL(seed, i + LaneSelect(i2, I(PRIME_X), I(0u)), j + LaneSelect(j2, I(PRIME_Y), I(0u)),
+										   k + LaneSelect(k2, I(PRIME_Z), I(0u))), x2, y2, z2, 0.6f) };
+		const F	n3{ Corner3_IMPL(Hash_IMPL(seed, i + I(PRIME_X), j + I(PRIME_Y), k + I(PRIME_Z)), x3, y3, z3, 0.6f) };
+		return (n0 + n1 + n2 + n3) * F(32.f);
+	}
+
+	/**
+	 * Contributions of the 8 corners of the cube containing a point, on one
+	 * of the two cubic lattices of OpenSimplex2, private function you're not supposed to use
+	 */
+	template <typename F, typename I = typename LaneTraits_IMPL<F>::Int>
+	inline F	BccCube_IMPL(const F x, const F y, const F z, const I seed) noexcept
+	{
+		const F	fx{ LaneFloor(x) }, fy{ LaneFloor(y) }, fz{ LaneFloor(z) };
+		const I	x0{ LaneToInt(fx) * I(PRIME_X) }, y0{ LaneToInt(fy) * I(PRIME_Y) }, z0{ LaneToInt(fz) * I(PRIME_Z) };
+		const F	dx{ x - fx }, dy{ y - fy }, dz{ z - fz };
+
+		F	sum{ 0.f };
+		for (unsigned corner{ 0 }; corner < 8; ++corner)
+		{
+			const bool	cx{ (corner & 1) != 0 }, cy{ (corner & 2) != 0 }, cz{ (corner & 4) != 0 };
+			const I		h{ Hash_IMPL(seed, cx ? x0 + I(PRIME_X) : x0, cy ? y0 + I(PRIME_Y) : y0, cz ? z0 + I(PRIME_Z) : z0) };
+			sum = sum + Corner3_IMPL(h, cx ? dx - F(1.f) : dx, cy ? dy - F(1.f) : dy, cz ? dz - F(1.f) : dz, 0.75f);
+		}
+		return sum;
+	}
+
+	/**
+	 * OpenSimplex2 noise: two cubic lattices offset by half a cell form a body
+	 * centered cubic lattice, whose points within the kernel radius are the 16
+	 * corners of the two cubes containing the point. The domain is first
+	 * reflected so that the lattice diagonal follows the y axis, which hides
+	 * its axis aligned artifacts on the horizontal planes.
+	 * Private function you're not supposed to use
+	 */
+	template <typename F, typename I = typename LaneTraits_IMPL<F>::Int>
+	inline F	OpenSimplex2_3_IMPL(const F x, const F y, const F z, const I seed) noexcept
+	{
+		const F	r{ (x + y + z) * F(2.f / 3.f) };
+		const F	rx{ r - x }, ry{ r - y }, rz{ r - z };
+
+		const F	a{ BccCube_IMPL(rx, ry, rz, seed) };
+		const F	b{ BccCube_IMPL(rx + F(0.5f), ry + F(0.5f), rz + F(0.5f), seed ^ I(0x5bd1e995u)) };
+		return (a + b) * F(9.f);
+	}
+
+	/**
+	 * Worley noise: distance to the closest feature point, one per cell jittered from
+	 * its hash, remapped to about [-1, 1]. Private function you're not supposed to use
+	 */
+	template <typename F, typename I = typename LaneTraits_IMPL<F>::Int>
+	inline F	Cellular2_IMPL(const F x, const F y, const I seed) noexcept
+	{
+		constexpr float	JITTER{ 0.8f };
+
+		const F	fx{ LaneFloor(x) }, fy{ LaneFloor(y) };
+		const I	x0{ LaneToInt(fx) * I(PRIME_X) }, y0{ LaneToInt(fy) * I(PRIME_Y) };
+		const F	dx{ x - fx }, dy{ y - fy };
+
+		F	closest{ 10.f };
+		for (int cy{ -1 }; cy <= 1; ++cy)
+			for (int cx{ -1 }; cx <= 1; ++cx)
+			{
+				const I	h{ Hash_IMPL(seed, x0 + I(static_cast<uint32_t>(cx) * PRIME_X), y0 + I(static_cast<uint32_t>(cy) * PRIME_Y)) };
+				const F	px{ LaneToFloat(h & I(1023u)) * F(JITTER / 1023.f) + F(static_cast<float>(cx) + 0.5f - JITTER * 0.5f) - dx };
+				const F	py{ LaneToFloat((h >> 10) & I(1023u)) * F(JITTER / 1023.f) + F(static_cast<float>(cy) + 0.5f - JITTER * 0.5f) - dy };
+				closest = LaneMin(px * px + py * py, closest);
+			}
+		return LaneSqrt(closest) * F(1.8f) - F(1.f);
+	}
+
+	template <typename F, typename I = typename LaneTraits_IMPL<F>::Int>
+	inline F	Cellular3_IMPL(const F x, const F y, const F z, const I seed) noexcept
+	{
+		constexpr float	JITTER{ 0.8f };
+
+		const F	fx{ LaneFloor(x) }, fy{ LaneFloor(y) }, fz{ LaneFloor(z) };
+		const I	x0{ LaneToInt(fx) * I(PRIME_X) }, y0{ LaneToInt(fy) * I(PRIME_Y) }, z0{ LaneToInt(fz) * I(PRIME_Z) };
+		const F	dx{ x - fx }, dy{ y - fy }, dz{ z - fz };
+
+		F	closest{ 10.f };
+		for (int cz{ -1 }; cz <= 1; ++cz)
+			for (int cy{ -1 }; cy <= 1; ++cy)
+				for (int cx{ -1 }; cx <= 1; ++cx)
+				{
+					const I	h{ Hash_IMPL(seed, x0 + I(static_cast<uint32_t>(cx) * PRIME_X), y0 + I(static_cast<uint32_t>(cy) * PRIME_Y),
+										 z0 + I(static_cast<uint32_t>(cz) * PRIME_Z)) };
+					const F	px{ LaneToFloat(h & I(1023u)) * F(JITTER / 1023.f) + F(static_cast<float>(cx) + 0.5f - JITTER * 0.5f) - dx };
+					const F	py{ LaneToFloat((h >> 10) & I(1023u)) * F(JITTER / 1023.f) + F(static_cast<float>(cy) + 0.5f - JITTER * 0.5f) - dy };
+					const F	pz{ LaneToFloat((h >> 20) & I(1023u)) * F(JITTER / 1023.f) + F(static_cast<float>(cz) + 0.5f - JITTER * 0.5f) - dz };
+					closest = LaneMin(px * px + py * py + pz * pz, closest);
+				}
+		return LaneSqrt(closest) * F(1.8f) - F(1.f);
+	}
+
+	/* Settings and fractals */
+
+	template <typename F, typename I = typename LaneTraits_IMPL<F>::Int>
+	inline F	Single2_IMPL(const ENoiseType type, const F x, const F y, const I seed) noexcept
+	{
+		switch (type)
+		{
+		case ENoiseType::PERLIN:
+			return Perlin2_IMPL(x, y, seed);
+		case ENoiseType::CELLULAR:
+			return Cellular2_IMPL(x, y, seed);
+		default:
+			// OpenSimplex2 is the simplex lattice in 2D
+			return Simplex2_IMPL(x, y, seed);
+		}
+	}
+
+	template <typename F, typename I = typename LaneTraits_IMPL<F>::Int>
+	inline F	Single3_IMPL(const ENoiseType type, const F x, const F y, const F z, const I seed) noexcept
+	{
+		switch (type)
+		{
+		case ENoiseType::PERLIN:
+			return Perlin3_IMPL(x, y, z, seed);
+		case ENoiseType::SIMPLEX:
+			return Simplex3_IMPL(x, y, z, seed);
+		case ENoiseType::CELLULAR:
+			return Cellular3_IMPL(x, y, z, seed);
+		default:
+			return OpenSimplex2_3_IMPL(x, y, z, seed);
+		}
+	}
+
+	/**
+	 * Evaluates the noise and fractal of the settings, divided by the sum of
+	 * the amplitudes to stay in [-1, 1]. Ridged octaves are 1 - |noise|, remapped
+	 * to [-1, 1] as well. Private function you're not supposed to use
+	 */
+	template <typename F>
+	inline F	Evaluate2_IMPL(const Settings& settings, F x, F y) noexcept
+	{
+		using I = typename LaneTraits_IMPL<F>::Int;
+
+		x = x * F(settings.frequency);
+		y = y * F(settings.frequency);
+		uint32_t	seed{ static_cast<uint32_t>(settings.seed) };
+		if (settings.fractal == EFractalType::NONE || settings.octaves <= 1)
+			return Single2_IMPL(settings.type, x, y, I(seed));
+
+		F		sum{ 0.f };
+		float	amplitude{ 1.f }, total{ 0.f };
+		for (unsigned octave{ 0 }; octave < settings.octaves; ++octave, ++seed)
+		{
+			const F	n{ Single2_IMPL(settings.type, x, y, I(seed)) };
+			sum = sum + (settings.fractal == EFractalType::RIDGED ? F(1.f) - LaneAbs(n) : n) * F(amplitude);
+			total += amplitude;
+			amplitude *= settings.gain;
+			x = x * F(settings.lacunarity);
+			y = y * F(settings.lacunarity);
+		}
+
+		if (settings.fractal == EFractalType::RIDGED)
+			return sum * F(2.f / total) - F(1.f);
+		return sum * F(1.f / total);
+	}
+
+	template <typename F>
+	inline F	Evaluate3_IMPL(const Settings& settings, F x, F y, F z) noexcept
+	{
+		using I = typename LaneTraits_IMPL<F>::Int;
+
+		x = x * F(settings.frequency);
+		y = y * F(settings.frequency);
+		z = z * F(settings.frequency);
+		uint32_t	seed{ static_cast<uint32_t>(settings.seed) };
+		if (settings.fractal == EFractalType::NONE || settings.octaves <= 1)
+			return Single3_IMPL(settings.type, x, y, z, I(seed));
+
+		F		sum{ 0.f };
+		float	amplitude{ 1.f }, total{ 0.f };
+		for (unsigned octave{ 0 }; octave < settings.octaves; ++octave, ++seed)
+		{
+			const F	n{ Single3_IMPL(settings.type, x, y, z, I(seed)) };
+			sum = sum + (settings.fractal == EFractalType::RIDGED ? F(1.f) - LaneAbs(n) : n) * F(amplitude);
+			total += amplitude;
+			amplitude *= settings.gain;
+			x = x * F(settings.lacunarity);
+			y = y * F(settings.lacunarity);
+			z = z * F(settings.lacunarity);
+		}
+
+		if (settings.fractal == EFractalType::RIDGED)
+			return sum * F(2.f / total) - F(1.f);
+		return sum * F(1.f / total);
+	}
+
+	/**
+	 * Fills a grid with samples at origin + index * step, x varying the fastest, LaneTraits_IMPL<F>::WIDTH
+	 * samples at a time. The last block is evaluated whole and only its valid samples are stored,
+	 * so no other lane type is instantiated. Private function you're not supposed to use
+	 */
+	template <typename F>
+	inline void	FillGrid2_IMPL(const Settings& settings, const Vec2& origin, const float step, const IVec2& size, float* result) noexcept
+	{
+		constexpr size_t	WIDTH{ LaneTraits_IMPL<F>::WIDTH };
+		const size_t		count{ static_cast<size_t>(size.x) * static_cast<size_t>(size.y) };
+
+		int	x{ 0 }, y{ 0 };
+		for (size_t i{ 0 }; i < count; i += WIDTH)
+		{
+			float	px[WIDTH], py[WIDTH];
+			for (size_t lane{ 0 }; lane < WIDTH; ++lane)
+			{
+				px[lane] = origin.x + static_cast<float>(x) * step;
+				py[lane] = origin.y + static_cast<float>(y) * step;
+				if (++x == size.x)
+				{
+					x = 0;
+					++y;
+				}
+			}
+
+			const F	n{ Evaluate2_IMPL(settings, LaneLoad(px, F(0.f)), LaneLoad(py, F(0.f))) };
+			if (i + WIDTH <= count)
+				LaneStore(result + i, n);
+			else
+			{
+				float	tail[WIDTH];
+				LaneStore(tail, n);
+				for (size_t lane{ 0 }; i + lane < count; ++lane)
+					result[i + lane] = tail[lane];
+			}
+		}
+	}
+
+	template <typename F>
+	inline void	FillGrid3_IMPL(const Settings& settings, const Vec3& origin, const float step, const IVec3& size, float* result) noexcept
+	{
+		constexpr size_t	WIDTH{ LaneTraits_IMPL<F>::WIDTH };
+		const size_t		count{ static_cast<size_t>(size.x) * static_cast<size_t>(size.y) * static_cast<size_t>(size.z) };
+
+		int	x{ 0 }, y{ 0 }, z{ 0 };
+		for (size_t i{ 0 }; i < count; i += WIDTH)
+		{
+			float	px[WIDTH], py[WIDTH], pz[WIDTH];
+			for (size_t lane{ 0 }; lane < WIDTH; ++lane)
+			{
+				px[lane] = origin.x + static_cast<float>(x) * step;
+				py[lane] = origin.y + static_cast<float>(y) * step;
+				pz[lane] = origin.z + static_cast<float>(z) * step;
+				if (++x == size.x)
+				{
+					x = 0;
+					if (++y == size.y)
+					{
+						y = 0;
+						++z;
+					}
+				}
+			}
+
+			const F	n{ Evaluate3_IMPL(settings, LaneLoad(px, F(0.f)), LaneLoad(py, F(0.f)), LaneLoad(pz, F(0.f))) };
+			if (i + WIDTH <= count)
+				LaneStore(result + i, n);
+			else
+			{
+				float	tail[WIDTH];
+				LaneStore(tail, n);
+				for (size_t lane{ 0 }; i + lane < count; ++lane)
+					result[i + lane] = tail[lane];
+			}
+		}
+	}
+
+	/* Scalar entry points */
+
+	inline float	Perlin(const Vec2& p, const int seed = 0) noexcept { return Perlin2_IMPL(p.x, p.y, static_cast<uint32_t>(seed)); }
+	inline float	Perlin(const Vec3& p, const int seed = 0) noexcept { return Perlin3_IMPL(p.x, p.y, p.z, static_cast<uint32_t>(seed)); }
+	inline float	Simplex(const Vec2& p, const int seed = 0) noexcept { return Simplex2_IMPL(p.x, p.y, static_cast<uint32_t>(seed)); }
+	inline float	Simplex(const Vec3& p, const int seed = 0) noexcept { return Simplex3_IMPL(p.x, p.y, p.z, static_cast<uint32_t>(seed)); }
+	inline float	OpenSimplex2(const Vec2& p, const int seed = 0) noexcept { return Simplex2_IMPL(p.x, p.y, static_cast<uint32_t>(seed)); }
+	inline float	OpenSimplex2(const Vec3& p, const int seed = 0) noexcept { return OpenSimplex2_3_IMPL(p.x, p.y, p.z, static_cast<uint32_t>(seed)); }
+	inline float	Cellular(const Vec2& p, const int seed = 0) noexcept { return Cellular2_IMPL(p.x, p.y, static_cast<uint32_t>(seed)); }
+	inline float	Cellular(const Vec3& p, const int seed = 0) noexcept { return Cellular3_IMPL(p.x, p.y, p.z, static_cast<uint32_t>(seed)); }
+
+	/**
+	 * Evaluates the noise described by the settings at a point,
+	 * the same value as the grids filled with these settings
+	 * @param settings: Noise, fractal and frequency to evaluate
+	 * @param p: Position of the sample
+	 * @return Value in [-1, 1]
+	 */
+	inline float	Evaluate(const Settings& settings, const Vec2& p) noexcept { return Evaluate2_IMPL(settings, p.x, p.y); }
+	inline float	Evaluate(const Settings& settings, const Vec3& p) noexcept { return Evaluate3_IMPL(settings, p.x, p.y, p.z); }
+}
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef __OBB__
+#define __OBB__
+
+#include "Maths/MathMinimal.h"
+
+#include <type_traits>
+
+#include "Maths/Vec3.hpp"
+#include "Maths/Quaternion.hpp"
+#include "Maths/Aabb.hpp"
+
+namespace Maths
+{
+	/**
+	 * Oriented bounding box, stored as its center, its three unit axes
+	 * and half of its size along each of them
+	 */
+	struct Obb
+	{
+		Vec3	center;
+		Vec3	axes[3]{ Vec3(1.f, 0.f, 0.f), Vec3(0.f, 1.f, 0.f), Vec3(0.f, 0.f, 1.f) };
+		Vec3	halfExtents;
+
+		/**
+		 * Creates an empty box at the origin, aligned with the world axes
+		 */
+		inline constexpr		Obb() noexcept = default;
+
+		/**
+		 * Creates a box
+		 * @param boxCenter: Center of the box
+		 * @param boxHalfExtents: Half of the size of the box along each of its axes
+		 * @param rotation: Rotation of the box, a unit quaternion
+		 */
+		inline constexpr		Obb(const Vec3& boxCenter, const Vec3& boxHalfExtents, const Quaternion& rotation) noexcept
+			: center{ boxCenter },
+			axes{ rotation.RotateUnit(Vec3(1.f, 0.f, 0.f)), rotation.RotateUnit(Vec3(0.f, 1.f, 0.f)), rotation.RotateUnit(Vec3(0.f, 0.f, 1.f)) },
+			halfExtents{ boxHalfExtents }
+		{
+		}
+
+		/**
+		 * Creates a box with the same volume as an axis aligned box
+		 * @param box: Axis aligned box to convert
+		 */
+		inline constexpr explicit	Obb(const Aabb& box) noexcept : center{ box.Center() }, halfExtents{ box.HalfExtents() } {}
+
+		/**
+		 * Expresses a point in the frame of the box, centered and along its axes
+		 * @param point: Point in world space
+		 * @return Point in the frame of the box
+		 */
+		inline constexpr Vec3	ToLocal(const Vec3& point) const noexcept
+		{
+			const Vec3	d{ point - center };
+			return Vec3(d.Dot(axes[0]), d.Dot(axes[1]), d.Dot(axes[2]));
+		}
+
+		/**
+		 * Expresses a direction in the frame of the box
+		 * @param direction: Direction in world space
+		 * @return Direction in the frame of the box
+		 */
+		inline constexpr Vec3	ToLocalDirection(const Vec3& direction) const noexcept
+		{
+			return Vec3(direction.Dot(axes[0]), direction.Dot(axes[1]), direction.Dot(axes[2]));
+		}
+
+		/**
+		 * Brings a point of the frame of the box back to world space
+		 * @param local: Point in the frame of the box
+		 * @return Point in world space
+		 */
+		inline constexpr Vec3	ToWorld(const Vec3& local) const noexcept
+		{
+			return center + axes[0] * local.x + axes[1] * local.y + axes[2] * local.z;
+		}
+
+		/**
+		 * Computes the point of the box closest to a point
+		 * @param point: Point to project on the box
+		 * @return The point itself if it is inside, the closest point of the surface otherwise
+		 */
+		inline constexpr Vec3	ClosestPoint(const Vec3& point) const noexcept
+		{
+			return ToWorld(Aabb(Vec3() - halfExtents, halfExtents).ClosestPoint(ToLocal(point)));
+		}
+
+		/**
+		 * Checks if a point is inside the box or on its surface
+		 * @param point: Point to check
+		 * @return Whether the point is inside the box
+		 */
+		inline constexpr bool	Contains(const Vec3& point) const noexcept
+		{
+			return Aabb(Vec3() - halfExtents, halfExtents).Contains(ToLocal(point));
+		}
+
+		/**
+		 * Computes the smallest axis aligned box containing the box
+		 * @return Axis aligned box
+		 */
+		inline constexpr Aabb	Bounds() const noexcept
+		{
+			Vec3	extent;
+			for (unsigned axis{ 0 }; axis < 3; ++axis)
+			{
+				const Vec3	a{ axes[axis] * halfExtents.xyz[axis] };
+				extent += Vec3(a.x < 0.f ? -a.x : a.x, a.y < 0.f ? -a.y : a.y, a.z < 0.f ? -a.z : a.z);
+			}
+			return Aabb(center - extent, center + extent);
+		}
+	};
+}
+
+#endif
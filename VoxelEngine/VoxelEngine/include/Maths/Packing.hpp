@@ -0,0 +1,378 @@
+#ifndef __PACKING__
+#define __PACKING__
+
+#include "Maths/MathMinimal.h"
+
+#include <bit>
+#include <cstdint>
+#include <span>
+
+#include "Maths/Vec2.hpp"
+#include "Maths/Vec3.hpp"
+#include "Maths/Vec4.hpp"
+#include "Maths/Color.hpp"
+
+/**
+ * Compact encodings of the vertex attributes, to shrink the vertex streams:
+ * normals in 2 or 4 bytes instead of 12, colors in 4 bytes instead of 16
+ * and half floats. Each encoding has a single value version and a batch
+ * version, the batches expect result to be at least as large as their input.
+ * The half float batches are Core::Renderer::FloatsToHalves/HalvesToFloats,
+ * dispatched at runtime to F16C
+ */
+namespace Maths::Packing
+{
+	/**
+	 * Rounds to the nearest integer, halves away from zero,
+	 * private function you're not supposed to use
+	 */
+	inline int		Round_IMPL(const float f) noexcept
+	{
+		return static_cast<int>(std::round(f));
+	}
+
+	inline float	Saturate_IMPL(const float f) noexcept
+	{
+		return f < 0.f ? 0.f : (f > 1.f ? 1.f : f);
+	}
+
+	inline float	ClampSigned_IMPL(const float f) noexcept
+	{
+		return f < -1.f ? -1.f : (f > 1.f ? 1.f : f);
+	}
+
+	/* Octahedral normals */
+
+	/**
+	 * Maps a unit vector on the octahedron |x| + |y| + |z| = 1, whose lower half is
+	 * folded over the upper one, giving a point of the square [-1, 1]^2. The error
+	 * is spread evenly over the sphere, unlike with spherical coordinates
+	 * @param n: Vector of length one
+	 * @return Point of [-1, 1]^2
+	 */
+	inline Vec2		OctahedralEncode(const Vec3& n) noexcept
+	{
+		const float	l1{ std::fabs(n.x) + std::fabs(n.y) + std::fabs(n.z) };
+		float		x{ n.x / l1 };
+		float		y{ n.y / l1 };
+		if (n.z < 0.f)
+		{
+			const float	fx{ (1.f - std::fabs(y)) * (x >= 0.f ? 1.f : -1.f) };
+			const float	fy{ (1.f - std::fabs(x)) * (y >= 0.f ? 1.f : -1.f) };
+			x = fx;
+			y = fy;
+		}
+		return Vec2(x, y);
+	}
+
+	/**
+	 * Unfolds a point of the square [-1, 1]^2 back to a unit vector
+	 * @param p: Point given by OctahedralEncode
+	 * @return Vector of length one
+	 */
+	inline Vec3		OctahedralDecode(const Vec2& p) noexcept
+	{
+		float		x{ p.x };
+		float		y{ p.y };
+		const float	z{ 1.f - std::fabs(x) - std::fabs(y) };
+		const float	t{ z < 0.f ? -z : 0.f };
+		x += x >= 0.f ? -t : t;
+		y += y >= 0.f ? -t : t;
+
+		const float	invLength{ 1.f / std::sqrt(x * x + y * y + z * z) };
+		return Vec3(x * invLength, y * invLength, z * invLength);
+	}
+
+	/**
+	 * Packs a unit vector as two 16 bits signed normalized values, x in the low half.
+	 * Matches a GL_SHORT vec2 attribute with normalization, the angular error stays under 0.05 degree
+	 * @param n: Vector of length one
+	 * @return Packed vector
+	 */
+	inline uint32_t	PackOctahedral32(const Vec3& n) noexcept
+	{
+		const Vec2	p{ OctahedralEncode(n) };
+		const int	x{ Round_IMPL(ClampSigned_IMPL(p.x) * 32767.f) };
+		const int	y{ Round_IMPL(ClampSigned_IMPL(p.y) * 32767.f) };
+		return (static_cast<uint32_t>(x) & 0xffffu) | (static_cast<uint32_t>(y) << 16);
+	}
+
+	inline Vec3		UnpackOctahedral32(const uint32_t packed) noexcept
+	{
+		const float	x{ static_cast<float>(static_cast<int16_t>(packed & 0xffffu)) / 32767.f };
+		const float	y{ static_cast<float>(static_cast<int16_t>(packed >> 16)) / 32767.f };
+		return OctahedralDecode(Vec2(x < -1.f ? -1.f : x, y < -1.f ? -1.f : y));
+	}
+
+	/**
+	 * Packs a unit vector as two 8 bits signed normalized values, x in the low byte.
+	 * Matches a GL_BYTE vec2 attribute with normalization, the angular error stays around
+	 * one degree, enough for the lighting of voxel faces
+	 * @param n: Vector of length one
+	 * @return Packed vector
+	 */
+	inline uint16_t	PackOctahedral16(const Vec3& n) noexcept
+	{
+		const Vec2	p{ OctahedralEncode(n) };
+		const int	x{ Round_IMPL(ClampSigned_IMPL(p.x) * 127.f) };
+		const int	y{ Round_IMPL(ClampSigned_IMPL(p.y) * 127.f) };
+		return static_cast<uint16_t>((static_cast<uint32_t>(x) & 0xffu) | ((static_cast<uint32_t>(y) & 0xffu) << 8));
+	}
+
+	inline Vec3		UnpackOctahedral16(const uint16_t packed) noexcept
+	{
+		const float	x{ static_cast<float>(static_cast<int8_t>(packed & 0xffu)) / 127.f };
+		const float	y{ static_cast<float>(static_cast<int8_t>(packed >> 8)) / 127.f };
+		return OctahedralDecode(Vec2(x < -1.f ? -1.f : x, y < -1.f ? -1.f : y));
+	}
+
+	inline void		PackOctahedral32(std::span<const Vec3> normals, std::span<uint32_t> result) noexcept
+	{
+		for (size_t i{ 0 }; i < normals.size(); ++i)
+			result[i] = PackOctahedral32(normals[i]);
+	}
+
+	inline void		PackOctahedral16(std::span<const Vec3> normals, std::span<uint16_t> result) noexcept
+	{
+		for (size_t i{ 0 }; i < normals.size(); ++i)
+			result[i] = PackOctahedral16(normals[i]);
+	}
+
+	/* GL_INT_2_10_10_10_REV */
+
+	/**
+	 * Packs a vector as signed normalized values, x in the 10 lowest bits, then
+	 * y and z on 10 bits and w on the 2 highest bits. Read by a vec4 attribute of
+	 * type GL_INT_2_10_10_10_REV with normalization, with the OpenGL 4.2 conversion
+	 * @param v: Vector whose components are in [-1, 1]
+	 * @return Packed vector
+	 */
+	inline uint32_t	PackSnorm1010102(const Vec4& v) noexcept
+	{
+		const int	x{ Round_IMPL(ClampSigned_IMPL(v.x) * 511.f) };
+		const int	y{ Round_IMPL(ClampSigned_IMPL(v.y) * 511.f) };
+		const int	z{ Round_IMPL(ClampSigned_IMPL(v.z) * 511.f) };
+		const int	w{ Round_IMPL(ClampSigned_IMPL(v.w)) };
+		return (static_cast<uint32_t>(x) & 0x3ffu) | ((static_cast<uint32_t>(y) & 0x3ffu) << 10)
+			| ((static_cast<uint32_t>(z) & 0x3ffu) << 20) | (static_cast<uint32_t>(w) << 30);
+	}
+
+	inline Vec4		UnpackSnorm1010102(const uint32_t packed) noexcept
+	{
+		// The shifts bring each field to the top of an int, to extend its sign
+		const int	x{ static_cast<int32_t>(packed << 22) >> 22 };
+		const int	y{ static_cast<int32_t>(packed << 12) >> 22 };
+		const int	z{ static_cast<int32_t>(packed << 2) >> 22 };
+		const int	w{ static_cast<int32_t>(packed) >> 30 };
+		const float	fx{ static_cast<float>(x) / 511.f };
+		const float	fy{ static_cast<float>(y) / 511.f };
+		const float	fz{ static_cast<float>(z) / 511.f };
+		return Vec4(fx < -1.f ? -1.f : fx, fy < -1.f ? -1.f : fy, fz < -1.f ? -1.f : fz, w < -1 ? -1.f : static_cast<float>(w));
+	}
+
+	/**
+	 * Packs a normal or a tangent, with w as the sign of the bitangent
+	 */
+	inline uint32_t	PackSnorm1010102(const Vec3& v, const float w = 0.f) noexcept
+	{
+		return PackSnorm1010102(Vec4(v.x, v.y, v.z, w));
+	}
+
+	inline void		PackSnorm1010102(std::span<const Vec4> vectors, std::span<uint32_t> result) noexcept
+	{
+		for (size_t i{ 0 }; i < vectors.size(); ++i)
+			result[i] = PackSnorm1010102(vectors[i]);
+	}
+
+	inline void		PackSnorm1010102(std::span<const Vec3> vectors, std::span<uint32_t> result) noexcept
+	{
+		for (size_t i{ 0 }; i < vectors.size(); ++i)
+			result[i] = PackSnorm1010102(vectors[i]);
+	}
+
+	/* Half floats */
+
+	/**
+	 * Converts a float to an IEEE half float, rounded to the nearest even like
+	 * vcvtps2ph. Overflows become infinities and NaNs stay quiet NaNs
+	 * @param f: Float to convert
+	 * @return Bits of the half float
+	 */
+	inline uint16_t	FloatToHalf(const float f) noexcept
+	{
+		uint32_t		u{ std::bit_cast<uint32_t>(f) };
+		const uint32_t	sign{ u & 0x80000000u };
+		u ^= sign;
+
+		uint32_t	h;
+		if (u >= 0x47800000u)
+		{
+			// Too large for a half (exponent over 15), infinity or NaN
+			h = u > 0x7f800000u ? 0x7e00u | ((u >> 13) & 0x3ffu) : 0x7c00u;
+		}
+		else if (u < 0x38800000u)
+		{
+			// Subnormal half or zero: adding 0.5 aligns the mantissa so that
+			// the float addition does the rounding
+			constexpr uint32_t	DENORM_MAGIC{ ((127 - 15) + (23 - 10) + 1) << 23 };
+			h = std::bit_cast<uint32_t>(std::bit_cast<float>(u) + std::bit_cast<float>(DENORM_MAGIC)) - DENORM_MAGIC;
+		}
+		else
+		{
+			// Rebias the exponent, rounding to the nearest even on the 13 dropped bits
+			const uint32_t	mantissaOdd{ (u >> 13) & 1u };
+			h = (u + (static_cast<uint32_t>(15 - 127) << 23) + 0xfffu + mantissaOdd) >> 13;
+		}
+		return static_cast<uint16_t>(h | (sign >> 16));
+	}
+
+	/**
+	 * Converts an IEEE half float to a float, exactly like vcvtph2ps
+	 * @param h: Bits of the half float
+	 * @return Converted float
+	 */
+	inline float	HalfToFloat(const uint16_t h) noexcept
+	{
+		constexpr uint32_t	SHIFTED_EXPONENT{ 0x7c00u << 13 };
+
+		uint32_t		u{ (h & 0x7fffu) << 13 };
+		const uint32_t	exponent{ u & SHIFTED_EXPONENT };
+		u += static_cast<uint32_t>(127 - 15) << 23;
+
+		if (exponent == SHIFTED_EXPONENT)
+		{
+			// Infinity or NaN, NaNs are made quiet
+			u += static_cast<uint32_t>(128 - 16) << 23;
+			if ((h & 0x3ffu) != 0)
+				u |= 0x400000u;
+		}
+		else if (exponent == 0)
+		{
+			// Subnormal half, normalized by the float subtraction
+			u += 1u << 23;
+			u = std::bit_cast<uint32_t>(std::bit_cast<float>(u) - std::bit_cast<float>(113u << 23));
+		}
+		return std::bit_cast<float>(u | (static_cast<uint32_t>(h & 0x8000u) << 16));
+	}
+
+	/* sRGB RGBA8 colors */
+
+	/**
+	 * Converts a linear color component to sRGB
+	 * @param linear: Component in [0, 1]
+	 * @return sRGB component in [0, 1]
+	 */
+	inline float	LinearToSrgb(const float linear) noexcept
+	{
+		return linear <= 0.0031308f ? linear * 12.92f : 1.055f * std::pow(linear, 1.f / 2.4f) - 0.055f;
+	}
+
+	/**
+	 * Converts a sRGB color component to linear
+	 * @param srgb: Component in [0, 1]
+	 * @return Linear component in [0, 1]
+	 */
+	inline float	SrgbToLinear(const float srgb) noexcept
+	{
+		return srgb <= 0.04045f ? srgb / 12.92f : std::pow((srgb + 0.055f) / 1.055f, 2.4f);
+	}
+
+	/**
+	 * Tables of the sRGB conversions, built on first use,
+	 * private struct you're not supposed to use
+	 */
+	struct SrgbTables_IMPL
+	{
+		// Linear value of each 8 bits sRGB level
+		float	toLinear[256];
+		// Smallest linear value rounded to each level, the midpoint with the level below
+		float	thresholds[256];
+		// Level of the linear values i / 4095, the starting guess of the encoding
+		uint8_t	guess[4096];
+
+		inline SrgbTables_IMPL() noexcept
+		{
+			for (unsigned level{ 0 }; level < 256; ++level)
+			{
+				toLinear[level] = SrgbToLinear(static_cast<float>(level) / 255.f);
+
+				// Computed in double and rounded up, so that the float thresholds give
+				// the same levels as the exact conversion
+				const double	srgb{ (static_cast<double>(level) - 0.5) / 255. };
+				const double	threshold{ level == 0 ? 0. : (srgb <= 0.04045 ? srgb / 12.92 : std::pow((srgb + 0.055) / 1.055, 2.4)) };
+				thresholds[level] = static_cast<float>(threshold);
+				if (static_cast<double>(thresholds[level]) < threshold)
+					thresholds[level] = std::nextafter(thresholds[level], 2.f);
+			}
+
+			unsigned	level{ 0 };
+			for (unsigned i{ 0 }; i < 4096; ++i)
+			{
+				const float	linear{ static_cast<float>(i) / 4095.f };
+				while (level < 255 && linear >= thresholds[level + 1])
+					++level;
+				guess[i] = static_cast<uint8_t>(level);
+			}
+		}
+
+		static inline const SrgbTables_IMPL&	Get() noexcept
+		{
+			static const SrgbTables_IMPL	tables;
+			return tables;
+		}
+	};
+
+	/**
+	 * Converts a linear component to its nearest 8 bits sRGB level, through the tables
+	 * instead of pow: the guess of the closest 12 bits entry is moved to the level
+	 * whose thresholds surround the value, at most one step away
+	 * @param linear: Linear component, clamped to [0, 1]
+	 * @return sRGB level
+	 */
+	inline uint32_t	LinearToSrgb8(const float linear) noexcept
+	{
+		const SrgbTables_IMPL&	tables{ SrgbTables_IMPL::Get() };
+		const float				f{ Saturate_IMPL(linear) };
+
+		uint32_t	level{ tables.guess[static_cast<unsigned>(f * 4095.f)] };
+		while (level < 255 && f >= tables.thresholds[level + 1])
+			++level;
+		while (level > 0 && f < tables.thresholds[level])
+			--level;
+		return level;
+	}
+
+	/**
+	 * Packs a linear color as sRGB RGBA8, red in the lowest byte so that the bytes are
+	 * in RGBA order in memory. Read by a GL_UNSIGNED_BYTE vec4 attribute with normalization,
+	 * or a GL_SRGB8_ALPHA8 texture which converts it back to linear. Alpha stays linear
+	 * @param color: Linear color, components clamped to [0, 1]
+	 * @return Packed color
+	 */
+	inline uint32_t	PackSrgba8(const Color& color) noexcept
+	{
+		const uint32_t	alpha{ static_cast<uint32_t>(Round_IMPL(Saturate_IMPL(color.a) * 255.f)) };
+		return LinearToSrgb8(color.r) | (LinearToSrgb8(color.g) << 8) | (LinearToSrgb8(color.b) << 16) | (alpha << 24);
+	}
+
+	inline Color	UnpackSrgba8(const uint32_t packed) noexcept
+	{
+		const SrgbTables_IMPL&	tables{ SrgbTables_IMPL::Get() };
+		return Color(tables.toLinear[packed & 0xffu], tables.toLinear[(packed >> 8) & 0xffu],
+					 tables.toLinear[(packed >> 16) & 0xffu], static_cast<float>(packed >> 24) / 255.f);
+	}
+
+	inline void		PackSrgba8(std::span<const Color> colors, std::span<uint32_t> result) noexcept
+	{
+		for (size_t i{ 0 }; i < colors.size(); ++i)
+			result[i] = PackSrgba8(colors[i]);
+	}
+
+	inline void		UnpackSrgba8(std::span<const uint32_t> packed, std::span<Color> result) noexcept
+	{
+		for (size_t i{ 0 }; i < packed.size(); ++i)
+			result[i] = UnpackSrgba8(packed[i]);
+	}
+}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef __PLANE__
+#define __PLANE__
+
+#include "Maths/MathMinimal.h"
+
+#include <type_traits>
+
+#include "Maths/Vec3.hpp"
+
+namespace Maths
+{
+	/**
+	 * Infinite plane stored as (unit normal, distance) like the planes of
+	 * Frustum: the signed distance of a point p is normal.Dot(p) + distance
+	 */
+	struct Plane
+	{
+		Vec3	normal;
+		float	distance{ 0.f };
+
+		/**
+		 * Creates a degenerated plane, with a normal zero
+		 */
+		inline constexpr		Plane() noexcept = default;
+
+		/**
+		 * Creates a plane
+		 * @param planeNormal: Normal of the plane, of length one
+		 * @param planeDistance: Signed distance from the plane to the origin
+		 */
+		inline constexpr		Plane(const Vec3& planeNormal, const float planeDistance) noexcept
+			: normal{ planeNormal }, distance{ planeDistance }
+		{
+		}
+
+		/**
+		 * Creates the plane going through a point
+		 * @param planeNormal: Normal of the plane, of length one
+		 * @param point: Point of the plane
+		 * @return Plane created
+		 */
+		static inline constexpr Plane	FromPoint(const Vec3& planeNormal, const Vec3& point) noexcept
+		{
+			return Plane(planeNormal, -planeNormal.Dot(point));
+		}
+
+		/**
+		 * Creates the plane going through three points, its normal
+		 * follows the counter clockwise order of the points
+		 * @param a: First point
+		 * @param b: Second point
+		 * @param c: Third point
+		 * @return Plane created
+		 */
+		static inline Plane	FromPoints(const Vec3& a, const Vec3& b, const Vec3& c) noexcept
+		{
+			return FromPoint((b - a).Cross(c - a).Normalized(), a);
+		}
+
+		/**
+		 * Computes the signed distance of a point to the plane,
+		 * positive on the side the normal points to
+		 * @param point: Point to compute the distance of
+		 * @return Signed distance of the point
+		 */
+		inline constexpr float	Distance(const Vec3& point) const noexcept
+		{
+			return normal.Dot(point) + distance;
+		}
+
+		/**
+		 * Projects a point on the plane
+		 * @param point: Point to project
+		 * @return Closest point of the plane
+		 */
+		inline constexpr Vec3	ClosestPoint(const Vec3& point) const noexcept
+		{
+			return point - normal * Distance(point);
+		}
+	};
+}
+
+#endif
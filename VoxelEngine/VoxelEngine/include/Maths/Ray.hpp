@@ -0,0 +1,69 @@
+#ifndef __RAY__
+#define __RAY__
+
+#include "Maths/MathMinimal.h"
+
+#include <type_traits>
+
+#include "Maths/Vec3.hpp"
+
+namespace Maths
+{
+	/**
+	 * Half line starting at an origin, used for picking and visibility queries
+	 */
+	struct Ray
+	{
+		Vec3	origin;
+		Vec3	direction;
+
+		/**
+		 * Creates a ray at the origin with a direction zero
+		 */
+		inline constexpr		Ray() noexcept = default;
+
+		/**
+		 * Creates a ray
+		 * @param rayOrigin: Origin of the ray
+		 * @param rayDirection: Direction of the ray, of length one so that
+		 * the distances returned by the intersections are in world units
+		 */
+		inline constexpr		Ray(const Vec3& rayOrigin, const Vec3& rayDirection) noexcept
+			: origin{ rayOrigin }, direction{ rayDirection }
+		{
+		}
+
+		/**
+		 * Creates the ray starting at a point and going through another
+		 * @param from: Origin of the ray
+		 * @param to: Point the ray goes through, different from from
+		 * @return Ray created
+		 */
+		static inline Ray		FromPoints(const Vec3& from, const Vec3& to) noexcept
+		{
+			return Ray(from, (to - from).Normalized());
+		}
+
+		/**
+		 * Computes the point at a given distance along the ray
+		 * @param t: Distance from the origin
+		 * @return Point of the ray
+		 */
+		inline constexpr Vec3	At(const float t) const noexcept
+		{
+			return origin + direction * t;
+		}
+
+		/**
+		 * Computes the inverse of each component of the direction, infinite
+		 * for the null ones, as the slab tests need it
+		 * @return Inverse of the direction
+		 */
+		inline constexpr Vec3	InverseDirection() const noexcept
+		{
+			return Vec3(1.f / direction.x, 1.f / direction.y, 1.f / direction.z);
+		}
+	};
+}
+
+#endif
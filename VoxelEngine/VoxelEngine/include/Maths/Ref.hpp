@@ -33,21 +33,27 @@ namespace Maths
 		 * Copy constructor
 		 * @param r: Ref to be copied
 		 */
-		inline constexpr Ref(const Ref<Size>& r) noexcept : origin{ r.origin }, ref{}
-		{
-			for (unsigned i{ 0 }; i < Size; ++i)
-				ref[i] = r.Get(i);
-		}
+		inline constexpr Ref(const Ref<Size>& r) noexcept = default;
 
 		/**
 		 * Move constructor
 		 * @param r: Ref to be moved
 		 */
-		inline constexpr Ref(Ref<Size>&& r) noexcept : origin{ std::move(r.origin) }, ref{}
-		{
-			for (unsigned i{ 0 }; i < Size; ++i)
-				ref[i] = std::move(r.ref[i]);
-		}
+		inline constexpr Ref(Ref<Size>&& r) noexcept = default;
+
+		/**
+		 * Copy operator
+		 * @param r: Ref to be copied
+		 * @return Reference to the current ref
+		 */
+		inline constexpr Ref<Size>&			operator= (const Ref<Size>& r) noexcept = default;
+
+		/**
+		 * Move operator
+		 * @param r: Ref to be moved
+		 * @return Reference to the current ref
+		 */
+		inline constexpr Ref<Size>&			operator= (Ref<Size>&& r) noexcept = default;
 
 		/**
 		 * Getter for referential axis
@@ -43,10 +43,7 @@ namespace Maths
 		 * Copy constructor
 		 * @param r: Ref to copy
 		 */
-		inline constexpr	Ref3D(const Ref3D& r) noexcept
-			: origin{ r.origin }, i{ r.i }, j{ r.j }, k{ r.k }
-		{
-		}
+		inline constexpr	Ref3D(const Ref3D& r) noexcept = default;
 
 		/**
 		 * Copy constructor from templated ref
@@ -103,7 +100,26 @@ namespace Maths
 		 */
 		inline constexpr Mat4	WorldToLocalMatrix() const noexcept
 		{
-			return LocalToWorldMatrix().Inversed();
+			if (IsOrthonormal())
+				return LocalToWorldMatrix().InversedOrthonormal();
+			return LocalToWorldMatrix().InversedAffine();
+		}
+
+		/**
+		 * Checks if the axis of the ref are unit length and orthogonal
+		 * to each other, in which case the world to local matrix
+		 * can be computed with a transposition
+		 * @param epsilon: Tolerance on the lengths and dot products
+		 * @return Whether the ref is orthonormal
+		 */
+		inline constexpr bool	IsOrthonormal(const float epsilon = 1e-5f) const noexcept
+		{
+			const float	values[6]{ i.SquaredLength() - 1.f, j.SquaredLength() - 1.f, k.SquaredLength() - 1.f,
+									i.Dot(j), j.Dot(k), k.Dot(i) };
+			for (const float value : values)
+				if (value > epsilon || value < -epsilon)
+					return false;
+			return true;
 		}
 
 		/**
@@ -0,0 +1,1121 @@
+#ifndef __SIMD__
+#define __SIMD__
+
+#include "Maths/MathMinimal.h"
+
+#include <bit>
+#include <cstddef>
+
+#if MATHS_SSE
+#include <immintrin.h>
+
+/**
+ * Builds the immediate of _mm_shuffle_ps from the four lanes to select
+ */
+#define MATHS_SHUFFLE_MASK(x, y, z, w)	((x) | ((y) << 2) | ((z) << 4) | ((w) << 6))
+
+/**
+ * Selects lanes x and y of a and lanes z and w of b
+ */
+#define MATHS_SHUFFLE(a, b, x, y, z, w)	_mm_shuffle_ps(a, b, MATHS_SHUFFLE_MASK(x, y, z, w))
+
+/**
+ * Reorders the lanes of a
+ */
+#define MATHS_SWIZZLE(a, x, y, z, w)	_mm_shuffle_ps(a, a, MATHS_SHUFFLE_MASK(x, y, z, w))
+
+/**
+ * SIMD kernels used by the maths structs at runtime.
+ * Every kernel works on row major float arrays, so that it
+ * can be shared by Mat4 and Mat<4, 4>. The constexpr scalar code stays
+ * in the structs themselves, and is used at compile time and when
+ * MATHS_SSE is not defined.
+ *
+ * The instruction set of these kernels (Mat4 products and inverse, batch
+ * transforms, Vec3Stream) is picked at compile time: they are inlined in the
+ * header only maths types, and on a single matrix an indirect call costs about
+ * what AVX2 saves. Their AVX2 path is used by builds targeting /arch:AVX2.
+ * Only the SoA culling and intersection kernels, which loop over many boxes,
+ * are dispatched at runtime (see SimdKernels.cpp)
+ */
+namespace Maths::Simd
+{
+	/**
+	 * Product of two 2x2 row major matrices stored in one register, A * B
+	 */
+	inline __m128	Mat2Mul(__m128 a, __m128 b) noexcept
+	{
+		return _mm_add_ps(_mm_mul_ps(a, MATHS_SWIZZLE(b, 0, 3, 0, 3)),
+			_mm_mul_ps(MATHS_SWIZZLE(a, 1, 0, 3, 2), MATHS_SWIZZLE(b, 2, 1, 2, 1)));
+	}
+
+	/**
+	 * Product of the adjugate of a 2x2 matrix with another one, A# * B
+	 */
+	inline __m128	Mat2AdjMul(__m128 a, __m128 b) noexcept
+	{
+		return _mm_sub_ps(_mm_mul_ps(MATHS_SWIZZLE(a, 3, 3, 0, 0), b),
+			_mm_mul_ps(MATHS_SWIZZLE(a, 1, 1, 2, 2), MATHS_SWIZZLE(b, 2, 3, 0, 1)));
+	}
+
+	/**
+	 * Product of a 2x2 matrix with the adjugate of another one, A * B#
+	 */
+	inline __m128	Mat2MulAdj(__m128 a, __m128 b) noexcept
+	{
+		return _mm_sub_ps(_mm_mul_ps(a, MATHS_SWIZZLE(b, 3, 0, 3, 0)),
+			_mm_mul_ps(MATHS_SWIZZLE(a, 1, 0, 3, 2), MATHS_SWIZZLE(b, 2, 1, 2, 1)));
+	}
+
+	/**
+	 * Multiply-add of the lanes, a * b + c. Fused when AVX2 is enabled
+	 */
+	inline __m128	MulAdd(__m128 a, __m128 b, __m128 c) noexcept
+	{
+#if MATHS_AVX2
+		return _mm_fmadd_ps(a, b, c);
+#else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+	}
+
+	/**
+	 * Multiplies two 4x4 row major matrices
+	 * @param a: Left matrix
+	 * @param b: Right matrix
+	 * @param result: Array of 16 floats receiving a * b, must not alias a or b
+	 */
+	inline void	Mat4Multiply(const float* a, const float* b, float* result) noexcept
+	{
+#if MATHS_AVX2
+		const __m256	b0{ _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b)) };
+		const __m256	b1{ _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 4)) };
+		const __m256	b2{ _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 8)) };
+		const __m256	b3{ _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 12)) };
+
+		// Two lines of a per iteration, one in each 128 bits lane
+		for (unsigned i{ 0 }; i < 16; i += 8)
+		{
+			const __m256	lines{ _mm256_loadu_ps(a + i) };
+			__m256			r{ _mm256_mul_ps(_mm256_shuffle_ps(lines, lines, 0x00), b0) };
+			r = _mm256_fmadd_ps(_mm256_shuffle_ps(lines, lines, 0x55), b1, r);
+			r = _mm256_fmadd_ps(_mm256_shuffle_ps(lines, lines, 0xAA), b2, r);
+			r = _mm256_fmadd_ps(_mm256_shuffle_ps(lines, lines, 0xFF), b3, r);
+			_mm256_storeu_ps(result + i, r);
+		}
+#else
+		const __m128	b0{ _mm_loadu_ps(b) };
+		const __m128	b1{ _mm_loadu_ps(b + 4) };
+		const __m128	b2{ _mm_loadu_ps(b + 8) };
+		const __m128	b3{ _mm_loadu_ps(b + 12) };
+
+		for (unsigned i{ 0 }; i < 16; i += 4)
+		{
+			const __m128	line{ _mm_loadu_ps(a + i) };
+			__m128			r{ _mm_mul_ps(MATHS_SWIZZLE(line, 0, 0, 0, 0), b0) };
+			r = _mm_add_ps(r, _mm_mul_ps(MATHS_SWIZZLE(line, 1, 1, 1, 1), b1));
+			r = _mm_add_ps(r, _mm_mul_ps(MATHS_SWIZZLE(line, 2, 2, 2, 2), b2));
+			r = _mm_add_ps(r, _mm_mul_ps(MATHS_SWIZZLE(line, 3, 3, 3, 3), b3));
+			_mm_storeu_ps(result + i, r);
+		}
+#endif
+	}
+
+	/**
+	 * Multiplies a 4x4 row major matrix with a column vector
+	 * @param m: Matrix to multiply
+	 * @param v: Array of 4 floats, vector to multiply
+	 * @param result: Array of 4 floats receiving m * v
+	 */
+	inline void	Mat4MultiplyVec4(const float* m, const float* v, float* result) noexcept
+	{
+		const __m128	vec{ _mm_loadu_ps(v) };
+		__m128			l0{ _mm_mul_ps(_mm_loadu_ps(m), vec) };
+		__m128			l1{ _mm_mul_ps(_mm_loadu_ps(m + 4), vec) };
+		__m128			l2{ _mm_mul_ps(_mm_loadu_ps(m + 8), vec) };
+		__m128			l3{ _mm_mul_ps(_mm_loadu_ps(m + 12), vec) };
+
+		// Transposing the products turns the four horizontal sums into vertical adds
+		_MM_TRANSPOSE4_PS(l0, l1, l2, l3);
+		_mm_storeu_ps(result, _mm_add_ps(_mm_add_ps(l0, l1), _mm_add_ps(l2, l3)));
+	}
+
+	/**
+	 * Inverses a 4x4 row major matrix, using the 2x2 block decomposition
+	 * of the matrix. The result is not finite if the matrix is singular
+	 * @param m: Matrix to inverse
+	 * @param result: Array of 16 floats receiving the inverse
+	 */
+	inline void	Mat4Inverse(const float* m, float* result) noexcept
+	{
+		const __m128	l0{ _mm_loadu_ps(m) };
+		const __m128	l1{ _mm_loadu_ps(m + 4) };
+		const __m128	l2{ _mm_loadu_ps(m + 8) };
+		const __m128	l3{ _mm_loadu_ps(m + 12) };
+
+		// 2x2 sub matrices, M = | A B |
+		//                       | C D |
+		const __m128	A{ _mm_movelh_ps(l0, l1) };
+		const __m128	B{ _mm_movehl_ps(l1, l0) };
+		const __m128	C{ _mm_movelh_ps(l2, l3) };
+		const __m128	D{ _mm_movehl_ps(l3, l2) };
+
+		// (|A|, |B|, |C|, |D|)
+		const __m128	detSub{ _mm_sub_ps(
+			_mm_mul_ps(MATHS_SHUFFLE(l0, l2, 0, 2, 0, 2), MATHS_SHUFFLE(l1, l3, 1, 3, 1, 3)),
+			_mm_mul_ps(MATHS_SHUFFLE(l0, l2, 1, 3, 1, 3), MATHS_SHUFFLE(l1, l3, 0, 2, 0, 2))) };
+		const __m128	detA{ MATHS_SWIZZLE(detSub, 0, 0, 0, 0) };
+		const __m128	detB{ MATHS_SWIZZLE(detSub, 1, 1, 1, 1) };
+		const __m128	detC{ MATHS_SWIZZLE(detSub, 2, 2, 2, 2) };
+		const __m128	detD{ MATHS_SWIZZLE(detSub, 3, 3, 3, 3) };
+
+		const __m128	DC{ Mat2AdjMul(D, C) };
+		const __m128	AB{ Mat2AdjMul(A, B) };
+
+		// Adjugates of the blocks of the inverse
+		__m128	X{ _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, DC)) };
+		__m128	W{ _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, AB)) };
+		__m128	Y{ _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, AB)) };
+		__m128	Z{ _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, DC)) };
+
+		// |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+		__m128	tr{ _mm_mul_ps(AB, MATHS_SWIZZLE(DC, 0, 2, 1, 3)) };
+		tr = _mm_add_ps(tr, MATHS_SWIZZLE(tr, 2, 3, 0, 1));
+		tr = _mm_add_ps(tr, MATHS_SWIZZLE(tr, 1, 0, 3, 2));
+		const __m128	detM{ _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr) };
+
+		const __m128	rDetM{ _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), detM) };
+		X = _mm_mul_ps(X, rDetM);
+		Y = _mm_mul_ps(Y, rDetM);
+		Z = _mm_mul_ps(Z, rDetM);
+		W = _mm_mul_ps(W, rDetM);
+
+		// Applies the adjugate shuffle while storing the lines back
+		_mm_storeu_ps(result, MATHS_SHUFFLE(X, Y, 3, 1, 3, 1));
+		_mm_storeu_ps(result + 4, MATHS_SHUFFLE(X, Y, 2, 0, 2, 0));
+		_mm_storeu_ps(result + 8, MATHS_SHUFFLE(Z, W, 3, 1, 3, 1));
+		_mm_storeu_ps(result + 12, MATHS_SHUFFLE(Z, W, 2, 0, 2, 0));
+	}
+
+	/**
+	 * Transforms points or directions stored as separate x, y and z arrays
+	 * by a 4x4 row major matrix, without dividing by w.
+	 * Computes 8 vectors per iteration with AVX2, 4 with SSE
+	 * @param m: Matrix to transform with
+	 * @param x: X components of the vectors
+	 * @param y: Y components of the vectors
+	 * @param z: Z components of the vectors
+	 * @param outX: X components of the results, may be x itself
+	 * @param outY: Y components of the results, may be y itself
+	 * @param outZ: Z components of the results, may be z itself
+	 * @param count: Number of vectors to transform
+	 * @param w: Implicit w component of the vectors, 1 for points and 0 for directions
+	 */
+	inline void	TransformSoA(const float* m, const float* x, const float* y, const float* z,
+		float* outX, float* outY, float* outZ, size_t count, float w) noexcept
+	{
+		size_t	i{ 0 };
+#if MATHS_AVX2
+		{
+			const __m256	m00{ _mm256_set1_ps(m[0]) }, m01{ _mm256_set1_ps(m[1]) }, m02{ _mm256_set1_ps(m[2]) };
+			const __m256	m10{ _mm256_set1_ps(m[4]) }, m11{ _mm256_set1_ps(m[5]) }, m12{ _mm256_set1_ps(m[6]) };
+			const __m256	m20{ _mm256_set1_ps(m[8]) }, m21{ _mm256_set1_ps(m[9]) }, m22{ _mm256_set1_ps(m[10]) };
+			const __m256	t0{ _mm256_set1_ps(m[3] * w) }, t1{ _mm256_set1_ps(m[7] * w) }, t2{ _mm256_set1_ps(m[11] * w) };
+
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256	vx{ _mm256_loadu_ps(x + i) };
+				const __m256	vy{ _mm256_loadu_ps(y + i) };
+				const __m256	vz{ _mm256_loadu_ps(z + i) };
+				_mm256_storeu_ps(outX + i, _mm256_fmadd_ps(m00, vx, _mm256_fmadd_ps(m01, vy, _mm256_fmadd_ps(m02, vz, t0))));
+				_mm256_storeu_ps(outY + i, _mm256_fmadd_ps(m10, vx, _mm256_fmadd_ps(m11, vy, _mm256_fmadd_ps(m12, vz, t1))));
+				_mm256_storeu_ps(outZ + i, _mm256_fmadd_ps(m20, vx, _mm256_fmadd_ps(m21, vy, _mm256_fmadd_ps(m22, vz, t2))));
+			}
+		}
+#endif
+		const __m128	m00{ _mm_set1_ps(m[0]) }, m01{ _mm_set1_ps(m[1]) }, m02{ _mm_set1_ps(m[2]) };
+		const __m128	m10{ _mm_set1_ps(m[4]) }, m11{ _mm_set1_ps(m[5]) }, m12{ _mm_set1_ps(m[6]) };
+		const __m128	m20{ _mm_set1_ps(m[8]) }, m21{ _mm_set1_ps(m[9]) }, m22{ _mm_set1_ps(m[10]) };
+		const __m128	t0{ _mm_set1_ps(m[3] * w) }, t1{ _mm_set1_ps(m[7] * w) }, t2{ _mm_set1_ps(m[11] * w) };
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128	vx{ _mm_loadu_ps(x + i) };
+			const __m128	vy{ _mm_loadu_ps(y + i) };
+			const __m128	vz{ _mm_loadu_ps(z + i) };
+			_mm_storeu_ps(outX + i, MulAdd(m00, vx, MulAdd(m01, vy, MulAdd(m02, vz, t0))));
+			_mm_storeu_ps(outY + i, MulAdd(m10, vx, MulAdd(m11, vy, MulAdd(m12, vz, t1))));
+			_mm_storeu_ps(outZ + i, MulAdd(m20, vx, MulAdd(m21, vy, MulAdd(m22, vz, t2))));
+		}
+
+		for (; i < count; ++i)
+		{
+			const float	vx{ x[i] }, vy{ y[i] }, vz{ z[i] };
+			outX[i] = m[0] * vx + m[1] * vy + m[2] * vz + m[3] * w;
+			outY[i] = m[4] * vx + m[5] * vy + m[6] * vz + m[7] * w;
+			outZ[i] = m[8] * vx + m[9] * vy + m[10] * vz + m[11] * w;
+		}
+	}
+
+	/**
+	 * Loads 4 packed x, y, z triplets and transposes them
+	 * to separate x, y and z registers
+	 * @param v: Array of 12 floats to load
+	 * @param x: Register receiving the x components
+	 * @param y: Register receiving the y components
+	 * @param z: Register receiving the z components
+	 */
+	inline void	LoadVec3x4(const float* v, __m128& x, __m128& y, __m128& z) noexcept
+	{
+		// a = (x0 y0 z0 x1), b = (y1 z1 x2 y2), c = (z2 x3 y3 z3)
+		const __m128	a{ _mm_loadu_ps(v) };
+		const __m128	b{ _mm_loadu_ps(v + 4) };
+		const __m128	c{ _mm_loadu_ps(v + 8) };
+
+		x = MATHS_SHUFFLE(a, MATHS_SHUFFLE(b, c, 2, 2, 1, 1), 0, 3, 0, 2);
+		y = MATHS_SHUFFLE(MATHS_SHUFFLE(a, b, 1, 1, 0, 0), MATHS_SHUFFLE(b, c, 3, 3, 2, 2), 0, 2, 0, 2);
+		z = MATHS_SHUFFLE(MATHS_SHUFFLE(a, b, 2, 2, 1, 1), c, 0, 2, 0, 3);
+	}
+
+	/**
+	 * Packs separate x, y and z registers back to 4 x, y, z triplets
+	 * @param v: Array of 12 floats receiving the triplets
+	 * @param x: X components of the vectors
+	 * @param y: Y components of the vectors
+	 * @param z: Z components of the vectors
+	 */
+	inline void	StoreVec3x4(float* v, __m128 x, __m128 y, __m128 z) noexcept
+	{
+		_mm_storeu_ps(v, MATHS_SHUFFLE(MATHS_SHUFFLE(x, y, 0, 0, 0, 0), MATHS_SHUFFLE(z, x, 0, 0, 1, 1), 0, 2, 0, 2));
+		_mm_storeu_ps(v + 4, MATHS_SHUFFLE(MATHS_SHUFFLE(y, z, 1, 1, 1, 1), MATHS_SHUFFLE(x, y, 2, 2, 2, 2), 0, 2, 0, 2));
+		_mm_storeu_ps(v + 8, MATHS_SHUFFLE(MATHS_SHUFFLE(z, x, 2, 2, 3, 3), MATHS_SHUFFLE(y, z, 3, 3, 3, 3), 0, 2, 0, 2));
+	}
+
+	/**
+	 * Transforms points or directions stored as packed x, y, z triplets
+	 * by a 4x4 row major matrix, without dividing by w. Computes 4 vectors
+	 * per iteration, by transposing them to separate x, y and z registers
+	 * @param m: Matrix to transform with
+	 * @param v: Array of 3 * count floats, vectors to transform
+	 * @param result: Array of 3 * count floats receiving the results, may be v itself
+	 * @param count: Number of vectors to transform
+	 * @param w: Implicit w component of the vectors, 1 for points and 0 for directions
+	 */
+	inline void	TransformVec3(const float* m, const float* v, float* result, size_t count, float w) noexcept
+	{
+		const __m128	m00{ _mm_set1_ps(m[0]) }, m01{ _mm_set1_ps(m[1]) }, m02{ _mm_set1_ps(m[2]) };
+		const __m128	m10{ _mm_set1_ps(m[4]) }, m11{ _mm_set1_ps(m[5]) }, m12{ _mm_set1_ps(m[6]) };
+		const __m128	m20{ _mm_set1_ps(m[8]) }, m21{ _mm_set1_ps(m[9]) }, m22{ _mm_set1_ps(m[10]) };
+		const __m128	t0{ _mm_set1_ps(m[3] * w) }, t1{ _mm_set1_ps(m[7] * w) }, t2{ _mm_set1_ps(m[11] * w) };
+
+		size_t	i{ 0 };
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128	vx, vy, vz;
+			LoadVec3x4(v + i * 3, vx, vy, vz);
+
+			const __m128	rx{ MulAdd(m00, vx, MulAdd(m01, vy, MulAdd(m02, vz, t0))) };
+			const __m128	ry{ MulAdd(m10, vx, MulAdd(m11, vy, MulAdd(m12, vz, t1))) };
+			const __m128	rz{ MulAdd(m20, vx, MulAdd(m21, vy, MulAdd(m22, vz, t2))) };
+
+			StoreVec3x4(result + i * 3, rx, ry, rz);
+		}
+
+		for (; i < count; ++i)
+		{
+			const float	vx{ v[i * 3] }, vy{ v[i * 3 + 1] }, vz{ v[i * 3 + 2] };
+			result[i * 3] = m[0] * vx + m[1] * vy + m[2] * vz + m[3] * w;
+			result[i * 3 + 1] = m[4] * vx + m[5] * vy + m[6] * vz + m[7] * w;
+			result[i * 3 + 2] = m[8] * vx + m[9] * vy + m[10] * vz + m[11] * w;
+		}
+	}
+
+	/**
+	 * Transforms packed 4 components vectors by a 4x4 row major matrix.
+	 * Computes 2 vectors per iteration with AVX2, 1 with SSE
+	 * @param m: Matrix to transform with
+	 * @param v: Array of 4 * count floats, vectors to transform
+	 * @param result: Array of 4 * count floats receiving the results, may be v itself
+	 * @param count: Number of vectors to transform
+	 * @param directions: Whether the w component of the vectors is ignored and taken as 0
+	 */
+	inline void	TransformVec4(const float* m, const float* v, float* result, size_t count, bool directions) noexcept
+	{
+		const __m128	c0{ _mm_setr_ps(m[0], m[4], m[8], m[12]) };
+		const __m128	c1{ _mm_setr_ps(m[1], m[5], m[9], m[13]) };
+		const __m128	c2{ _mm_setr_ps(m[2], m[6], m[10], m[14]) };
+		const __m128	c3{ _mm_setr_ps(m[3], m[7], m[11], m[15]) };
+		// Clears the w lane of the vectors when they are directions
+		const __m128	wMask{ _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, directions ? 0 : -1)) };
+
+		size_t	i{ 0 };
+#if MATHS_AVX2
+		{
+			const __m256	wc0{ _mm256_set_m128(c0, c0) }, wc1{ _mm256_set_m128(c1, c1) };
+			const __m256	wc2{ _mm256_set_m128(c2, c2) }, wc3{ _mm256_set_m128(c3, c3) };
+			const __m256	wideMask{ _mm256_set_m128(wMask, wMask) };
+
+			// One vector in each 128 bits lane
+			for (; i + 2 <= count; i += 2)
+			{
+				const __m256	vec{ _mm256_and_ps(_mm256_loadu_ps(v + i * 4), wideMask) };
+				__m256			r{ _mm256_mul_ps(_mm256_shuffle_ps(vec, vec, 0xFF), wc3) };
+				r = _mm256_fmadd_ps(_mm256_shuffle_ps(vec, vec, 0xAA), wc2, r);
+				r = _mm256_fmadd_ps(_mm256_shuffle_ps(vec, vec, 0x55), wc1, r);
+				r = _mm256_fmadd_ps(_mm256_shuffle_ps(vec, vec, 0x00), wc0, r);
+				_mm256_storeu_ps(result + i * 4, r);
+			}
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			const __m128	vec{ _mm_and_ps(_mm_loadu_ps(v + i * 4), wMask) };
+			__m128			r{ _mm_mul_ps(MATHS_SWIZZLE(vec, 3, 3, 3, 3), c3) };
+			r = MulAdd(MATHS_SWIZZLE(vec, 2, 2, 2, 2), c2, r);
+			r = MulAdd(MATHS_SWIZZLE(vec, 1, 1, 1, 1), c1, r);
+			r = MulAdd(MATHS_SWIZZLE(vec, 0, 0, 0, 0), c0, r);
+			_mm_storeu_ps(result + i * 4, r);
+		}
+	}
+
+	/**
+	 * Rotates vectors stored as packed x, y, z triplets by a unit quaternion,
+	 * with v' = v + w * t + q x t where t = 2 * (q x v).
+	 * Computes 4 vectors per iteration
+	 * @param q: Quaternion components in w, x, y, z order
+	 * @param v: Array of 3 * count floats, vectors to rotate
+	 * @param result: Array of 3 * count floats receiving the results, may be v itself
+	 * @param count: Number of vectors to rotate
+	 */
+	inline void	QuatRotateVec3(const float* q, const float* v, float* result, size_t count) noexcept
+	{
+		const __m128	qw{ _mm_set1_ps(q[0]) }, qx{ _mm_set1_ps(q[1]) }, qy{ _mm_set1_ps(q[2]) }, qz{ _mm_set1_ps(q[3]) };
+		const __m128	two{ _mm_set1_ps(2.f) };
+
+		size_t	i{ 0 };
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128	vx, vy, vz;
+			LoadVec3x4(v + i * 3, vx, vy, vz);
+
+			const __m128	tx{ _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qy, vz), _mm_mul_ps(qz, vy))) };
+			const __m128	ty{ _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qz, vx), _mm_mul_ps(qx, vz))) };
+			const __m128	tz{ _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qx, vy), _mm_mul_ps(qy, vx))) };
+
+			const __m128	rx{ _mm_add_ps(MulAdd(qw, tx, vx), _mm_sub_ps(_mm_mul_ps(qy, tz), _mm_mul_ps(qz, ty))) };
+			const __m128	ry{ _mm_add_ps(MulAdd(qw, ty, vy), _mm_sub_ps(_mm_mul_ps(qz, tx), _mm_mul_ps(qx, tz))) };
+			const __m128	rz{ _mm_add_ps(MulAdd(qw, tz, vz), _mm_sub_ps(_mm_mul_ps(qx, ty), _mm_mul_ps(qy, tx))) };
+
+			StoreVec3x4(result + i * 3, rx, ry, rz);
+		}
+
+		for (; i < count; ++i)
+		{
+			const float	vx{ v[i * 3] }, vy{ v[i * 3 + 1] }, vz{ v[i * 3 + 2] };
+			const float	tx{ 2.f * (q[2] * vz - q[3] * vy) };
+			const float	ty{ 2.f * (q[3] * vx - q[1] * vz) };
+			const float	tz{ 2.f * (q[1] * vy - q[2] * vx) };
+			result[i * 3] = vx + q[0] * tx + q[2] * tz - q[3] * ty;
+			result[i * 3 + 1] = vy + q[0] * ty + q[3] * tx - q[1] * tz;
+			result[i * 3 + 2] = vz + q[0] * tz + q[1] * ty - q[2] * tx;
+		}
+	}
+
+	/**
+	 * Substracts an origin from double vectors stored as packed x, y, z triplets
+	 * and converts the results to floats. The substraction is done in double
+	 * so that the results keep the full float precision near the origin.
+	 * Computes 4 vectors per iteration
+	 * @param v: Array of 3 * count doubles, vectors to rebase
+	 * @param origin: x, y, z of the origin
+	 * @param result: Array of 3 * count floats receiving the results
+	 * @param count: Number of vectors to rebase
+	 */
+	inline void	RebaseVec3d(const double* v, const double* origin, float* result, size_t count) noexcept
+	{
+		size_t	i{ 0 };
+#if MATHS_AVX2
+		// 4 vectors are 3 registers of 4 doubles, the origin repeats every 3 doubles
+		const __m256d	o0{ _mm256_setr_pd(origin[0], origin[1], origin[2], origin[0]) };
+		const __m256d	o1{ _mm256_setr_pd(origin[1], origin[2], origin[0], origin[1]) };
+		const __m256d	o2{ _mm256_setr_pd(origin[2], origin[0], origin[1], origin[2]) };
+		for (; i + 4 <= count; i += 4)
+		{
+			const double*	src{ v + i * 3 };
+			float*			dst{ result + i * 3 };
+			_mm_storeu_ps(dst, _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(src), o0)));
+			_mm_storeu_ps(dst + 4, _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(src + 4), o1)));
+			_mm_storeu_ps(dst + 8, _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(src + 8), o2)));
+		}
+#else
+		// 4 vectors are 6 registers of 2 doubles, the origin repeats every 3 registers
+		const __m128d	o0{ _mm_setr_pd(origin[0], origin[1]) };
+		const __m128d	o1{ _mm_setr_pd(origin[2], origin[0]) };
+		const __m128d	o2{ _mm_setr_pd(origin[1], origin[2]) };
+		for (; i + 4 <= count; i += 4)
+		{
+			const double*	src{ v + i * 3 };
+			float*			dst{ result + i * 3 };
+			const __m128	r0{ _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src), o0)) };
+			const __m128	r1{ _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src + 2), o1)) };
+			const __m128	r2{ _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src + 4), o2)) };
+			const __m128	r3{ _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src + 6), o0)) };
+			const __m128	r4{ _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src + 8), o1)) };
+			const __m128	r5{ _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src + 10), o2)) };
+			_mm_storeu_ps(dst, _mm_movelh_ps(r0, r1));
+			_mm_storeu_ps(dst + 4, _mm_movelh_ps(r2, r3));
+			_mm_storeu_ps(dst + 8, _mm_movelh_ps(r4, r5));
+		}
+#endif
+
+		for (; i < count; ++i)
+			for (unsigned c{ 0 }; c < 3; ++c)
+				result[i * 3 + c] = static_cast<float>(v[i * 3 + c] - origin[c]);
+	}
+
+	/**
+	 * Corrects the progress of a nlerp so that it follows a slerp,
+	 * with the polynomial fit of Zeux's "Approximating slerp"
+	 * @param d: Absolute value of the dot product of the two quaternions
+	 * @param t: Progress of the interpolation
+	 * @return Corrected progress
+	 */
+	inline float	SlerpCorrection(float d, float t) noexcept
+	{
+		const float	a{ 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f)) };
+		const float	b{ 0.848013f + d * (-1.06021f + d * 0.215638f) };
+		const float	k{ a * (t - 0.5f) * (t - 0.5f) + b };
+		return t + t * (t - 0.5f) * (t - 1.f) * k;
+	}
+
+	/**
+	 * Interpolates pairs of quaternions stored as separate w, x, y, z arrays,
+	 * taking the shortest path and normalizing the results.
+	 * Computes 8 quaternions per iteration with AVX2, 4 with SSE
+	 * @param a: Component arrays of the start quaternions, in w, x, y, z order
+	 * @param b: Component arrays of the end quaternions, in w, x, y, z order
+	 * @param t: Progress of each interpolation
+	 * @param result: Component arrays receiving the results, may be a or b
+	 * @param count: Number of quaternions to interpolate
+	 * @param slerp: Whether the progress is corrected to follow a slerp
+	 */
+	inline void	QuatLerpSoA(const float* const a[4], const float* const b[4], const float* t,
+		float* const result[4], size_t count, bool slerp) noexcept
+	{
+		size_t	i{ 0 };
+#if MATHS_AVX2
+		{
+			const __m256	signMask{ _mm256_set1_ps(-0.f) };
+			const __m256	one{ _mm256_set1_ps(1.f) }, half{ _mm256_set1_ps(0.5f) };
+
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256	qa[4], qb[4];
+				for (unsigned c{ 0 }; c < 4; ++c)
+				{
+					qa[c] = _mm256_loadu_ps(a[c] + i);
+					qb[c] = _mm256_loadu_ps(b[c] + i);
+				}
+
+				__m256	dot{ _mm256_mul_ps(qa[0], qb[0]) };
+				dot = _mm256_fmadd_ps(qa[1], qb[1], dot);
+				dot = _mm256_fmadd_ps(qa[2], qb[2], dot);
+				dot = _mm256_fmadd_ps(qa[3], qb[3], dot);
+
+				// Flips b when the dot is negative to take the shortest path
+				const __m256	sign{ _mm256_and_ps(dot, signMask) };
+				__m256			progress{ _mm256_loadu_ps(t + i) };
+				if (slerp)
+				{
+					const __m256	d{ _mm256_andnot_ps(signMask, dot) };
+					const __m256	ka{ _mm256_fmadd_ps(d, _mm256_fmadd_ps(d, _mm256_fnmadd_ps(d, _mm256_set1_ps(1.43519f), _mm256_set1_ps(3.55645f)), _mm256_set1_ps(-3.2452f)), _mm256_set1_ps(1.0904f)) };
+					const __m256	kb{ _mm256_fmadd_ps(d, _mm256_fmadd_ps(d, _mm256_set1_ps(0.215638f), _mm256_set1_ps(-1.06021f)), _mm256_set1_ps(0.848013f)) };
+					const __m256	centered{ _mm256_sub_ps(progress, half) };
+					const __m256	k{ _mm256_fmadd_ps(_mm256_mul_ps(ka, centered), centered, kb) };
+					progress = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_mul_ps(progress, centered), _mm256_sub_ps(progress, one)), k, progress);
+				}
+
+				const __m256	wa{ _mm256_sub_ps(one, progress) };
+				const __m256	wb{ _mm256_xor_ps(progress, sign) };
+				__m256			len{ _mm256_setzero_ps() };
+				for (unsigned c{ 0 }; c < 4; ++c)
+				{
+					qa[c] = _mm256_fmadd_ps(qa[c], wa, _mm256_mul_ps(qb[c], wb));
+					len = _mm256_fmadd_ps(qa[c], qa[c], len);
+				}
+
+				len = _mm256_sqrt_ps(len);
+				for (unsigned c{ 0 }; c < 4; ++c)
+					_mm256_storeu_ps(result[c] + i, _mm256_div_ps(qa[c], len));
+			}
+		}
+#endif
+		const __m128	signMask{ _mm_set1_ps(-0.f) };
+		const __m128	one{ _mm_set1_ps(1.f) }, half{ _mm_set1_ps(0.5f) };
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128	qa[4], qb[4];
+			for (unsigned c{ 0 }; c < 4; ++c)
+			{
+				qa[c] = _mm_loadu_ps(a[c] + i);
+				qb[c] = _mm_loadu_ps(b[c] + i);
+			}
+
+			__m128	dot{ _mm_mul_ps(qa[0], qb[0]) };
+			dot = MulAdd(qa[1], qb[1], dot);
+			dot = MulAdd(qa[2], qb[2], dot);
+			dot = MulAdd(qa[3], qb[3], dot);
+
+			// Flips b when the dot is negative to take the shortest path
+			const __m128	sign{ _mm_and_ps(dot, signMask) };
+			__m128			progress{ _mm_loadu_ps(t + i) };
+			if (slerp)
+			{
+				const __m128	d{ _mm_andnot_ps(signMask, dot) };
+				const __m128	ka{ MulAdd(d, MulAdd(d, _mm_sub_ps(_mm_set1_ps(3.55645f), _mm_mul_ps(d, _mm_set1_ps(1.43519f))), _mm_set1_ps(-3.2452f)), _mm_set1_ps(1.0904f)) };
+				const __m128	kb{ MulAdd(d, MulAdd(d, _mm_set1_ps(0.215638f), _mm_set1_ps(-1.06021f)), _mm_set1_ps(0.848013f)) };
+				const __m128	centered{ _mm_sub_ps(progress, half) };
+				const __m128	k{ MulAdd(_mm_mul_ps(ka, centered), centered, kb) };
+				progress = MulAdd(_mm_mul_ps(_mm_mul_ps(progress, centered), _mm_sub_ps(progress, one)), k, progress);
+			}
+
+			const __m128	wa{ _mm_sub_ps(one, progress) };
+			const __m128	wb{ _mm_xor_ps(progress, sign) };
+			__m128			len{ _mm_setzero_ps() };
+			for (unsigned c{ 0 }; c < 4; ++c)
+			{
+				qa[c] = MulAdd(qa[c], wa, _mm_mul_ps(qb[c], wb));
+				len = MulAdd(qa[c], qa[c], len);
+			}
+
+			len = _mm_sqrt_ps(len);
+			for (unsigned c{ 0 }; c < 4; ++c)
+				_mm_storeu_ps(result[c] + i, _mm_div_ps(qa[c], len));
+		}
+
+		for (; i < count; ++i)
+		{
+			const float	dot{ a[0][i] * b[0][i] + a[1][i] * b[1][i] + a[2][i] * b[2][i] + a[3][i] * b[3][i] };
+			const float	progress{ slerp ? SlerpCorrection(dot < 0.f ? -dot : dot, t[i]) : t[i] };
+			const float	wa{ 1.f - progress };
+			const float	wb{ dot < 0.f ? -progress : progress };
+
+			float	q[4], len{ 0.f };
+			for (unsigned c{ 0 }; c < 4; ++c)
+			{
+				q[c] = a[c][i] * wa + b[c][i] * wb;
+				len += q[c] * q[c];
+			}
+
+			len = std::sqrt(len);
+			for (unsigned c{ 0 }; c < 4; ++c)
+				result[c][i] = q[c] / len;
+		}
+	}
+}
+#endif
+
+/**
+ * Widest float register of the build, used by the kernels written once
+ * for every instruction set (Vec3Stream). Falls back to a
+ * single float when MATHS_SSE is not defined
+ */
+namespace Maths::Simd
+{
+#if MATHS_AVX2
+	using Wide = __m256;
+	inline constexpr size_t WideWidth{ 8 };
+
+	inline Wide	WideLoad(const float* p) noexcept { return _mm256_loadu_ps(p); }
+	inline void	WideStore(float* p, Wide a) noexcept { _mm256_storeu_ps(p, a); }
+	inline Wide	WideSet(float f) noexcept { return _mm256_set1_ps(f); }
+	inline Wide	WideAdd(Wide a, Wide b) noexcept { return _mm256_add_ps(a, b); }
+	inline Wide	WideSub(Wide a, Wide b) noexcept { return _mm256_sub_ps(a, b); }
+	inline Wide	WideMul(Wide a, Wide b) noexcept { return _mm256_mul_ps(a, b); }
+	inline Wide	WideDiv(Wide a, Wide b) noexcept { return _mm256_div_ps(a, b); }
+	inline Wide	WideMulAdd(Wide a, Wide b, Wide c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+	inline Wide	WideSqrt(Wide a) noexcept { return _mm256_sqrt_ps(a); }
+	inline Wide	WideMin(Wide a, Wide b) noexcept { return _mm256_min_ps(a, b); }
+	inline Wide	WideMax(Wide a, Wide b) noexcept { return _mm256_max_ps(a, b); }
+	inline unsigned	WideSignMask(Wide a) noexcept { return static_cast<unsigned>(_mm256_movemask_ps(a)); }
+#elif MATHS_SSE
+	using Wide = __m128;
+	inline constexpr size_t WideWidth{ 4 };
+
+	inline Wide	WideLoad(const float* p) noexcept { return _mm_loadu_ps(p); }
+	inline void	WideStore(float* p, Wide a) noexcept { _mm_storeu_ps(p, a); }
+	inline Wide	WideSet(float f) noexcept { return _mm_set1_ps(f); }
+	inline Wide	WideAdd(Wide a, Wide b) noexcept { return _mm_add_ps(a, b); }
+	inline Wide	WideSub(Wide a, Wide b) noexcept { return _mm_sub_ps(a, b); }
+	inline Wide	WideMul(Wide a, Wide b) noexcept { return _mm_mul_ps(a, b); }
+	inline Wide	WideDiv(Wide a, Wide b) noexcept { return _mm_div_ps(a, b); }
+	inline Wide	WideMulAdd(Wide a, Wide b, Wide c) noexcept { return MulAdd(a, b, c); }
+	inline Wide	WideSqrt(Wide a) noexcept { return _mm_sqrt_ps(a); }
+	inline Wide	WideMin(Wide a, Wide b) noexcept { return _mm_min_ps(a, b); }
+	inline Wide	WideMax(Wide a, Wide b) noexcept { return _mm_max_ps(a, b); }
+	inline unsigned	WideSignMask(Wide a) noexcept { return static_cast<unsigned>(_mm_movemask_ps(a)); }
+#else
+	using Wide = float;
+	inline constexpr size_t WideWidth{ 1 };
+
+	inline Wide	WideLoad(const float* p) noexcept { return *p; }
+	inline void	WideStore(float* p, Wide a) noexcept { *p = a; }
+	inline Wide	WideSet(float f) noexcept { return f; }
+	inline Wide	WideAdd(Wide a, Wide b) noexcept { return a + b; }
+	inline Wide	WideSub(Wide a, Wide b) noexcept { return a - b; }
+	inline Wide	WideMul(Wide a, Wide b) noexcept { return a * b; }
+	inline Wide	WideDiv(Wide a, Wide b) noexcept { return a / b; }
+	inline Wide	WideMulAdd(Wide a, Wide b, Wide c) noexcept { return a * b + c; }
+	inline Wide	WideSqrt(Wide a) noexcept { return std::sqrt(a); }
+	// Same as the instructions, b is returned when a value is NaN
+	inline Wide	WideMin(Wide a, Wide b) noexcept { return a < b ? a : b; }
+	inline Wide	WideMax(Wide a, Wide b) noexcept { return a > b ? a : b; }
+	inline unsigned	WideSignMask(Wide a) noexcept { return std::signbit(a) ? 1u : 0u; }
+#endif
+
+	/**
+	 * Operations on a block of floats for the SoA kernels templated over their block
+	 * type (float, __m128 or __m256), so that the engine can compile them once per
+	 * instruction set and pick one at runtime (see SimdKernels.cpp). The Wide
+	 * functions above are not used there: they change with the build flags, and
+	 * their AVX2 version would leak out of the translation unit compiled with AVX2,
+	 * private member you're not supposed to use
+	 */
+	template <typename W>
+	struct WideTraits_IMPL;
+
+	template <>
+	struct WideTraits_IMPL<float>
+	{
+		static constexpr size_t	WIDTH{ 1 };
+
+		static float	Load(const float* p) noexcept { return *p; }
+		static void		Store(float* p, float a) noexcept { *p = a; }
+		static float	Set(float f) noexcept { return f; }
+		static float	Add(float a, float b) noexcept { return a + b; }
+		static float	Sub(float a, float b) noexcept { return a - b; }
+		static float	Mul(float a, float b) noexcept { return a * b; }
+		static float	MulAdd(float a, float b, float c) noexcept { return a * b + c; }
+		// Same as the instructions, b is returned when a value is NaN
+		static float	Min(float a, float b) noexcept { return a < b ? a : b; }
+		static float	Max(float a, float b) noexcept { return a > b ? a : b; }
+		static unsigned	SignMask(float a) noexcept { return std::signbit(a) ? 1u : 0u; }
+	};
+
+#if MATHS_SSE
+	template <>
+	struct WideTraits_IMPL<__m128>
+	{
+		static constexpr size_t	WIDTH{ 4 };
+
+		static __m128	Load(const float* p) noexcept { return _mm_loadu_ps(p); }
+		static void		Store(float* p, __m128 a) noexcept { _mm_storeu_ps(p, a); }
+		static __m128	Set(float f) noexcept { return _mm_set1_ps(f); }
+		static __m128	Add(__m128 a, __m128 b) noexcept { return _mm_add_ps(a, b); }
+		static __m128	Sub(__m128 a, __m128 b) noexcept { return _mm_sub_ps(a, b); }
+		static __m128	Mul(__m128 a, __m128 b) noexcept { return _mm_mul_ps(a, b); }
+		static __m128	MulAdd(__m128 a, __m128 b, __m128 c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+		static __m128	Min(__m128 a, __m128 b) noexcept { return _mm_min_ps(a, b); }
+		static __m128	Max(__m128 a, __m128 b) noexcept { return _mm_max_ps(a, b); }
+		static unsigned	SignMask(__m128 a) noexcept { return static_cast<unsigned>(_mm_movemask_ps(a)); }
+	};
+#endif
+
+#if MATHS_AVX2
+	template <>
+	struct WideTraits_IMPL<__m256>
+	{
+		static constexpr size_t	WIDTH{ 8 };
+
+		static __m256	Load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+		static void		Store(float* p, __m256 a) noexcept { _mm256_storeu_ps(p, a); }
+		static __m256	Set(float f) noexcept { return _mm256_set1_ps(f); }
+		static __m256	Add(__m256 a, __m256 b) noexcept { return _mm256_add_ps(a, b); }
+		static __m256	Sub(__m256 a, __m256 b) noexcept { return _mm256_sub_ps(a, b); }
+		static __m256	Mul(__m256 a, __m256 b) noexcept { return _mm256_mul_ps(a, b); }
+		static __m256	MulAdd(__m256 a, __m256 b, __m256 c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+		static __m256	Min(__m256 a, __m256 b) noexcept { return _mm256_min_ps(a, b); }
+		static __m256	Max(__m256 a, __m256 b) noexcept { return _mm256_max_ps(a, b); }
+		static unsigned	SignMask(__m256 a) noexcept { return static_cast<unsigned>(_mm256_movemask_ps(a)); }
+	};
+#endif
+
+	/**
+	 * Appends to indices the lanes of a block whose value is positive (sign bit cleared),
+	 * which is how the culling and intersection kernels give their results
+	 * @param value: Value of each lane
+	 * @param first: Index of the first lane
+	 * @param lanes: Number of valid lanes in the block
+	 * @param indices: Array of indices to append to
+	 * @param indexCount: Number of indices in indices, incremented for each positive lane
+	 */
+	template <typename W>
+	inline void	AppendPositive(W value, size_t first, size_t lanes, unsigned* indices, size_t& indexCount) noexcept
+	{
+		unsigned	mask{ ~WideTraits_IMPL<W>::SignMask(value) & ((1u << lanes) - 1u) };
+		for (; mask != 0; mask &= mask - 1)
+			indices[indexCount++] = static_cast<unsigned>(first + std::countr_zero(mask));
+	}
+
+	/**
+	 * Culls axis aligned boxes stored in SoA against 6 planes. A box is visible when,
+	 * for every plane, its corner furthest along the plane normal is in front of the plane.
+	 * Dispatched at runtime by the engine: 8 boxes at a time on AVX2 CPUs, 4 with SSE
+	 * otherwise. Defined in SimdKernels.cpp
+	 * @param planes: Planes as (normal, distance), p is in front when dot(normal, p) + distance >= 0
+	 * @param min: x, y and z arrays of the minimum corners of the boxes
+	 * @param max: x, y and z arrays of the maximum corners of the boxes
+	 * @param count: Number of boxes
+	 * @param visible: Receives the indices of the visible boxes in increasing order, at least of count
+	 * @return Number of visible boxes
+	 */
+	size_t	CullAabbSoA(const float (&planes)[6][4], const float* const min[3], const float* const max[3],
+						size_t count, unsigned* visible) noexcept;
+
+	/**
+	 * Culls spheres stored in SoA against 6 normalized planes. A sphere is visible when
+	 * its center is at most radius behind every plane. Dispatched at runtime by the
+	 * engine: 8 spheres at a time on AVX2 CPUs, 4 with SSE otherwise. Defined in SimdKernels.cpp
+	 * @param planes: Planes as (unit normal, distance), p is in front when dot(normal, p) + distance >= 0
+	 * @param center: x, y and z arrays of the centers of the spheres
+	 * @param radius: Array of the radii of the spheres
+	 * @param count: Number of spheres
+	 * @param visible: Receives the indices of the visible spheres in increasing order, at least of count
+	 * @return Number of visible spheres
+	 */
+	size_t	CullSphereSoA(const float (&planes)[6][4], const float* const center[3], const float* radius,
+						  size_t count, unsigned* visible) noexcept;
+
+	/**
+	 * Implementation of CullAabbSoA(), WideTraits_IMPL<W>::WIDTH boxes at a time,
+	 * private member you're not supposed to use
+	 * @tparam W: Block of floats, float, __m128 or __m256
+	 */
+	template <typename W>
+	inline size_t	CullAabbSoA_IMPL(const float (&planes)[6][4], const float* const min[3], const float* const max[3],
+									 size_t count, unsigned* visible) noexcept
+	{
+		using T = WideTraits_IMPL<W>;
+
+		W	normals[6][4];
+		for (unsigned p{ 0 }; p < 6; ++p)
+			for (unsigned c{ 0 }; c < 4; ++c)
+				normals[p][c] = T::Set(planes[p][c]);
+
+		// Takes the boxes from first in corners, that hold (min, max) per component
+		auto nearestDistance = [&](const float* const (&corners)[3][2], size_t first) noexcept
+		{
+			W	nearest{ T::Set(std::numeric_limits<float>::max()) };
+			for (unsigned p{ 0 }; p < 6; ++p)
+			{
+				W	distance{ normals[p][3] };
+				for (unsigned c{ 0 }; c < 3; ++c)
+					distance = T::MulAdd(normals[p][c], T::Load(corners[c][planes[p][c] >= 0.f] + first), distance);
+				nearest = T::Min(nearest, distance);
+			}
+			return nearest;
+		};
+
+		const float* const	corners[3][2]{ { min[0], max[0] }, { min[1], max[1] }, { min[2], max[2] } };
+		size_t	visibleCount{ 0 };
+		size_t	i{ 0 };
+		for (; i + T::WIDTH <= count; i += T::WIDTH)
+			AppendPositive(nearestDistance(corners, i), i, T::WIDTH, visible, visibleCount);
+
+		if (i < count)
+		{
+			// Last boxes are copied to a full block, the lanes past count are masked out
+			float	tail[3][2][T::WIDTH]{};
+			for (size_t j{ i }; j < count; ++j)
+				for (unsigned c{ 0 }; c < 3; ++c)
+				{
+					tail[c][0][j - i] = min[c][j];
+					tail[c][1][j - i] = max[c][j];
+				}
+			const float* const	tailCorners[3][2]{ { tail[0][0], tail[0][1] }, { tail[1][0], tail[1][1] }, { tail[2][0], tail[2][1] } };
+			AppendPositive(nearestDistance(tailCorners, 0), i, count - i, visible, visibleCount);
+		}
+		return visibleCount;
+	}
+
+	/**
+	 * Implementation of CullSphereSoA(), WideTraits_IMPL<W>::WIDTH spheres at a time,
+	 * private member you're not supposed to use
+	 * @tparam W: Block of floats, float, __m128 or __m256
+	 */
+	template <typename W>
+	inline size_t	CullSphereSoA_IMPL(const float (&planes)[6][4], const float* const center[3], const float* radius,
+									   size_t count, unsigned* visible) noexcept
+	{
+		using T = WideTraits_IMPL<W>;
+
+		W	normals[6][4];
+		for (unsigned p{ 0 }; p < 6; ++p)
+			for (unsigned c{ 0 }; c < 4; ++c)
+				normals[p][c] = T::Set(planes[p][c]);
+
+		auto nearestDistance = [&](const float* const (&spheres)[4], size_t first) noexcept
+		{
+			const W	x{ T::Load(spheres[0] + first) }, y{ T::Load(spheres[1] + first) }, z{ T::Load(spheres[2] + first) };
+			W	nearest{ T::Set(std::numeric_limits<float>::max()) };
+			for (unsigned p{ 0 }; p < 6; ++p)
+			{
+				const W	distance{ T::MulAdd(normals[p][0], x, T::MulAdd(normals[p][1], y, T::MulAdd(normals[p][2], z, normals[p][3]))) };
+				nearest = T::Min(nearest, distance);
+			}
+			return T::Add(nearest, T::Load(spheres[3] + first));
+		};
+
+		const float* const	spheres[4]{ center[0], center[1], center[2], radius };
+		size_t	visibleCount{ 0 };
+		size_t	i{ 0 };
+		for (; i + T::WIDTH <= count; i += T::WIDTH)
+			AppendPositive(nearestDistance(spheres, i), i, T::WIDTH, visible, visibleCount);
+
+		if (i < count)
+		{
+			// Last spheres are copied to a full block, the lanes past count are masked out
+			float	tail[4][T::WIDTH]{};
+			for (size_t j{ i }; j < count; ++j)
+				for (unsigned c{ 0 }; c < 4; ++c)
+					tail[c][j - i] = spheres[c][j];
+			const float* const	tailSpheres[4]{ tail[0], tail[1], tail[2], tail[3] };
+			AppendPositive(nearestDistance(tailSpheres, 0), i, count - i, visible, visibleCount);
+		}
+		return visibleCount;
+	}
+
+	/**
+	 * Tests a ray against axis aligned boxes stored in SoA with the slab test, 8 boxes at a
+	 * time on AVX2 CPUs and 4 with SSE otherwise, dispatched at runtime by the engine.
+	 * Defined in SimdKernels.cpp
+	 * @param origin: Origin of the ray
+	 * @param invDirection: Inverse of each component of the ray direction
+	 * @param maxDistance: Distance along the ray after which the boxes are missed
+	 * @param min: x, y and z arrays of the minimum corners of the boxes
+	 * @param max: x, y and z arrays of the maximum corners of the boxes
+	 * @param count: Number of boxes
+	 * @param hits: Receives the indices of the boxes hit in increasing order, at least of count
+	 * @param distances: Receives the entry distance of each hit, 0 when the origin is inside.
+	 * May be nullptr, at least of count otherwise
+	 * @return Number of boxes hit
+	 */
+	size_t	RayAabbSoA(const float (&origin)[3], const float (&invDirection)[3], float maxDistance,
+					   const float* const min[3], const float* const max[3], size_t count,
+					   unsigned* hits, float* distances) noexcept;
+
+	/**
+	 * Tests a sphere against axis aligned boxes stored in SoA, 8 boxes at a time on AVX2
+	 * CPUs and 4 with SSE otherwise, dispatched at runtime by the engine. Defined in
+	 * SimdKernels.cpp. A box overlaps when its closest point to the center is within the radius
+	 * @param center: Center of the sphere
+	 * @param radius: Radius of the sphere
+	 * @param min: x, y and z arrays of the minimum corners of the boxes
+	 * @param max: x, y and z arrays of the maximum corners of the boxes
+	 * @param count: Number of boxes
+	 * @param hits: Receives the indices of the overlapping boxes in increasing order, at least of count
+	 * @return Number of overlapping boxes
+	 */
+	size_t	SphereAabbSoA(const float (&center)[3], float radius, const float* const min[3], const float* const max[3],
+						  size_t count, unsigned* hits) noexcept;
+
+	/**
+	 * Tests an axis aligned box against axis aligned boxes stored in SoA, 8 boxes at a time
+	 * on AVX2 CPUs and 4 with SSE otherwise, dispatched at runtime by the engine. Defined
+	 * in SimdKernels.cpp
+	 * @param queryMin: Minimum corner of the tested box
+	 * @param queryMax: Maximum corner of the tested box
+	 * @param min: x, y and z arrays of the minimum corners of the boxes
+	 * @param max: x, y and z arrays of the maximum corners of the boxes
+	 * @param count: Number of boxes
+	 * @param hits: Receives the indices of the overlapping boxes in increasing order, at least of count
+	 * @return Number of overlapping boxes
+	 */
+	size_t	AabbAabbSoA(const float (&queryMin)[3], const float (&queryMax)[3], const float* const min[3],
+						const float* const max[3], size_t count, unsigned* hits) noexcept;
+
+	/**
+	 * Implementation of RayAabbSoA(), WideTraits_IMPL<W>::WIDTH boxes at a time,
+	 * private member you're not supposed to use
+	 * @tparam W: Block of floats, float, __m128 or __m256
+	 */
+	template <typename W>
+	inline size_t	RayAabbSoA_IMPL(const float (&origin)[3], const float (&invDirection)[3], float maxDistance,
+									const float* const min[3], const float* const max[3], size_t count,
+									unsigned* hits, float* distances) noexcept
+	{
+		using T = WideTraits_IMPL<W>;
+
+		const W	o[3]{ T::Set(origin[0]), T::Set(origin[1]), T::Set(origin[2]) };
+		const W	inv[3]{ T::Set(invDirection[0]), T::Set(invDirection[1]), T::Set(invDirection[2]) };
+		const W	zero{ T::Set(0.f) };
+		const W	tMax{ T::Set(maxDistance) };
+
+		// Starting the interval at [0, maxDistance] rejects the boxes behind or too far,
+		// the slab distances are the first operands so that NaN slabs are ignored
+		auto slabs = [&](const float* const (&boxes)[3][2], size_t offset, size_t first, size_t lanes, size_t& hitCount) noexcept
+		{
+			W	nearT{ zero }, farT{ tMax };
+			for (unsigned c{ 0 }; c < 3; ++c)
+			{
+				const W	t1{ T::Mul(T::Sub(T::Load(boxes[c][0] + offset), o[c]), inv[c]) };
+				const W	t2{ T::Mul(T::Sub(T::Load(boxes[c][1] + offset), o[c]), inv[c]) };
+				nearT = T::Max(T::Min(t1, t2), nearT);
+				farT = T::Min(T::Max(t1, t2), farT);
+			}
+
+			const size_t	previous{ hitCount };
+			AppendPositive(T::Sub(farT, nearT), first, lanes, hits, hitCount);
+			if (distances != nullptr && hitCount != previous)
+			{
+				float	entry[T::WIDTH];
+				T::Store(entry, nearT);
+				for (size_t h{ previous }; h < hitCount; ++h)
+					distances[h] = entry[hits[h] - first];
+			}
+		};
+
+		const float* const	boxes[3][2]{ { min[0], max[0] }, { min[1], max[1] }, { min[2], max[2] } };
+		size_t	hitCount{ 0 };
+		size_t	i{ 0 };
+		for (; i + T::WIDTH <= count; i += T::WIDTH)
+			slabs(boxes, i, i, T::WIDTH, hitCount);
+
+		if (i < count)
+		{
+			// Last boxes are copied to a full block, the lanes past count are masked out
+			float	tail[3][2][T::WIDTH]{};
+			for (size_t j{ i }; j < count; ++j)
+				for (unsigned c{ 0 }; c < 3; ++c)
+				{
+					tail[c][0][j - i] = min[c][j];
+					tail[c][1][j - i] = max[c][j];
+				}
+			const float* const	tailBoxes[3][2]{ { tail[0][0], tail[0][1] }, { tail[1][0], tail[1][1] }, { tail[2][0], tail[2][1] } };
+			slabs(tailBoxes, 0, i, count - i, hitCount);
+		}
+		return hitCount;
+	}
+
+	/**
+	 * Implementation of SphereAabbSoA(), WideTraits_IMPL<W>::WIDTH boxes at a time,
+	 * private member you're not supposed to use
+	 * @tparam W: Block of floats, float, __m128 or __m256
+	 */
+	template <typename W>
+	inline size_t	SphereAabbSoA_IMPL(const float (&center)[3], float radius, const float* const min[3], const float* const max[3],
+									   size_t count, unsigned* hits) noexcept
+	{
+		using T = WideTraits_IMPL<W>;
+
+		const W	c[3]{ T::Set(center[0]), T::Set(center[1]), T::Set(center[2]) };
+		const W	zero{ T::Set(0.f) };
+		const W	sqrRadius{ T::Set(radius * radius) };
+
+		auto margin = [&](const float* const (&boxes)[3][2], size_t first) noexcept
+		{
+			W	sqrDistance{ zero };
+			for (unsigned a{ 0 }; a < 3; ++a)
+			{
+				const W	below{ T::Sub(T::Load(boxes[a][0] + first), c[a]) };
+				const W	above{ T::Sub(c[a], T::Load(boxes[a][1] + first)) };
+				const W	outside{ T::Max(T::Max(below, above), zero) };
+				sqrDistance = T::MulAdd(outside, outside, sqrDistance);
+			}
+			return T::Sub(sqrRadius, sqrDistance);
+		};
+
+		const float* const	boxes[3][2]{ { min[0], max[0] }, { min[1], max[1] }, { min[2], max[2] } };
+		size_t	hitCount{ 0 };
+		size_t	i{ 0 };
+		for (; i + T::WIDTH <= count; i += T::WIDTH)
+			AppendPositive(margin(boxes, i), i, T::WIDTH, hits, hitCount);
+
+		if (i < count)
+		{
+			float	tail[3][2][T::WIDTH]{};
+			for (size_t j{ i }; j < count; ++j)
+				for (unsigned a{ 0 }; a < 3; ++a)
+				{
+					tail[a][0][j - i] = min[a][j];
+					tail[a][1][j - i] = max[a][j];
+				}
+			const float* const	tailBoxes[3][2]{ { tail[0][0], tail[0][1] }, { tail[1][0], tail[1][1] }, { tail[2][0], tail[2][1] } };
+			AppendPositive(margin(tailBoxes, 0), i, count - i, hits, hitCount);
+		}
+		return hitCount;
+	}
+
+	/**
+	 * Implementation of AabbAabbSoA(), WideTraits_IMPL<W>::WIDTH boxes at a time,
+	 * private member you're not supposed to use
+	 * @tparam W: Block of floats, float, __m128 or __m256
+	 */
+	template <typename W>
+	inline size_t	AabbAabbSoA_IMPL(const float (&queryMin)[3], const float (&queryMax)[3], const float* const min[3],
+									 const float* const max[3], size_t count, unsigned* hits) noexcept
+	{
+		using T = WideTraits_IMPL<W>;
+
+		const W	qMin[3]{ T::Set(queryMin[0]), T::Set(queryMin[1]), T::Set(queryMin[2]) };
+		const W	qMax[3]{ T::Set(queryMax[0]), T::Set(queryMax[1]), T::Set(queryMax[2]) };
+
+		// Smallest overlap over the axes, negative when separated
+		auto overlap = [&](const float* const (&boxes)[3][2], size_t first) noexcept
+		{
+			W	smallest{ T::Set(std::numeric_limits<float>::max()) };
+			for (unsigned a{ 0 }; a < 3; ++a)
+			{
+				smallest = T::Min(smallest, T::Sub(qMax[a], T::Load(boxes[a][0] + first)));
+				smallest = T::Min(smallest, T::Sub(T::Load(boxes[a][1] + first), qMin[a]));
+			}
+			return smallest;
+		};
+
+		const float* const	boxes[3][2]{ { min[0], max[0] }, { min[1], max[1] }, { min[2], max[2] } };
+		size_t	hitCount{ 0 };
+		size_t	i{ 0 };
+		for (; i + T::WIDTH <= count; i += T::WIDTH)
+			AppendPositive(overlap(boxes, i), i, T::WIDTH, hits, hitCount);
+
+		if (i < count)
+		{
+			float	tail[3][2][T::WIDTH]{};
+			for (size_t j{ i }; j < count; ++j)
+				for (unsigned a{ 0 }; a < 3; ++a)
+				{
+					tail[a][0][j - i] = min[a][j];
+					tail[a][1][j - i] = max[a][j];
+				}
+			const float* const	tailBoxes[3][2]{ { tail[0][0], tail[0][1] }, { tail[1][0], tail[1][1] }, { tail[2][0], tail[2][1] } };
+			AppendPositive(overlap(tailBoxes, 0), i, count - i, hits, hitCount);
+		}
+		return hitCount;
+	}
+
+	/**
+	 * Approximates 1 / sqrt(f) with rsqrtss refined by one Newton-Raphson step.
+	 * For positive normal floats the relative error is below 2.5e-7, at most
+	 * 4 ULP from the correctly rounded result, and the NormalizeFast of the maths
+	 * types stay within 6 ULP of their exact version. Zero gives NaN and denormals
+	 * give an infinite result. Exact when MATHS_SSE is not defined
+	 * (infinite for zero)
+	 * @param f: Value to compute the inverse square root of
+	 * @return Approximation of 1 / sqrt(f)
+	 */
+	inline float	RsqrtFast(float f) noexcept
+	{
+#if MATHS_SSE
+		const __m128	x{ _mm_set_ss(f) };
+		const __m128	y{ _mm_rsqrt_ss(x) };
+		// y * (1.5 - 0.5 * x * y * y)
+		const __m128	halfX{ _mm_mul_ss(_mm_set_ss(0.5f), x) };
+		return _mm_cvtss_f32(_mm_mul_ss(y, _mm_sub_ss(_mm_set_ss(1.5f), _mm_mul_ss(halfX, _mm_mul_ss(y, y)))));
+#else
+		return 1.f / std::sqrt(f);
+#endif
+	}
+}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef __SPHERE__
+#define __SPHERE__
+
+#include "Maths/MathMinimal.h"
+
+#include <type_traits>
+
+#include "Maths/Vec3.hpp"
+
+namespace Maths
+{
+	/**
+	 * Sphere stored as its center and radius
+	 */
+	struct Sphere
+	{
+		Vec3	center;
+		float	radius{ 0.f };
+
+		/**
+		 * Creates a sphere of radius zero at the origin
+		 */
+		inline constexpr		Sphere() noexcept = default;
+
+		/**
+		 * Creates a sphere
+		 * @param sphereCenter: Center of the sphere
+		 * @param sphereRadius: Radius of the sphere, not negative
+		 */
+		inline constexpr		Sphere(const Vec3& sphereCenter, const float sphereRadius) noexcept
+			: center{ sphereCenter }, radius{ sphereRadius }
+		{
+		}
+
+		/**
+		 * Checks if a point is inside the sphere or on its surface
+		 * @param point: Point to check
+		 * @return Whether the point is inside the sphere
+		 */
+		inline constexpr bool	Contains(const Vec3& point) const noexcept
+		{
+			return (point - center).SquaredLength() <= radius * radius;
+		}
+	};
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include "Maths/MathMinimal.h"
 
 #include "Maths/Mat.hpp"
+#include "Maths/Simd.hpp"
 #include <iostream>
 
 namespace Maths
@@ -62,21 +63,13 @@ namespace Maths
 		 * Creates a copy of the given vector
 		 * @param v: Vector to be copied
 		 */
-		inline constexpr		Vec(const Vec<Size>& v) noexcept : m_vec()
-		{
-			for (unsigned i {0}; i < Size; ++i)
-				m_vec[i] = v[i];
-		}
+		inline constexpr		Vec(const Vec<Size>& v) noexcept = default;
 
 		/**
 		 * Moves a vector to a new vector
 		 * @param v: Vector to be moved
 		 */
-		inline constexpr		Vec(Vec<Size>&& v) noexcept : m_vec{}
-		{
-			for (unsigned i{ 0 }; i < Size; ++i)
-				m_vec[i] = std::move(v[i]);
-		}
+		inline constexpr		Vec(Vec<Size>&& v) noexcept = default;
 
 		/**
 		 * Computes normalized version of current vector
@@ -94,6 +87,58 @@ namespace Maths
 		{
 			*this /= Length();
 		}
+
+		/**
+		 * Computes the normalized version of current vector with an approximated
+		 * inverse length (see Simd::RsqrtFast for its accuracy).
+		 * Components are NaN or infinite when the squared length is below
+		 * NORMALIZE_EPSILON, the Safe version handles those
+		 * @return The normalized version of current vector
+		 */
+		inline Vec<Size>			NormalizedFast() const noexcept
+		{
+			Vec<Size>	newVec{ *this };
+			newVec.NormalizeFast();
+			return newVec;
+		}
+
+		/**
+		 * Normalizes the current vector with an approximated inverse length
+		 * (see Simd::RsqrtFast for its accuracy).
+		 * Components are NaN or infinite when the squared length is below
+		 * NORMALIZE_EPSILON, the Safe version handles those
+		 */
+		inline void					NormalizeFast() noexcept
+		{
+			const float	invLen{ Simd::RsqrtFast(SquaredLength()) };
+			for (unsigned i{ 0 }; i < Size; ++i)
+				m_vec[i] *= invLen;
+		}
+
+		/**
+		 * Computes the normalized version of current vector, or a zero
+		 * vector if its squared length is below NORMALIZE_EPSILON
+		 * @return The normalized version of current vector
+		 */
+		inline Vec<Size>			NormalizedSafe() const noexcept
+		{
+			Vec<Size>	newVec{ *this };
+			newVec.NormalizeSafe();
+			return newVec;
+		}
+
+		/**
+		 * Normalizes the current vector, or sets it to zero if
+		 * its squared length is below NORMALIZE_EPSILON
+		 */
+		inline void					NormalizeSafe() noexcept
+		{
+			const float	sqrLen{ SquaredLength() };
+			if (sqrLen < NORMALIZE_EPSILON)
+				*this = Vec<Size>();
+			else
+				*this /= sqrt(sqrLen);
+		}
 			
 		/**
 		 * Computes length of current vector
@@ -198,27 +243,16 @@ namespace Maths
 		/**
 		 * Copies given vector in the current vector
 		 * @param v: Vector to be copied
-		 * @return Copy of the result
+		 * @return Reference to the current vector
 		 */
-		inline constexpr Vec<Size>	operator= (const Vec<Size>& v) noexcept
-		{
-			for (unsigned i {0}; i < Size; ++i)
-				m_vec[i] = v[i];
-
-			return *this;
-		}
+		inline constexpr Vec<Size>&	operator= (const Vec<Size>& v) noexcept = default;
 
 		/**
 		 * Moves the given vector in the current vector
 		 * @param v: Vector to be moved
-		 * @return Copy of the result
+		 * @return Reference to the current vector
 		 */
-		inline constexpr Vec<Size>	operator= (Vec<Size>&& v) noexcept
-		{
-			for (unsigned i {0}; i < Size; ++i)
-				m_vec[i] = std::move(v[i]);
-			return *this;
-		}
+		inline constexpr Vec<Size>&	operator= (Vec<Size>&& v) noexcept = default;
 	
 		/**
 		 * Compares the given vector to the current vector
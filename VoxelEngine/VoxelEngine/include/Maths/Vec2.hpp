@@ -40,7 +40,7 @@ namespace Maths
 		 * Creates a copy of given vector
 		 * @param v: Vector to be copied
 		 */
-		inline constexpr		Vec2(const Vec2& v) noexcept;
+		inline constexpr		Vec2(const Vec2& v) noexcept = default;
 
 		/**
 		 * Creates a vector with the given values
@@ -53,7 +53,7 @@ namespace Maths
 		 * Moves the given vector to a new vector
 		 * @param v: Vector to be moved
 		 */
-		inline constexpr		Vec2(Vec2&& v) noexcept;
+		inline constexpr		Vec2(Vec2&& v) noexcept = default;
 
 		/**
 		 * Moves the given templated vector to a new vector
@@ -74,6 +74,36 @@ namespace Maths
 		*/
 		inline void				Normalize() noexcept;
 
+		/**
+		 * Computes the normalized version of current vector with an approximated
+		 * inverse length (see Simd::RsqrtFast for its accuracy).
+		 * Components are NaN or infinite when the squared length is below
+		 * NORMALIZE_EPSILON, the Safe version handles those
+		 * @return The normalized version of current vector
+		 */
+		inline Vec2				NormalizedFast() const noexcept;
+
+		/**
+		 * Normalizes the current vector with an approximated inverse length
+		 * (see Simd::RsqrtFast for its accuracy).
+		 * Components are NaN or infinite when the squared length is below
+		 * NORMALIZE_EPSILON, the Safe version handles those
+		 */
+		inline void				NormalizeFast() noexcept;
+
+		/**
+		 * Computes the normalized version of current vector, or a zero
+		 * vector if its squared length is below NORMALIZE_EPSILON
+		 * @return The normalized version of current vector
+		 */
+		inline Vec2				NormalizedSafe() const noexcept;
+
+		/**
+		 * Normalizes the current vector, or sets it to zero if
+		 * its squared length is below NORMALIZE_EPSILON
+		 */
+		inline void				NormalizeSafe() noexcept;
+
 		/**
 		 * Computes the square length of the vector
 		 * @return The square length of the vector
@@ -89,16 +119,16 @@ namespace Maths
 		/**
 		 * Copies the given vector in current vector
 		 * @param v: Vector to copy
-		 * @return A copy of the given vector
+		 * @return Reference to the current vector
 		 */
-		inline constexpr Vec2	operator= (const Vec2& v) noexcept;
+		inline constexpr Vec2&	operator= (const Vec2& v) noexcept = default;
 
 		/**
 		 * Moves the given vector in the current vector
 		 * @param v: Vector to move
-		 * @return A copy of the given vector
+		 * @return Reference to the current vector
 		 */
-		inline constexpr Vec2	operator= (Vec2&& v) noexcept;
+		inline constexpr Vec2&	operator= (Vec2&& v) noexcept = default;
 
 		/**
 		 * Compares the given vector to the current vector
@@ -181,21 +211,17 @@ namespace Maths
 		}
 	};
 
+	static_assert(BitwiseCopyable<Vec2>);
+
 	inline constexpr Maths::Vec2::Vec2() noexcept : x {0}, y {0}
 	{
 	}
 	inline constexpr Vec2::Vec2(const float f) noexcept : x {f}, y {f}
 	{
 	}
-	inline constexpr Vec2::Vec2(const Vec2& v) noexcept : x {v.x}, y {v.y}
-	{
-	}
 	inline constexpr Vec2::Vec2(const float X, const float Y) noexcept : x {X}, y {Y}
 	{
 	}
-	inline constexpr Vec2::Vec2(Vec2&& v) noexcept : x {std::move(v.x)}, y {std::move(v.y)}
-	{
-	}
 	inline constexpr Vec2::Vec2(Vec<2> && v) noexcept : x {v[0]}, y {v[1]}
 	{
 	}
@@ -209,27 +235,33 @@ namespace Maths
 		float len{ Length() };
 		*this /= len;
 	}
-	inline constexpr float Vec2::SquaredLength() const noexcept
+	inline Vec2		Vec2::NormalizedFast() const noexcept
 	{
-		return x * x + y * y;
+		const float invLen{ Simd::RsqrtFast(SquaredLength()) };
+		return Vec2(x * invLen, y * invLen);
 	}
-	inline float Vec2::Length() const noexcept
+	inline void		Vec2::NormalizeFast() noexcept
 	{
-		return sqrt(SquaredLength());
+		*this = NormalizedFast();
 	}
-	inline constexpr Vec2 Vec2::operator=(const Vec2& v) noexcept
+	inline Vec2		Vec2::NormalizedSafe() const noexcept
 	{
-		x = v.x;
-		y = v.y;
-
-		return *this;
+		const float sqrLen{ SquaredLength() };
+		if (sqrLen < NORMALIZE_EPSILON)
+			return Vec2();
+		return *this / sqrt(sqrLen);
 	}
-	inline constexpr Vec2 Vec2::operator=(Vec2&& v) noexcept
+	inline void		Vec2::NormalizeSafe() noexcept
 	{
-		x = std::move(v.x);
-		y = std::move(v.y);
-
-		return *this;
+		*this = NormalizedSafe();
+	}
+	inline constexpr float Vec2::SquaredLength() const noexcept
+	{
+		return x * x + y * y;
+	}
+	inline float Vec2::Length() const noexcept
+	{
+		return sqrt(SquaredLength());
 	}
 	inline constexpr bool Vec2::operator==(const Vec2& v) const noexcept
 	{
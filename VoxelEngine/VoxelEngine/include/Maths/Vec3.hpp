@@ -54,9 +54,7 @@ namespace Maths
 		 * Creates a copy of given vector
 		 * @param v: Vector to be copied
 		 */
-		inline constexpr		Vec3(const Vec3& v) noexcept : x {v.x}, y {v.y}, z {v.z}
-		{
-		}
+		inline constexpr		Vec3(const Vec3& v) noexcept = default;
 
 		/**
 		 * Creates a copy of given templated vector
@@ -79,9 +77,7 @@ namespace Maths
 		 * Moves the given vector to a new vector
 		 * @param v: Vector to be moved
 		 */
-		inline constexpr		Vec3(Vec3&& v) noexcept : x {std::move(v.x)}, y {std::move(v.y)}, z {std::move(v.z)}
-		{
-		}
+		inline constexpr		Vec3(Vec3&& v) noexcept = default;
 
 		/**
 		 * Moves the given templated vector to a new vector
@@ -125,6 +121,52 @@ namespace Maths
 			*this /= Length();
 		}
 
+		/**
+		 * Computes the normalized version of current vector with an approximated
+		 * inverse length (see Simd::RsqrtFast for its accuracy).
+		 * Components are NaN or infinite when the squared length is below
+		 * NORMALIZE_EPSILON, the Safe version handles those
+		 * @return The normalized version of current vector
+		 */
+		inline Vec3				NormalizedFast() const noexcept
+		{
+			const float	invLen{ Simd::RsqrtFast(SquaredLength()) };
+			return Vec3(x * invLen, y * invLen, z * invLen);
+		}
+
+		/**
+		 * Normalizes the current vector with an approximated inverse length
+		 * (see Simd::RsqrtFast for its accuracy).
+		 * Components are NaN or infinite when the squared length is below
+		 * NORMALIZE_EPSILON, the Safe version handles those
+		 */
+		inline void				NormalizeFast() noexcept
+		{
+			*this = NormalizedFast();
+		}
+
+		/**
+		 * Computes the normalized version of current vector, or a zero
+		 * vector if its squared length is below NORMALIZE_EPSILON
+		 * @return The normalized version of current vector
+		 */
+		inline Vec3				NormalizedSafe() const noexcept
+		{
+			const float	sqrLen{ SquaredLength() };
+			if (sqrLen < NORMALIZE_EPSILON)
+				return Vec3();
+			return *this / sqrt(sqrLen);
+		}
+
+		/**
+		 * Normalizes the current vector, or sets it to zero if
+		 * its squared length is below NORMALIZE_EPSILON
+		 */
+		inline void				NormalizeSafe() noexcept
+		{
+			*this = NormalizedSafe();
+		}
+
 		/**
 		 * Computes the square length of the vector
 		 * @return The square length of the vector
@@ -172,29 +214,16 @@ namespace Maths
 		/**
 		 * Copies the given vector in current vector
 		 * @param v: Vector to copy
-		 * @return A copy of the given vector
+		 * @return Reference to the current vector
 		 */
-		inline constexpr Vec3	operator= (const Vec3& v) noexcept
-		{
-			x = v.x;
-			y = v.y;
-			z = v.z;
-
-			return *this;
-		}
+		inline constexpr Vec3&	operator= (const Vec3& v) noexcept = default;
 
 		/**
 		 * Moves the given vector in the current vector
 		 * @param v: Vector to move
-		 * @return A copy of the given vector
+		 * @return Reference to the current vector
 		 */
-		inline constexpr Vec3	operator= (Vec3&& v) noexcept
-		{
-			x = std::move(v.x);
-			y = std::move(v.y);
-			z = std::move(v.z);
-			return *this;
-		}
+		inline constexpr Vec3&	operator= (Vec3&& v) noexcept = default;
 		
 		/**
 		 * Compares the given vector to the current vector
@@ -469,6 +498,8 @@ namespace Maths
 			std::cout << ToString() << std::endl;
 		}
 	};
+
+	static_assert(BitwiseCopyable<Vec3>);
 }
 
 #endif
@@ -0,0 +1,269 @@
+#ifndef __VEC3_STREAM__
+#define __VEC3_STREAM__
+
+#include "Maths/MathMinimal.h"
+
+#include <span>
+
+#include "Maths/Vec3.hpp"
+#include "Maths/Simd.hpp"
+#include "Maths/AlignedAllocator.hpp"
+
+namespace Maths
+{
+	/**
+	 * Array of Vec3 stored as separate x, y and z arrays (SoA), aligned and
+	 * padded to a multiple of the SIMD width so that the bulk operations
+	 * process full registers. Standard storage for particles, entity
+	 * positions and vertex processing stages
+	 */
+	class Vec3Stream
+	{
+	public:
+		/**
+		 * Number of floats every component array is padded to, the widest SIMD register
+		 */
+		static constexpr size_t	Padding{ 8 };
+
+	protected:
+		AlignedVector<float>	m_x;
+		AlignedVector<float>	m_y;
+		AlignedVector<float>	m_z;
+		size_t					m_size{ 0 };
+
+	public:
+		/**
+		 * Creates an empty stream
+		 */
+		inline					Vec3Stream() noexcept = default;
+
+		/**
+		 * Creates a stream of size zero vectors
+		 * @param size: Number of vectors
+		 */
+		inline explicit			Vec3Stream(const size_t size)
+		{
+			Resize(size);
+		}
+
+		/**
+		 * Creates a stream from an array of vectors
+		 * @param vectors: Vectors to copy in the stream
+		 */
+		inline explicit			Vec3Stream(std::span<const Vec3> vectors)
+		{
+			Gather(vectors);
+		}
+
+		/**
+		 * Returns the number of vectors in the stream
+		 * @return Number of vectors in the stream
+		 */
+		inline size_t			Size() const noexcept { return m_size; }
+
+		/**
+		 * Returns the number of floats of each component array, padding included
+		 * @return Padded size of the stream
+		 */
+		inline size_t			PaddedSize() const noexcept { return m_x.size(); }
+
+		/**
+		 * Resizes the stream. New vectors are zero
+		 * @param size: New number of vectors
+		 */
+		inline void				Resize(const size_t size)
+		{
+			// The padding lanes are not kept at zero by the bulk operations
+			for (size_t i{ m_size }; i < size && i < PaddedSize(); ++i)
+				m_x[i] = m_y[i] = m_z[i] = 0.f;
+
+			const size_t	padded{ (size + Padding - 1) / Padding * Padding };
+			m_x.resize(padded, 0.f);
+			m_y.resize(padded, 0.f);
+			m_z.resize(padded, 0.f);
+			m_size = size;
+		}
+
+		/**
+		 * Removes all the vectors of the stream
+		 */
+		inline void				Clear() noexcept
+		{
+			m_x.clear();
+			m_y.clear();
+			m_z.clear();
+			m_size = 0;
+		}
+
+		// Component arrays, each of PaddedSize() floats
+		inline float*			X() noexcept { return m_x.data(); }
+		inline const float*		X() const noexcept { return m_x.data(); }
+		inline float*			Y() noexcept { return m_y.data(); }
+		inline const float*		Y() const noexcept { return m_y.data(); }
+		inline float*			Z() noexcept { return m_z.data(); }
+		inline const float*		Z() const noexcept { return m_z.data(); }
+
+		/**
+		 * Getter of a vector of the stream
+		 * @param i: Position of the vector
+		 * @return Copy of the vector
+		 */
+		inline Vec3				Get(const size_t i) const noexcept
+		{
+			return Vec3(m_x[i], m_y[i], m_z[i]);
+		}
+
+		/**
+		 * Setter of a vector of the stream
+		 * @param i: Position of the vector
+		 * @param v: Value to be set
+		 */
+		inline void				Set(const size_t i, const Vec3& v) noexcept
+		{
+			m_x[i] = v.x;
+			m_y[i] = v.y;
+			m_z[i] = v.z;
+		}
+
+		/**
+		 * Replaces the content of the stream by the given vectors
+		 * @param vectors: Vectors to copy in the stream
+		 */
+		inline void				Gather(std::span<const Vec3> vectors)
+		{
+			Resize(vectors.size());
+			for (size_t i{ 0 }; i < vectors.size(); ++i)
+				Set(i, vectors[i]);
+		}
+
+		/**
+		 * Copies the vectors of the stream to an array of vectors
+		 * @param vectors: Span receiving the vectors, must be at least of Size()
+		 */
+		inline void				Scatter(std::span<Vec3> vectors) const noexcept
+		{
+			for (size_t i{ 0 }; i < m_size; ++i)
+				vectors[i] = Get(i);
+		}
+
+		/**
+		 * Computes the dot product of each vector with the respective vector of v
+		 * @param v: Stream to dot with, of the same size
+		 * @param result: Span receiving the dot products, must be at least of Size()
+		 */
+		inline void				Dot(const Vec3Stream& v, std::span<float> result) const noexcept
+		{
+			using namespace Simd;
+			size_t	i{ 0 };
+			for (; i + WideWidth <= m_size; i += WideWidth)
+			{
+				Wide	dot{ WideMul(WideLoad(&m_x[i]), WideLoad(&v.m_x[i])) };
+				dot = WideMulAdd(WideLoad(&m_y[i]), WideLoad(&v.m_y[i]), dot);
+				dot = WideMulAdd(WideLoad(&m_z[i]), WideLoad(&v.m_z[i]), dot);
+				WideStore(&result[i], dot);
+			}
+			for (; i < m_size; ++i)
+				result[i] = m_x[i] * v.m_x[i] + m_y[i] * v.m_y[i] + m_z[i] * v.m_z[i];
+		}
+
+		/**
+		 * Computes the cross product of each vector with the respective vector of v
+		 * @param v: Stream to cross with, of the same size
+		 * @param result: Stream receiving the cross products, resized if needed.
+		 * It may be the current stream or v
+		 */
+		inline void				Cross(const Vec3Stream& v, Vec3Stream& result) const
+		{
+			using namespace Simd;
+			result.Resize(m_size);
+			for (size_t i{ 0 }; i < PaddedSize(); i += WideWidth)
+			{
+				const Wide	ax{ WideLoad(&m_x[i]) }, ay{ WideLoad(&m_y[i]) }, az{ WideLoad(&m_z[i]) };
+				const Wide	bx{ WideLoad(&v.m_x[i]) }, by{ WideLoad(&v.m_y[i]) }, bz{ WideLoad(&v.m_z[i]) };
+				WideStore(&result.m_x[i], WideSub(WideMul(ay, bz), WideMul(az, by)));
+				WideStore(&result.m_y[i], WideSub(WideMul(az, bx), WideMul(ax, bz)));
+				WideStore(&result.m_z[i], WideSub(WideMul(ax, by), WideMul(ay, bx)));
+			}
+		}
+
+		/**
+		 * Computes the squared length of each vector
+		 * @param result: Span receiving the squared lengths, must be at least of Size()
+		 */
+		inline void				SquaredLength(std::span<float> result) const noexcept
+		{
+			Dot(*this, result);
+		}
+
+		/**
+		 * Computes the length of each vector
+		 * @param result: Span receiving the lengths, must be at least of Size()
+		 */
+		inline void				Length(std::span<float> result) const noexcept
+		{
+			using namespace Simd;
+			size_t	i{ 0 };
+			for (; i + WideWidth <= m_size; i += WideWidth)
+			{
+				const Wide	x{ WideLoad(&m_x[i]) }, y{ WideLoad(&m_y[i]) }, z{ WideLoad(&m_z[i]) };
+				WideStore(&result[i], WideSqrt(WideMulAdd(x, x, WideMulAdd(y, y, WideMul(z, z)))));
+			}
+			for (; i < m_size; ++i)
+				result[i] = std::sqrt(m_x[i] * m_x[i] + m_y[i] * m_y[i] + m_z[i] * m_z[i]);
+		}
+
+		/**
+		 * Normalizes every vector of the stream. The vectors must not be zero
+		 */
+		inline void				Normalize() noexcept
+		{
+			using namespace Simd;
+			for (size_t i{ 0 }; i < PaddedSize(); i += WideWidth)
+			{
+				const Wide	x{ WideLoad(&m_x[i]) }, y{ WideLoad(&m_y[i]) }, z{ WideLoad(&m_z[i]) };
+				const Wide	len{ WideSqrt(WideMulAdd(x, x, WideMulAdd(y, y, WideMul(z, z)))) };
+				WideStore(&m_x[i], WideDiv(x, len));
+				WideStore(&m_y[i], WideDiv(y, len));
+				WideStore(&m_z[i], WideDiv(z, len));
+			}
+		}
+
+		/**
+		 * Moves every vector toward the respective vector of to, with the given progress
+		 * @param to: Stream of the targets, of the same size
+		 * @param progress: Progress of the interpolation, 0 keeps the current vectors
+		 */
+		inline void				Lerp(const Vec3Stream& to, const float progress) noexcept
+		{
+			using namespace Simd;
+			const Wide	t{ WideSet(progress) };
+			for (size_t i{ 0 }; i < PaddedSize(); i += WideWidth)
+			{
+				const Wide	x{ WideLoad(&m_x[i]) }, y{ WideLoad(&m_y[i]) }, z{ WideLoad(&m_z[i]) };
+				WideStore(&m_x[i], WideMulAdd(WideSub(WideLoad(&to.m_x[i]), x), t, x));
+				WideStore(&m_y[i], WideMulAdd(WideSub(WideLoad(&to.m_y[i]), y), t, y));
+				WideStore(&m_z[i], WideMulAdd(WideSub(WideLoad(&to.m_z[i]), z), t, z));
+			}
+		}
+
+		/**
+		 * Adds v multiplied by the given scalar to every vector, such as
+		 * velocities times the frame time to positions
+		 * @param v: Stream to add, of the same size
+		 * @param scalar: Scalar to multiply v by
+		 */
+		inline void				MulAdd(const Vec3Stream& v, const float scalar) noexcept
+		{
+			using namespace Simd;
+			const Wide	s{ WideSet(scalar) };
+			for (size_t i{ 0 }; i < PaddedSize(); i += WideWidth)
+			{
+				WideStore(&m_x[i], WideMulAdd(WideLoad(&v.m_x[i]), s, WideLoad(&m_x[i])));
+				WideStore(&m_y[i], WideMulAdd(WideLoad(&v.m_y[i]), s, WideLoad(&m_y[i])));
+				WideStore(&m_z[i], WideMulAdd(WideLoad(&v.m_z[i]), s, WideLoad(&m_z[i])));
+			}
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef __VEC3D__
+#define __VEC3D__
+
+#include "Maths/MathMinimal.h"
+
+#include <type_traits>
+#include <span>
+#include <string>
+#include <iostream>
+
+#include "Maths/Vec3.hpp"
+#include "Maths/Simd.hpp"
+
+namespace Maths
+{
+	/**
+	 * Double precision vector with predefined size of 3, for world space positions.
+	 * A float keeps a millimetre precision only up to a few kilometres from the
+	 * origin, so positions are stored in double and rebased around the camera
+	 * to floats before rendering, see RelativeTo and Rebase
+	 */
+	struct Vec3d
+	{
+		double	x;
+		double	y;
+		double	z;
+
+		/**
+		 * Default constructor, creates a vec zero
+		 */
+		inline constexpr		Vec3d() noexcept : x{ 0 }, y{ 0 }, z{ 0 } {}
+
+		/**
+		 * Creates a vector with all its values initialized at the given value
+		 * @param d: Value to witch vector is initialized
+		 */
+		inline constexpr explicit	Vec3d(const double d) noexcept : x{ d }, y{ d }, z{ d } {}
+
+		/**
+		 * Creates a vector with the given values
+		 * @param X: The X component of the vector
+		 * @param Y: The Y component of the vector
+		 * @param Z: The Z component of the vector
+		 */
+		inline constexpr		Vec3d(const double X, const double Y, const double Z) noexcept : x{ X }, y{ Y }, z{ Z } {}
+
+		/**
+		 * Creates a double vector from a float vector
+		 * @param v: Vector to be converted
+		 */
+		inline constexpr		Vec3d(const Vec3& v) noexcept : x{ v.x }, y{ v.y }, z{ v.z } {}
+
+		/**
+		 * Conversion to a float vector, losing precision far from the origin
+		 */
+		inline constexpr explicit	operator Vec3() const noexcept
+		{
+			return Vec3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+		}
+
+		/**
+		 * Computes the position relative to the given origin in float,
+		 * the substraction being done in double
+		 * @param origin: Origin of the render space, usually the camera position
+		 * @return Float position relative to origin
+		 */
+		inline constexpr Vec3		RelativeTo(const Vec3d& origin) const noexcept
+		{
+			return Vec3(static_cast<float>(x - origin.x), static_cast<float>(y - origin.y), static_cast<float>(z - origin.z));
+		}
+
+		/**
+		 * Computes the float positions of an array of positions relative to the given origin
+		 * @param positions: Positions to rebase
+		 * @param origin: Origin of the render space, usually the camera position
+		 * @param result: Span receiving the rebased positions, at least of positions size
+		 */
+		static inline void			Rebase(std::span<const Vec3d> positions, const Vec3d& origin, std::span<Vec3> result) noexcept
+		{
+#if MATHS_SSE
+			static_assert(sizeof(Vec3) == sizeof(float) * 3 && sizeof(Vec3d) == sizeof(double) * 3);
+			const double	o[3]{ origin.x, origin.y, origin.z };
+			// Cast without dereferencing, data() is null for empty spans
+			Simd::RebaseVec3d(reinterpret_cast<const double*>(positions.data()), o, reinterpret_cast<float*>(result.data()), positions.size());
+#else
+			for (size_t i{ 0 }; i < positions.size(); ++i)
+				result[i] = positions[i].RelativeTo(origin);
+#endif
+		}
+
+		/**
+		 * Computes the squared length of the vector
+		 * @return Squared length of the vector
+		 */
+		inline constexpr double		SquaredLength() const noexcept
+		{
+			return x * x + y * y + z * z;
+		}
+
+		/**
+		 * Computes the length of the vector
+		 * @return Length of the vector
+		 */
+		inline double				Length() const noexcept
+		{
+			return std::sqrt(SquaredLength());
+		}
+
+		/**
+		 * Computes the normalized version of current vector
+		 * @return The normalized version of current vector
+		 */
+		inline Vec3d				Normalized() const noexcept
+		{
+			return *this / Length();
+		}
+
+		/**
+		 * Computes the dot product between current vector and given vector
+		 * @param v: Vector to dot current vector with
+		 * @return Dot product of the two vectors
+		 */
+		inline constexpr double		Dot(const Vec3d& v) const noexcept
+		{
+			return x * v.x + y * v.y + z * v.z;
+		}
+
+		/**
+		 * Computes the cross product between current vector and given vector
+		 * @param v: Vector to cross current vector with
+		 * @return Cross product of the two vectors
+		 */
+		inline constexpr Vec3d		Cross(const Vec3d& v) const noexcept
+		{
+			return Vec3d(y * v.z - z * v.y, z * v.x - x * v.z, x * v.y - y * v.x);
+		}
+
+		inline constexpr bool		operator== (const Vec3d& v) const noexcept = default;
+
+		inline constexpr Vec3d		operator+ (const Vec3d& v) const noexcept { return Vec3d(x + v.x, y + v.y, z + v.z); }
+		inline constexpr Vec3d		operator- (const Vec3d& v) const noexcept { return Vec3d(x - v.x, y - v.y, z - v.z); }
+		inline constexpr Vec3d		operator- () const noexcept { return Vec3d(-x, -y, -z); }
+		inline constexpr Vec3d		operator* (const double d) const noexcept { return Vec3d(x * d, y * d, z * d); }
+		inline constexpr Vec3d		operator/ (const double d) const noexcept { return Vec3d(x / d, y / d, z / d); }
+		inline constexpr Vec3d&		operator+= (const Vec3d& v) noexcept { x += v.x; y += v.y; z += v.z; return *this; }
+		inline constexpr Vec3d&		operator-= (const Vec3d& v) noexcept { x -= v.x; y -= v.y; z -= v.z; return *this; }
+		inline constexpr Vec3d&		operator*= (const double d) noexcept { x *= d; y *= d; z *= d; return *this; }
+		inline constexpr Vec3d&		operator/= (const double d) noexcept { x /= d; y /= d; z /= d; return *this; }
+
+		/**
+		 * Converts vector to string format
+		 * @return String version of the current vector
+		 */
+		inline std::string			ToString() const noexcept
+		{
+			return std::to_string(x) + " " + std::to_string(y) + " " + std::to_string(z);
+		}
+
+		/**
+		 * Print current vector to the console
+		 */
+		inline void					Print() const noexcept
+		{
+			std::cout << ToString() << std::endl;
+		}
+	};
+
+	static_assert(BitwiseCopyable<Vec3d>);
+}
+
+#endif
@@ -62,9 +62,7 @@ namespace Maths
 		 * Creates a copy of given vector
 		 * @param v: Vector to be copied
 		 */
-		inline constexpr		Vec4(const Vec4& v) noexcept : x {v.x}, y {v.y}, z {v.z}, w {v.w}
-		{
-		}
+		inline constexpr		Vec4(const Vec4& v) noexcept = default;
 
 		/**
 		 * Creates a copy of given templated vector
@@ -105,9 +103,7 @@ namespace Maths
 		 * Moves the given vector to a new vector
 		 * @param v: Vector to be moved
 		 */
-		inline constexpr		Vec4(Vec4&& v) noexcept : x {std::move(v.x)}, y {std::move(v.y)}, z {std::move(v.z)}, w {std::move(v.w)}
-		{
-		}
+		inline constexpr		Vec4(Vec4&& v) noexcept = default;
 
 		/**
 		 * Moves the given templated vector to a new vector
@@ -154,6 +150,52 @@ namespace Maths
 		{
 			*this /= Length();
 		}
+
+		/**
+		 * Computes the normalized version of current vector with an approximated
+		 * inverse length (see Simd::RsqrtFast for its accuracy).
+		 * Components are NaN or infinite when the squared length is below
+		 * NORMALIZE_EPSILON, the Safe version handles those
+		 * @return The normalized version of current vector
+		 */
+		inline Vec4				NormalizedFast() const noexcept
+		{
+			const float	invLen{ Simd::RsqrtFast(SquaredLength()) };
+			return Vec4(x * invLen, y * invLen, z * invLen, w * invLen);
+		}
+
+		/**
+		 * Normalizes the current vector with an approximated inverse length
+		 * (see Simd::RsqrtFast for its accuracy).
+		 * Components are NaN or infinite when the squared length is below
+		 * NORMALIZE_EPSILON, the Safe version handles those
+		 */
+		inline void				NormalizeFast() noexcept
+		{
+			*this = NormalizedFast();
+		}
+
+		/**
+		 * Computes the normalized version of current vector, or a zero
+		 * vector if its squared length is below NORMALIZE_EPSILON
+		 * @return The normalized version of current vector
+		 */
+		inline Vec4				NormalizedSafe() const noexcept
+		{
+			const float	sqrLen{ SquaredLength() };
+			if (sqrLen < NORMALIZE_EPSILON)
+				return Vec4();
+			return *this / sqrt(sqrLen);
+		}
+
+		/**
+		 * Normalizes the current vector, or sets it to zero if
+		 * its squared length is below NORMALIZE_EPSILON
+		 */
+		inline void				NormalizeSafe() noexcept
+		{
+			*this = NormalizedSafe();
+		}
 			
 		/**
 		 * Computes the length of the vector
@@ -230,9 +272,9 @@ namespace Maths
 		/**
 		 * Copies the given templated vector in current vector
 		 * @param v: Templated vector to copy
-		 * @return A copy of the given vector
+		 * @return Reference to the current vector
 		 */
-		inline constexpr Vec4	operator= (const Vec<4>& v) noexcept
+		inline constexpr Vec4&	operator= (const Vec<4>& v) noexcept
 		{
 			x = v[0];
 			y = v[1];
@@ -245,24 +287,16 @@ namespace Maths
 		/**
 		 * Copies the given vector in current vector
 		 * @param v: Vector to copy
-		 * @return A copy of the given vector
+		 * @return Reference to the current vector
 		 */
-		inline constexpr Vec4	operator= (const Vec4& v) noexcept
-		{
-			x = v.x;
-			y = v.y;
-			z = v.z;
-			w = v.w;
-
-			return *this;
-		}
+		inline constexpr Vec4&	operator= (const Vec4& v) noexcept = default;
 
 		/**
 		 * Moves the given templated vector in the current vector
 		 * @param v: Templated vector to move
-		 * @return A copy of the given vector
+		 * @return Reference to the current vector
 		 */
-		inline constexpr Vec4	operator= (Vec<4>&& v) noexcept
+		inline constexpr Vec4&	operator= (Vec<4>&& v) noexcept
 		{
 			x = std::move(v[0]);
 			y = std::move(v[1]);
@@ -274,16 +308,9 @@ namespace Maths
 		/**
 		 * Moves the given vector in the current vector
 		 * @param v: Vector to move
-		 * @return A copy of the given vector
+		 * @return Reference to the current vector
 		 */
-		inline constexpr Vec4	operator= (Vec4&& v) noexcept
-		{
-			x = std::move(v.x);
-			y = std::move(v.y);
-			z = std::move(v.z);
-			w = std::move(v.w);
-			return *this;
-		}
+		inline constexpr Vec4&	operator= (Vec4&& v) noexcept = default;
 
 		/**
 		 * Converts vector into templated vector
@@ -661,6 +688,8 @@ namespace Maths
 			std::cout << ToString() << std::endl;
 		}
 	};
+
+	static_assert(BitwiseCopyable<Vec4>);
 }
 
 #endif
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <span>
+
+#include "Maths/Noise.hpp"
+
+namespace Core::Platform
+{
+	enum class ESimdLevel : char;
+}
+
+namespace Core::Procedural
+{
+	/**
+	 * Fills a 3D grid of noise samples in one call, the samples are at
+	 * origin + (x, y, z) * step with x varying the fastest, like the voxels
+	 * of a chunk. 8 samples are evaluated at a time on AVX2 CPUs, the values
+	 * are the same as the scalar Maths::Noise::Evaluate on every path
+	 * @param settings: Noise, fractal and frequency to evaluate
+	 * @param origin: Position of the first sample
+	 * @param step: Distance between two samples
+	 * @param size: Number of samples on each axis
+	 * @param result: Receives the samples, at least of size.x * size.y * size.z
+	 */
+	void	FillNoise(const Maths::Noise::Settings& settings, const Maths::Vec3& origin, float step,
+					  const Maths::IVec3& size, std::span<float> result) noexcept;
+
+	/**
+	 * Fills a 2D grid of noise samples in one call, at origin + (x, y) * step
+	 * with x varying the fastest. Used for height maps
+	 * @param settings: Noise, fractal and frequency to evaluate
+	 * @param origin: Position of the first sample
+	 * @param step: Distance between two samples
+	 * @param size: Number of samples on each axis
+	 * @param result: Receives the samples, at least of size.x * size.y
+	 */
+	void	FillNoise(const Maths::Noise::Settings& settings, const Maths::Vec2& origin, float step,
+					  const Maths::IVec2& size, std::span<float> result) noexcept;
+
+	/**
+	 * Same as FillNoise, with the implementation a CPU limited to the given
+	 * level would use, to compare the paths or benchmark them against each other
+	 * @param level: Highest instruction set allowed, must be supported by this CPU
+	 */
+	void	FillNoise(const Maths::Noise::Settings& settings, const Maths::Vec3& origin, float step,
+					  const Maths::IVec3& size, std::span<float> result, Platform::ESimdLevel level) noexcept;
+
+	/**
+	 * Same as the 2D FillNoise, with the implementation a CPU limited to the given level would use
+	 * @param level: Highest instruction set allowed, must be supported by this CPU
+	 */
+	void	FillNoise(const Maths::Noise::Settings& settings, const Maths::Vec2& origin, float step,
+					  const Maths::IVec2& size, std::span<float> result, Platform::ESimdLevel level) noexcept;
+}
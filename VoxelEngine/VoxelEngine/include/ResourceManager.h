@@ -5,6 +5,8 @@
 
 #include <list>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace Core::Resources
 {
@@ -17,6 +19,22 @@ namespace Core::Resources
 
 		std::shared_ptr<Resource>	AddResouce(std::shared_ptr<Resource> newResource) noexcept;
 
+		/**
+		 * Creates a resource and tracks it, it is removed once only the manager holds it
+		 * @param args: Arguments of the constructor of the resource
+		 * @return The new resource
+		 */
+		template <class T, class... Args>
+		requires std::is_base_of_v<Resource, T>
+		std::shared_ptr<T>			Create(Args&&... args) noexcept
+		{
+			std::shared_ptr<T>	resource{ std::make_shared<T>(std::forward<Args>(args)...) };
+			m_resources.push_back(resource);
+			return resource;
+		}
+
+		size_t						GetResourceCount() const noexcept { return m_resources.size(); }
+
 		int						RemoveUnusedResources() noexcept;
 	};
 }
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <cstddef>
+
+#include "Maths/Simd.hpp"
+
+namespace Core::Platform
+{
+	enum class ESimdLevel : char;
+}
+
+/**
+ * Kernels of Maths::Simd dispatched at runtime, with the implementation a CPU
+ * limited to the given level would use, to compare the paths or benchmark them
+ * against each other. The level must be supported by this CPU
+ */
+namespace Maths::Simd
+{
+	size_t	CullAabbSoA(const float (&planes)[6][4], const float* const min[3], const float* const max[3],
+						size_t count, unsigned* visible, Core::Platform::ESimdLevel level) noexcept;
+
+	size_t	CullSphereSoA(const float (&planes)[6][4], const float* const center[3], const float* radius,
+						  size_t count, unsigned* visible, Core::Platform::ESimdLevel level) noexcept;
+
+	size_t	RayAabbSoA(const float (&origin)[3], const float (&invDirection)[3], float maxDistance,
+					   const float* const min[3], const float* const max[3], size_t count,
+					   unsigned* hits, float* distances, Core::Platform::ESimdLevel level) noexcept;
+
+	size_t	SphereAabbSoA(const float (&center)[3], float radius, const float* const min[3], const float* const max[3],
+						  size_t count, unsigned* hits, Core::Platform::ESimdLevel level) noexcept;
+
+	size_t	AabbAabbSoA(const float (&queryMin)[3], const float (&queryMax)[3], const float* const min[3],
+						const float* const max[3], size_t count, unsigned* hits, Core::Platform::ESimdLevel level) noexcept;
+}
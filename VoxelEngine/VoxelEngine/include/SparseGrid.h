@@ -0,0 +1,406 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Resource.h"
+#include "Chunk.h"
+
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "Maths/IVec3.hpp"
+#include "Maths/ChunkPos.hpp"
+
+namespace Core::Datastructure
+{
+	/**
+	 * Unbounded sparse voxel grid with the 5-4-3 layout of OpenVDB: a hash map of
+	 * upper nodes of 32^3 slots, each slot holding a lower node of 16^3 slots, each
+	 * holding a leaf of 8^3 voxels. A slot without a child is a tile, one value for
+	 * its whole cube, and the masks of every node tell the children and the active
+	 * tiles or voxels apart, so the iterations skip empty space a word at a time.
+	 * Inactive voxels and tiles always hold BACKGROUND
+	 */
+	class SparseGrid : public Resources::Resource
+	{
+	public:
+		static constexpr BlockId	BACKGROUND{ 0 };
+
+		// Log2 of the number of voxels per side of each level
+		static constexpr unsigned	LEAF_SHIFT{ 3 };
+		static constexpr unsigned	LOWER_SHIFT{ LEAF_SHIFT + 4 };
+		static constexpr unsigned	UPPER_SHIFT{ LOWER_SHIFT + 5 };
+
+		struct LeafNode
+		{
+			static constexpr unsigned	SIZE{ 1u << (LEAF_SHIFT * 3) };
+
+			uint64_t		activeMask[SIZE / 64];
+			BlockId			values[SIZE];
+			Maths::IVec3	origin;
+		};
+
+		/**
+		 * Node of 2^(3 * Log2) slots, a slot holds the index of a child if its bit of
+		 * childMask is set, else the value of a tile active if its bit of valueMask is
+		 */
+		template <unsigned Log2>
+		struct InternalNode
+		{
+			static constexpr unsigned	SIZE{ 1u << (Log2 * 3) };
+
+			uint64_t		childMask[SIZE / 64];
+			uint64_t		valueMask[SIZE / 64];
+			uint32_t		slots[SIZE];
+			Maths::IVec3	origin;
+		};
+
+		using LowerNode = InternalNode<LOWER_SHIFT - LEAF_SHIFT>;
+		using UpperNode = InternalNode<UPPER_SHIFT - LOWER_SHIFT>;
+
+		/**
+		 * Caches the nodes of the last voxel accessed, so voxels close to each
+		 * other are reached without going through the root. Freeing nodes, with
+		 * Prune() or Clear(), resets the accessors of the grid on their next access
+		 * @tparam Const: Whether the accessor only reads the grid
+		 */
+		template <bool Const>
+		class ValueAccessor
+		{
+		protected:
+			using Grid = std::conditional_t<Const, const SparseGrid, SparseGrid>;
+			using Upper = std::conditional_t<Const, const UpperNode, UpperNode>;
+			using Lower = std::conditional_t<Const, const LowerNode, LowerNode>;
+			using Leaf = std::conditional_t<Const, const LeafNode, LeafNode>;
+
+			Grid*			m_grid;
+			uint32_t		m_generation;
+			Upper*			m_upper{ nullptr };
+			Lower*			m_lower{ nullptr };
+			Leaf*			m_leaf{ nullptr };
+			Maths::IVec3	m_upperKey;
+			Maths::IVec3	m_lowerKey;
+			Maths::IVec3	m_leafKey;
+
+			inline void		Sync() noexcept;
+
+			/**
+			 * Finds the deepest node holding a voxel, from the deepest cached one
+			 * @return Value of the voxel, or of the tile holding it
+			 */
+			inline BlockId	Find(const Maths::IVec3& voxel, bool& active) noexcept;
+
+			/**
+			 * Finds the leaf holding a voxel, creating the nodes on the way
+			 */
+			inline Leaf&	Touch(const Maths::IVec3& voxel) noexcept requires (!Const);
+		public:
+			explicit ValueAccessor(Grid& grid) noexcept : m_grid{ &grid }, m_generation{ grid.m_generation } {}
+
+			inline BlockId	Get(const Maths::IVec3& voxel) noexcept;
+			inline bool		IsActive(const Maths::IVec3& voxel) noexcept;
+
+			/**
+			 * Sets the value of a voxel and activates it
+			 */
+			inline void		Set(const Maths::IVec3& voxel, BlockId value) noexcept requires (!Const);
+
+			/**
+			 * Deactivates a voxel, its value becoming BACKGROUND
+			 */
+			inline void		Erase(const Maths::IVec3& voxel) noexcept requires (!Const);
+		};
+
+		using Accessor = ValueAccessor<false>;
+		using ConstAccessor = ValueAccessor<true>;
+
+	protected:
+		std::unordered_map<Maths::IVec3, uint32_t>	m_root;
+		std::vector<std::unique_ptr<UpperNode>>		m_uppers;
+		std::vector<std::unique_ptr<LowerNode>>		m_lowers;
+		std::vector<std::unique_ptr<LeafNode>>		m_leaves;
+		std::vector<uint32_t>						m_freeUppers;
+		std::vector<uint32_t>						m_freeLowers;
+		std::vector<uint32_t>						m_freeLeaves;
+		// Changed whenever a node is freed, so the accessors drop their cache
+		uint32_t									m_generation{ 0 };
+
+		static unsigned	LeafOffset(const Maths::IVec3& v) noexcept
+		{
+			return (v.x & 7) | (v.y & 7) << 3 | (v.z & 7) << 6;
+		}
+		static unsigned	LowerOffset(const Maths::IVec3& v) noexcept
+		{
+			return (v.x >> LEAF_SHIFT & 15) | (v.y >> LEAF_SHIFT & 15) << 4 | (v.z >> LEAF_SHIFT & 15) << 8;
+		}
+		static unsigned	UpperOffset(const Maths::IVec3& v) noexcept
+		{
+			return (v.x >> LOWER_SHIFT & 31) | (v.y >> LOWER_SHIFT & 31) << 5 | (v.z >> LOWER_SHIFT & 31) << 10;
+		}
+		static bool		TestBit(const uint64_t* mask, unsigned i) noexcept { return (mask[i >> 6] >> (i & 63) & 1) != 0; }
+		static void		SetBit(uint64_t* mask, unsigned i) noexcept { mask[i >> 6] |= uint64_t{ 1 } << (i & 63); }
+		static void		ClearBit(uint64_t* mask, unsigned i) noexcept { mask[i >> 6] &= ~(uint64_t{ 1 } << (i & 63)); }
+
+		/**
+		 * Position of a slot of a node, relative to the node
+		 * @param childShift: Log2 of the size of the cube of a slot
+		 */
+		template <unsigned Log2>
+		static Maths::IVec3	SlotOffset(unsigned slot, unsigned childShift) noexcept
+		{
+			constexpr unsigned	mask{ (1u << Log2) - 1 };
+			return Maths::IVec3(static_cast<int>(slot & mask), static_cast<int>(slot >> Log2 & mask),
+								static_cast<int>(slot >> (Log2 * 2))) << childShift;
+		}
+
+		UpperNode&			TouchUpper(const Maths::IVec3& voxel) noexcept;
+		LowerNode&			TouchLower(UpperNode& upper, const Maths::IVec3& voxel) noexcept;
+		LeafNode&			TouchLeaf(LowerNode& lower, const Maths::IVec3& voxel) noexcept;
+
+		void				FreeLeaf(uint32_t leaf) noexcept;
+		void				FreeLower(uint32_t lower) noexcept;
+
+		/**
+		 * Makes a slot a tile, freeing its child
+		 */
+		void				SetTile(UpperNode& upper, unsigned slot, BlockId value, bool active) noexcept;
+		void				SetTile(LowerNode& lower, unsigned slot, BlockId value, bool active) noexcept;
+
+		template <class F>
+		static void			ForEachVoxel(const Maths::IVec3& min, int size, BlockId value, F& f) noexcept;
+	public:
+		SparseGrid() noexcept = default;
+		~SparseGrid() noexcept override = default;
+
+		Accessor		GetAccessor() noexcept { return Accessor(*this); }
+		ConstAccessor	GetAccessor() const noexcept { return ConstAccessor(*this); }
+
+		BlockId			Get(const Maths::IVec3& voxel) const noexcept { return GetAccessor().Get(voxel); }
+		bool			IsActive(const Maths::IVec3& voxel) const noexcept { return GetAccessor().IsActive(voxel); }
+		void			Set(const Maths::IVec3& voxel, BlockId value) noexcept { GetAccessor().Set(voxel, value); }
+		void			Erase(const Maths::IVec3& voxel) noexcept { GetAccessor().Erase(voxel); }
+
+		/**
+		 * Activates a box with one value, the cubes of the nodes fully inside
+		 * becoming single tiles
+		 * @param min: Minimum voxel of the box
+		 * @param max: Maximum voxel of the box, included
+		 */
+		void			Fill(const Maths::IVec3& min, const Maths::IVec3& max, BlockId value) noexcept;
+
+		/**
+		 * Replaces the voxels of a chunk, the blocks other than BACKGROUND being active
+		 * @param voxels: Chunk::VOLUME blocks, in the order of ChunkPos::LocalIndex
+		 */
+		void			InsertChunk(const Maths::ChunkPos& pos, std::span<const BlockId> voxels) noexcept;
+		void			InsertChunk(const Maths::ChunkPos& pos, const Chunk& chunk) noexcept;
+
+		/**
+		 * Replaces the leaves and lower nodes of a single value by tiles, and removes the empty upper nodes
+		 */
+		void			Prune() noexcept;
+
+		void			Clear() noexcept;
+
+		/**
+		 * Calls f(voxel, value) for every active voxel, finding them by scanning
+		 * the masks so empty space costs one test per 64 slots. An active tile
+		 * calls f for each of its voxels
+		 */
+		template <class F>
+		void			ForEachActive(F&& f) const noexcept;
+
+		uint64_t		CountActive() const noexcept;
+		size_t			GetLeafCount() const noexcept { return m_leaves.size() - m_freeLeaves.size(); }
+		size_t			GetMemoryUsage() const noexcept;
+	};
+
+	template <bool Const>
+	inline void SparseGrid::ValueAccessor<Const>::Sync() noexcept
+	{
+		if (m_generation != m_grid->m_generation)
+		{
+			m_generation = m_grid->m_generation;
+			m_upper = nullptr;
+			m_lower = nullptr;
+			m_leaf = nullptr;
+		}
+	}
+
+	template <bool Const>
+	inline BlockId SparseGrid::ValueAccessor<Const>::Find(const Maths::IVec3& voxel, bool& active) noexcept
+	{
+		Sync();
+		if (m_leaf && (voxel & ~((1 << LEAF_SHIFT) - 1)) == m_leafKey)
+		{
+			const unsigned	offset{ LeafOffset(voxel) };
+			active = TestBit(m_leaf->activeMask, offset);
+			return m_leaf->values[offset];
+		}
+
+		if (!m_lower || (voxel & ~((1 << LOWER_SHIFT) - 1)) != m_lowerKey)
+		{
+			if (!m_upper || (voxel & ~((1 << UPPER_SHIFT) - 1)) != m_upperKey)
+			{
+				const auto	found{ m_grid->m_root.find(voxel & ~((1 << UPPER_SHIFT) - 1)) };
+				if (found == m_grid->m_root.end())
+				{
+					active = false;
+					return BACKGROUND;
+				}
+				m_upper = m_grid->m_uppers[found->second].get();
+				m_upperKey = m_upper->origin;
+			}
+
+			const unsigned	slot{ UpperOffset(voxel) };
+			if (!TestBit(m_upper->childMask, slot))
+			{
+				active = TestBit(m_upper->valueMask, slot);
+				return static_cast<BlockId>(m_upper->slots[slot]);
+			}
+			m_lower = m_grid->m_lowers[m_upper->slots[slot]].get();
+			m_lowerKey = m_lower->origin;
+		}
+
+		const unsigned	slot{ LowerOffset(voxel) };
+		if (!TestBit(m_lower->childMask, slot))
+		{
+			active = TestBit(m_lower->valueMask, slot);
+			return static_cast<BlockId>(m_lower->slots[slot]);
+		}
+		m_leaf = m_grid->m_leaves[m_lower->slots[slot]].get();
+		m_leafKey = m_leaf->origin;
+
+		const unsigned	offset{ LeafOffset(voxel) };
+		active = TestBit(m_leaf->activeMask, offset);
+		return m_leaf->values[offset];
+	}
+
+	template <bool Const>
+	inline auto SparseGrid::ValueAccessor<Const>::Touch(const Maths::IVec3& voxel) noexcept -> Leaf& requires (!Const)
+	{
+		Sync();
+		if (m_leaf && (voxel & ~((1 << LEAF_SHIFT) - 1)) == m_leafKey)
+			return *m_leaf;
+
+		if (!m_lower || (voxel & ~((1 << LOWER_SHIFT) - 1)) != m_lowerKey)
+		{
+			if (!m_upper || (voxel & ~((1 << UPPER_SHIFT) - 1)) != m_upperKey)
+			{
+				m_upper = &m_grid->TouchUpper(voxel);
+				m_upperKey = m_upper->origin;
+			}
+			m_lower = &m_grid->TouchLower(*m_upper, voxel);
+			m_lowerKey = m_lower->origin;
+		}
+		m_leaf = &m_grid->TouchLeaf(*m_lower, voxel);
+		m_leafKey = m_leaf->origin;
+		return *m_leaf;
+	}
+
+	template <bool Const>
+	inline BlockId SparseGrid::ValueAccessor<Const>::Get(const Maths::IVec3& voxel) noexcept
+	{
+		// The leaf hit is kept small enough to be inlined in the loops of the callers
+		if (m_leaf && m_generation == m_grid->m_generation && (voxel & ~((1 << LEAF_SHIFT) - 1)) == m_leafKey)
+			return m_leaf->values[LeafOffset(voxel)];
+
+		bool	active;
+		return Find(voxel, active);
+	}
+
+	template <bool Const>
+	inline bool SparseGrid::ValueAccessor<Const>::IsActive(const Maths::IVec3& voxel) noexcept
+	{
+		bool	active;
+		Find(voxel, active);
+		return active;
+	}
+
+	template <bool Const>
+	inline void SparseGrid::ValueAccessor<Const>::Set(const Maths::IVec3& voxel, BlockId value) noexcept requires (!Const)
+	{
+		bool	active;
+		if (Find(voxel, active) == value && active)
+			return;
+
+		Leaf&			leaf{ Touch(voxel) };
+		const unsigned	offset{ LeafOffset(voxel) };
+		leaf.values[offset] = value;
+		SetBit(leaf.activeMask, offset);
+	}
+
+	template <bool Const>
+	inline void SparseGrid::ValueAccessor<Const>::Erase(const Maths::IVec3& voxel) noexcept requires (!Const)
+	{
+		bool	active;
+		Find(voxel, active);
+		if (!active)
+			return;
+
+		Leaf&			leaf{ Touch(voxel) };
+		const unsigned	offset{ LeafOffset(voxel) };
+		leaf.values[offset] = BACKGROUND;
+		ClearBit(leaf.activeMask, offset);
+	}
+
+	template <class F>
+	inline void SparseGrid::ForEachVoxel(const Maths::IVec3& min, int size, BlockId value, F& f) noexcept
+	{
+		for (int z{ 0 }; z < size; ++z)
+			for (int y{ 0 }; y < size; ++y)
+				for (int x{ 0 }; x < size; ++x)
+					f(min + Maths::IVec3(x, y, z), value);
+	}
+
+	template <class F>
+	inline void SparseGrid::ForEachActive(F&& f) const noexcept
+	{
+		for (const auto& [key, upperIndex] : m_root)
+		{
+			const UpperNode&	upper{ *m_uppers[upperIndex] };
+			for (unsigned upperWord{ 0 }; upperWord < UpperNode::SIZE / 64; ++upperWord)
+			{
+				for (uint64_t upperBits{ upper.childMask[upperWord] | upper.valueMask[upperWord] }; upperBits != 0; upperBits &= upperBits - 1)
+				{
+					const unsigned		upperSlot{ upperWord * 64 + std::countr_zero(upperBits) };
+					const Maths::IVec3	lowerMin{ upper.origin + SlotOffset<5>(upperSlot, LOWER_SHIFT) };
+					if (!TestBit(upper.childMask, upperSlot))
+					{
+						ForEachVoxel(lowerMin, 1 << LOWER_SHIFT, static_cast<BlockId>(upper.slots[upperSlot]), f);
+						continue;
+					}
+
+					const LowerNode&	lower{ *m_lowers[upper.slots[upperSlot]] };
+					for (unsigned lowerWord{ 0 }; lowerWord < LowerNode::SIZE / 64; ++lowerWord)
+					{
+						for (uint64_t lowerBits{ lower.childMask[lowerWord] | lower.valueMask[lowerWord] }; lowerBits != 0; lowerBits &= lowerBits - 1)
+						{
+							const unsigned		lowerSlot{ lowerWord * 64 + std::countr_zero(lowerBits) };
+							const Maths::IVec3	leafMin{ lowerMin + SlotOffset<4>(lowerSlot, LEAF_SHIFT) };
+							if (!TestBit(lower.childMask, lowerSlot))
+							{
+								ForEachVoxel(leafMin, 1 << LEAF_SHIFT, static_cast<BlockId>(lower.slots[lowerSlot]), f);
+								continue;
+							}
+
+							const LeafNode&	leaf{ *m_leaves[lower.slots[lowerSlot]] };
+							for (unsigned leafWord{ 0 }; leafWord < LeafNode::SIZE / 64; ++leafWord)
+							{
+								for (uint64_t bits{ leaf.activeMask[leafWord] }; bits != 0; bits &= bits - 1)
+								{
+									const unsigned	offset{ leafWord * 64 + std::countr_zero(bits) };
+									f(leafMin + SlotOffset<3>(offset, 0), leaf.values[offset]);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Resource.h"
+#include "Chunk.h"
+#include "SparseVoxelOctree.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Maths/IVec3.hpp"
+#include "Maths/ChunkPos.hpp"
+#include "Maths/Ray.hpp"
+
+namespace Core::Datastructure
+{
+	/**
+	 * Sparse voxel octree where identical subtrees are stored once, over a cube of
+	 * 2^depth voxels per side. Every node is hash-consed when built, so a subtree
+	 * repeated anywhere in the world, at any level, points to the same node.
+	 * Nodes are never modified: an edit rebuilds the path from the changed cube
+	 * to the root, and the nodes no longer reachable stay in the pool until
+	 * CollectGarbage()
+	 */
+	class SparseVoxelDag : public Resources::Resource
+	{
+	public:
+		using RayHit = SparseVoxelOctree::RayHit;
+
+		static constexpr BlockId	EMPTY{ 0 };
+		static constexpr unsigned	MAX_DEPTH{ 30 };
+
+		/**
+		 * A child is either a node index, or a block covering the whole child if VALUE_BIT is set
+		 */
+		static constexpr uint32_t	VALUE_BIT{ 1u << 31 };
+
+		struct Node
+		{
+			uint32_t	children[8];
+
+			bool	operator== (const Node& n) const noexcept = default;
+		};
+
+	protected:
+		std::vector<Node>		m_nodes;
+		std::vector<uint32_t>	m_freeNodes;
+		// Open addressing set of the live node indices, keyed by their children
+		std::vector<uint32_t>	m_table;
+		size_t					m_tableCount{ 0 };
+		uint32_t				m_root{ VALUE_BIT | EMPTY };
+		Maths::IVec3			m_origin;
+		unsigned				m_depth;
+
+		static bool		IsValue(uint32_t child) noexcept { return (child & VALUE_BIT) != 0; }
+		static BlockId	ValueOf(uint32_t child) noexcept { return static_cast<BlockId>(child); }
+
+		/**
+		 * Returns the existing node with these children, or adds it. Children all
+		 * holding the same block are collapsed into that block
+		 */
+		uint32_t	Intern(const Node& node) noexcept;
+		void		Rehash(size_t size) noexcept;
+
+		uint32_t	BuildDense(const BlockId* voxels, unsigned stride, const Maths::IVec3& min, unsigned size) noexcept;
+		uint32_t	BuildOctree(const std::vector<SparseVoxelOctree::Node>& nodes, uint32_t node) noexcept;
+
+		/**
+		 * Replaces the cube of a level holding a voxel, rebuilding the nodes from it to the root
+		 */
+		void		ReplaceCube(const Maths::IVec3& local, unsigned level, uint32_t child) noexcept;
+	public:
+		/**
+		 * Creates an empty DAG
+		 * @param depth: Log2 of the number of voxels per side
+		 * @param origin: Voxel at the minimum corner of the DAG
+		 */
+		explicit SparseVoxelDag(unsigned depth, const Maths::IVec3& origin = {}) noexcept;
+		~SparseVoxelDag() noexcept override = default;
+
+		unsigned		GetDepth() const noexcept { return m_depth; }
+		int				GetSize() const noexcept { return 1 << m_depth; }
+		const Maths::IVec3&	GetOrigin() const noexcept { return m_origin; }
+
+		bool			Contains(const Maths::IVec3& voxel) const noexcept;
+
+		/**
+		 * Block of a voxel, EMPTY outside of the DAG
+		 */
+		BlockId			Get(const Maths::IVec3& voxel) const noexcept;
+
+		/**
+		 * Changes a voxel, rebuilding the depth nodes of its path
+		 */
+		void			Set(const Maths::IVec3& voxel, BlockId block) noexcept;
+
+		/**
+		 * Replaces the voxels of a chunk, only the path above it is rebuilt
+		 */
+		void			InsertChunk(const Maths::ChunkPos& pos, const Chunk& chunk) noexcept;
+
+		/**
+		 * Replaces the voxels of a chunk sized cube
+		 * @param voxels: Chunk::VOLUME blocks, in the order of ChunkPos::LocalIndex
+		 */
+		void			InsertChunk(const Maths::ChunkPos& pos, std::span<const BlockId> voxels) noexcept;
+
+		/**
+		 * Replaces the whole DAG by the deduplicated content of an octree, taking its depth and origin
+		 */
+		void			Build(const SparseVoxelOctree& octree) noexcept;
+
+		/**
+		 * Finds the first non empty voxel along a ray, visiting the children front to back
+		 * @param ray: Ray in voxel units, a voxel spans [v, v + 1)
+		 * @param hit: Receives the voxel hit, unchanged on a miss
+		 * @return Whether a voxel was hit before maxDistance
+		 */
+		bool			Raycast(const Maths::Ray& ray, RayHit& hit, float maxDistance = 1e30f) const noexcept;
+
+		/**
+		 * Frees the nodes no longer reachable from the root, best called after a batch of edits
+		 * @return Number of nodes freed
+		 */
+		size_t			CollectGarbage() noexcept;
+
+		/**
+		 * Empties the DAG and frees the pool
+		 */
+		void			Clear() noexcept;
+
+		/**
+		 * Nodes in the pool, including the garbage not collected yet
+		 */
+		size_t			GetNodeCount() const noexcept { return m_nodes.size() - m_freeNodes.size(); }
+
+		/**
+		 * Nodes the same content takes in a SparseVoxelOctree, to measure the deduplication
+		 */
+		uint64_t		CountOctreeNodes() const noexcept;
+
+		size_t			GetMemoryUsage() const noexcept;
+	};
+}
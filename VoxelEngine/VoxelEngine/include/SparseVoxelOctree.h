@@ -0,0 +1,156 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Resource.h"
+#include "Chunk.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Maths/IVec3.hpp"
+#include "Maths/ChunkPos.hpp"
+#include "Maths/Ray.hpp"
+
+namespace Core::Datastructure
+{
+	/**
+	 * Octree over a cube of 2^depth voxels per side, meant for large and mostly
+	 * static terrain. The nodes are stored in one pool, the 8 children of a node
+	 * next to each other so a node only keeps the index of the first one. A
+	 * subtree holding a single block is always collapsed into one leaf, so empty
+	 * and solid areas cost one node whatever their size
+	 */
+	class SparseVoxelOctree : public Resources::Resource
+	{
+	public:
+		static constexpr BlockId	EMPTY{ 0 };
+		static constexpr unsigned	MAX_DEPTH{ 30 };
+
+		struct Node
+		{
+			// Index of the first of the 8 children, NO_CHILDREN for a leaf
+			uint32_t	children;
+			// Block of the whole node if it is a leaf
+			BlockId		block;
+		};
+
+		/**
+		 * Leaf returned by the queries, a cube of voxels of the same block
+		 */
+		struct Cell
+		{
+			Maths::IVec3	min;
+			int				size;
+			BlockId			block;
+		};
+
+		struct RayHit
+		{
+			float			distance;
+			Maths::IVec3	voxel;
+			BlockId			block;
+		};
+
+		static constexpr uint32_t	NO_CHILDREN{ 0 };
+
+	protected:
+		// The root is at 0, so no group of children can start there
+		std::vector<Node>		m_nodes;
+		std::vector<uint32_t>	m_freeGroups;
+		Maths::IVec3			m_origin;
+		unsigned				m_depth;
+
+		uint32_t	AllocateGroup(BlockId block) noexcept;
+		void		FreeSubtree(uint32_t node) noexcept;
+
+		/**
+		 * Merges the children of a node into it if they are leaves of the same block
+		 * @return Whether the node was collapsed
+		 */
+		bool		TryCollapse(uint32_t node) noexcept;
+
+		/**
+		 * Builds the subtree of a cube of a dense array, collapsing it while going up
+		 * @param voxels: Dense array of stride x 1, y stride, z stride^2
+		 */
+		Node		BuildDense(const BlockId* voxels, unsigned stride, const Maths::IVec3& min, unsigned size) noexcept;
+
+		/**
+		 * Finds the node covering a cube at a level, splitting the leaves on the way
+		 * @param path: Receives the nodes from the root, for the collapse afterwards
+		 * @return Number of nodes in the path, the last one being the node found
+		 */
+		unsigned	Descend(const Maths::IVec3& local, unsigned level, uint32_t (&path)[MAX_DEPTH + 1]) noexcept;
+	public:
+		/**
+		 * Creates an empty octree
+		 * @param depth: Log2 of the number of voxels per side
+		 * @param origin: Voxel at the minimum corner of the octree
+		 */
+		explicit SparseVoxelOctree(unsigned depth, const Maths::IVec3& origin = {}) noexcept;
+		~SparseVoxelOctree() noexcept override = default;
+
+		unsigned		GetDepth() const noexcept { return m_depth; }
+		int				GetSize() const noexcept { return 1 << m_depth; }
+		const Maths::IVec3&	GetOrigin() const noexcept { return m_origin; }
+
+		bool			Contains(const Maths::IVec3& voxel) const noexcept;
+
+		/**
+		 * Block of a voxel, EMPTY outside of the octree
+		 */
+		BlockId			Get(const Maths::IVec3& voxel) const noexcept;
+
+		/**
+		 * Changes a voxel, splitting and collapsing the nodes on its path
+		 */
+		void			Set(const Maths::IVec3& voxel, BlockId block) noexcept;
+
+		/**
+		 * Fills a cube aligned on its size with one block, freeing the subtree under it
+		 * @param level: Log2 of the size of the cube
+		 */
+		void			Fill(const Maths::IVec3& voxel, unsigned level, BlockId block) noexcept;
+
+		/**
+		 * Replaces the voxels of a chunk, built bottom-up from its dense decoding
+		 */
+		void			InsertChunk(const Maths::ChunkPos& pos, const Chunk& chunk) noexcept;
+
+		/**
+		 * Replaces the voxels of a chunk sized cube
+		 * @param voxels: Chunk::VOLUME blocks, in the order of ChunkPos::LocalIndex
+		 */
+		void			InsertChunk(const Maths::ChunkPos& pos, std::span<const BlockId> voxels) noexcept;
+
+		/**
+		 * Collects the non empty leaves overlapping a box
+		 * @param min: Minimum voxel of the box
+		 * @param max: Maximum voxel of the box, included
+		 * @param cells: Receives the leaves, appended
+		 */
+		void			QueryBox(const Maths::IVec3& min, const Maths::IVec3& max, std::vector<Cell>& cells) const noexcept;
+
+		/**
+		 * Finds the first non empty voxel along a ray, visiting the children front to back
+		 * @param ray: Ray in voxel units, a voxel spans [v, v + 1)
+		 * @param hit: Receives the voxel hit, unchanged on a miss
+		 * @return Whether a voxel was hit before maxDistance
+		 */
+		bool			Raycast(const Maths::Ray& ray, RayHit& hit, float maxDistance = 1e30f) const noexcept;
+
+		/**
+		 * Empties the octree and frees the pool
+		 */
+		void			Clear() noexcept;
+
+		/**
+		 * Node pool, the root at 0, the groups of the free list holding stale nodes
+		 */
+		const std::vector<Node>&	GetNodes() const noexcept { return m_nodes; }
+
+		size_t			GetNodeCount() const noexcept { return m_nodes.size() - m_freeGroups.size() * 8; }
+		size_t			GetMemoryUsage() const noexcept;
+	};
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "Maths/Vec3.hpp"
+#include "Maths/Quaternion.hpp"
+#include "Maths/Mat4.hpp"
+
+namespace Core::Datastructure
+{
+	/**
+	 * Scene transforms stored in flat arrays, each node after its parent.
+	 * Setting a local transform only flags the node, the world matrices of the
+	 * flagged nodes and of their descendants are recomputed by Update(), in a
+	 * single pass over the arrays. A hierarchy without changes costs one
+	 * test per frame
+	 */
+	class TransformHierarchy
+	{
+	public:
+		static constexpr unsigned	NO_PARENT{ ~0u };
+
+	protected:
+		std::vector<unsigned>			m_parents;
+		std::vector<unsigned>			m_depths;
+		std::vector<Maths::Vec3>		m_positions;
+		std::vector<Maths::Quaternion>	m_rotations;
+		std::vector<Maths::Vec3>		m_scales;
+		std::vector<Maths::Mat4>		m_worldMatrices;
+		std::vector<uint8_t>			m_dirty;
+		unsigned						m_firstDirty{ NO_PARENT };
+
+		// Dirty nodes of each depth, reused by the parallel update
+		std::vector<std::vector<unsigned>>	m_levels;
+
+		void	MarkDirty(unsigned node) noexcept;
+		void	ComputeWorldMatrix(unsigned node) noexcept;
+	public:
+		TransformHierarchy() noexcept = default;
+
+		/**
+		 * Adds a node at the end of the arrays
+		 * @param parent: Index of an existing node, NO_PARENT for a root
+		 * @return Index of the new node
+		 */
+		unsigned	Add(unsigned parent = NO_PARENT, const Maths::Vec3& position = {},
+						const Maths::Quaternion& rotation = {}, const Maths::Vec3& scale = Maths::Vec3(1.f)) noexcept;
+
+		void		Reserve(size_t count) noexcept;
+		void		Clear() noexcept;
+
+		size_t		Size() const noexcept { return m_parents.size(); }
+		unsigned	GetParent(unsigned node) const noexcept { return m_parents[node]; }
+
+		const Maths::Vec3&			GetLocalPosition(unsigned node) const noexcept { return m_positions[node]; }
+		const Maths::Quaternion&	GetLocalRotation(unsigned node) const noexcept { return m_rotations[node]; }
+		const Maths::Vec3&			GetLocalScale(unsigned node) const noexcept { return m_scales[node]; }
+
+		void		SetLocalPosition(unsigned node, const Maths::Vec3& position) noexcept;
+		void		SetLocalRotation(unsigned node, const Maths::Quaternion& rotation) noexcept;
+		void		SetLocalScale(unsigned node, const Maths::Vec3& scale) noexcept;
+		void		SetLocal(unsigned node, const Maths::Vec3& position, const Maths::Quaternion& rotation, const Maths::Vec3& scale) noexcept;
+
+		/**
+		 * Checks if a world matrix has to be recomputed by Update()
+		 */
+		bool		IsDirty() const noexcept { return m_firstDirty != NO_PARENT; }
+
+		/**
+		 * Recomputes the world matrices of the changed nodes and their descendants
+		 * @param parallel: Whether the nodes of a same depth are computed in parallel,
+		 * worth it when many nodes changed
+		 */
+		void		Update(bool parallel = false) noexcept;
+
+		/**
+		 * World matrix of a node, as of the last Update()
+		 */
+		const Maths::Mat4&	GetWorldMatrix(unsigned node) const noexcept { return m_worldMatrices[node]; }
+
+		/**
+		 * Computes the local matrix of a node, translation * rotation * scale
+		 */
+		Maths::Mat4	GetLocalMatrix(unsigned node) const noexcept;
+	};
+}
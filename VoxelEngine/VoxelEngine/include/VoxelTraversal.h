@@ -0,0 +1,135 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SparseVoxelOctree.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "Maths/IVec3.hpp"
+#include "Maths/Vec3.hpp"
+#include "Maths/ChunkPos.hpp"
+#include "Maths/Ray.hpp"
+
+/**
+ * Descent and ray traversal shared by the octree and the DAG, which only differ
+ * in how a node stores its children. Internal to the two implementations
+ */
+namespace Core::Datastructure::VoxelTraversal
+{
+	/**
+	 * Child of a node of a level holding a voxel, the children being ordered x, y then z
+	 */
+	inline unsigned	ChildIndex(const Maths::IVec3& local, unsigned level) noexcept
+	{
+		const unsigned	bit{ level - 1 };
+		return (local.x >> bit & 1) | (local.y >> bit & 1) << 1 | (local.z >> bit & 1) << 2;
+	}
+
+	inline Maths::IVec3	ChildOffset(unsigned child, int size) noexcept
+	{
+		return Maths::IVec3(child & 1 ? size : 0, child & 2 ? size : 0, child & 4 ? size : 0);
+	}
+
+	/**
+	 * Clips [nearT, farT] to a cube, a null direction component giving NaN leaves the bounds unchanged
+	 */
+	inline bool	ClipCube(const float (&origin)[3], const float (&inverse)[3], const Maths::IVec3& min, int size,
+						 float& nearT, float& farT) noexcept
+	{
+		const int	bounds[3]{ min.x, min.y, min.z };
+		for (unsigned axis{ 0 }; axis < 3; ++axis)
+		{
+			const float	t1{ (static_cast<float>(bounds[axis]) - origin[axis]) * inverse[axis] };
+			const float	t2{ (static_cast<float>(bounds[axis] + size) - origin[axis]) * inverse[axis] };
+			nearT = std::max(nearT, std::min(t1, t2));
+			farT = std::min(farT, std::max(t1, t2));
+		}
+		return nearT <= farT;
+	}
+
+	/**
+	 * Whether a chunk is one of the cubes of a tree, inside it and aligned on the chunk size,
+	 * which is what InsertChunk requires
+	 * @param local: Origin of the chunk relative to the minimum corner of the tree
+	 * @param depth: Depth of the tree
+	 */
+	inline bool	IsChunkCube(const Maths::IVec3& local, unsigned depth) noexcept
+	{
+		const unsigned	size{ 1u << depth };
+		return depth >= Maths::ChunkPos::Shift && static_cast<unsigned>(local.x) < size
+			&& static_cast<unsigned>(local.y) < size && static_cast<unsigned>(local.z) < size
+			&& (local & Maths::ChunkPos::Mask) == Maths::IVec3();
+	}
+
+	/**
+	 * Finds the first non empty voxel along a ray, visiting the children front to back
+	 * @tparam MaxDepth: Maximum depth of the tree, sizes the traversal stack
+	 * @param origin: Voxel at the minimum corner of the tree
+	 * @param depth: Depth of the tree
+	 * @param root: Root node
+	 * @param leaf: bool(uint32_t node, BlockId& block), whether a node is a leaf, and its block if so
+	 * @param child: uint32_t(uint32_t node, unsigned index), child of a node that isn't a leaf
+	 * @return Whether a voxel was hit
+	 */
+	template <unsigned MaxDepth, typename LeafFunction, typename ChildFunction>
+	bool	Raycast(const Maths::Ray& ray, const Maths::IVec3& origin, unsigned depth, uint32_t root, float maxDistance,
+					SparseVoxelOctree::RayHit& hit, LeafFunction&& leaf, ChildFunction&& child) noexcept
+	{
+		struct Entry
+		{
+			uint32_t		node;
+			Maths::IVec3	min;
+			unsigned		level;
+			float			nearT;
+		};
+
+		const Maths::Vec3	inverse{ ray.InverseDirection() };
+		const float			o[3]{ ray.origin.x - static_cast<float>(origin.x), ray.origin.y - static_cast<float>(origin.y),
+								  ray.origin.z - static_cast<float>(origin.z) };
+		const float			inv[3]{ inverse.x, inverse.y, inverse.z };
+
+		// Children in the order child ^ mask are front to back along the ray
+		const unsigned		mask{ (ray.direction.x < 0.f ? 1u : 0u) | (ray.direction.y < 0.f ? 2u : 0u) | (ray.direction.z < 0.f ? 4u : 0u) };
+
+		float	nearT{ 0.f }, farT{ maxDistance };
+		if (!ClipCube(o, inv, Maths::IVec3(), 1 << depth, nearT, farT))
+			return false;
+
+		Entry		stack[7 * MaxDepth + 1];
+		unsigned	top{ 0 };
+		stack[top++] = Entry{ root, Maths::IVec3(), depth, nearT };
+
+		while (top > 0)
+		{
+			const Entry	entry{ stack[--top] };
+			BlockId		block;
+			if (leaf(entry.node, block))
+			{
+				if (block == SparseVoxelOctree::EMPTY)
+					continue;
+
+				// The entry point is on the boundary of the leaf, it is clamped inside
+				const int			last{ (1 << entry.level) - 1 };
+				const Maths::IVec3	voxel{ Maths::IVec3::Floor(Maths::Vec3(o[0], o[1], o[2]) + ray.direction * entry.nearT) };
+				hit.distance = entry.nearT;
+				hit.voxel = Maths::IVec3(std::clamp(voxel.x - entry.min.x, 0, last), std::clamp(voxel.y - entry.min.y, 0, last),
+										 std::clamp(voxel.z - entry.min.z, 0, last)) + entry.min + origin;
+				hit.block = block;
+				return true;
+			}
+
+			// Pushed back to front so the nearest child is popped first
+			const int	half{ 1 << (entry.level - 1) };
+			for (unsigned i{ 8 }; i-- > 0;)
+			{
+				const unsigned		index{ i ^ mask };
+				const Maths::IVec3	childMin{ entry.min + ChildOffset(index, half) };
+				float				childNear{ entry.nearT }, childFar{ maxDistance };
+				if (ClipCube(o, inv, childMin, half, childNear, childFar))
+					stack[top++] = Entry{ child(entry.node, index), childMin, entry.level - 1, childNear };
+			}
+		}
+		return false;
+	}
+}
@@ -0,0 +1,356 @@
+#include "Chunk.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace Core::Datastructure
+{
+	static_assert(Chunk::VOLUME <= UINT16_MAX, "the palette counts are 16 bits");
+	static_assert(Chunk::VOLUME % 64 == 0, "the packed indices end on a word");
+
+	namespace
+	{
+		unsigned BitsFor(size_t paletteSize) noexcept
+		{
+			return paletteSize <= 1 ? 0 : static_cast<unsigned>(std::bit_width(paletteSize - 1));
+		}
+
+		size_t WordCount(unsigned bits) noexcept
+		{
+			return bits == 0 ? 0 : static_cast<size_t>(Chunk::VOLUME) * bits / 64 + 1;
+		}
+
+		/**
+		 * Calls f(index, entry) for every voxel, reading the words in order
+		 */
+		template <class F>
+		void ForEachIndex(const uint64_t* words, unsigned bits, F&& f) noexcept
+		{
+			const unsigned	mask{ (1u << bits) - 1 };
+			uint64_t		current{ words[0] };
+			unsigned		available{ 64 };
+			size_t			next{ 1 };
+
+			for (unsigned i{ 0 }; i < Chunk::VOLUME; ++i)
+			{
+				if (available >= bits)
+				{
+					f(i, static_cast<unsigned>(current) & mask);
+					current >>= bits;
+					available -= bits;
+				}
+				else
+				{
+					// The index straddles two words
+					const uint64_t	word{ words[next++] };
+					f(i, static_cast<unsigned>(current | word << available) & mask);
+					current = word >> (bits - available);
+					available += 64 - bits;
+				}
+			}
+		}
+
+		void PackIndices(const uint16_t* entries, unsigned bits, uint64_t* words) noexcept
+		{
+			uint64_t	current{ 0 };
+			unsigned	filled{ 0 };
+			size_t		next{ 0 };
+
+			for (unsigned i{ 0 }; i < Chunk::VOLUME; ++i)
+			{
+				const uint64_t	entry{ entries[i] };
+				current |= entry << filled;
+				filled += bits;
+				if (filled >= 64)
+				{
+					words[next++] = current;
+					filled -= 64;
+					current = filled == 0 ? 0 : entry >> (bits - filled);
+				}
+			}
+		}
+	}
+
+	Chunk::Chunk(BlockId block) noexcept
+	{
+		Fill(block);
+	}
+
+	unsigned Chunk::FindOrAdd(BlockId block) noexcept
+	{
+		// Palettes are small, a linear search beats hashing
+		const auto	found{ std::find(m_palette.begin(), m_palette.end(), block) };
+		if (found != m_palette.end())
+		{
+			const unsigned	entry{ static_cast<unsigned>(found - m_palette.begin()) };
+			if (m_counts[entry] == 0)
+				--m_unusedEntries;
+			return entry;
+		}
+
+		if (m_unusedEntries > 0)
+		{
+			const unsigned	entry{ static_cast<unsigned>(std::find(m_counts.begin(), m_counts.end(), 0) - m_counts.begin()) };
+			m_palette[entry] = block;
+			--m_unusedEntries;
+			return entry;
+		}
+
+		const unsigned	entry{ static_cast<unsigned>(m_palette.size()) };
+		m_palette.push_back(block);
+		m_counts.push_back(0);
+		if (entry >> m_bits != 0)
+			Repack(m_bits + 1);
+		return entry;
+	}
+
+	void Chunk::Repack(unsigned bits) noexcept
+	{
+		ZoneScoped
+		std::vector<uint16_t>	entries(VOLUME);
+		ReadEntries(entries.data());
+
+		m_bits = bits;
+		m_words.assign(WordCount(bits), 0);
+		if (bits != 0)
+			PackIndices(entries.data(), bits, m_words.data());
+		m_words.shrink_to_fit();
+	}
+
+	void Chunk::ReadEntries(uint16_t* entries) const noexcept
+	{
+		if (m_storage == EChunkStorage::RLE)
+		{
+			for (unsigned column{ 0 }; column < COLUMNS; ++column)
+			{
+				const unsigned	base{ (column & Coords::Mask) | (column >> Coords::Shift) << (Coords::Shift * 2) };
+				unsigned		y{ 0 };
+				for (unsigned run{ m_columnStarts[column] }; run < m_columnStarts[column + 1]; ++run)
+				{
+					const unsigned	end{ (m_runs[run] & Coords::Mask) + 1u };
+					const uint16_t	entry{ static_cast<uint16_t>(m_runs[run] >> RUN_ENTRY_SHIFT) };
+					for (; y < end; ++y)
+						entries[base + (y << Coords::Shift)] = entry;
+				}
+			}
+		}
+		else if (m_bits == 0)
+			std::fill_n(entries, VOLUME, uint16_t{ 0 });
+		else
+			ForEachIndex(m_words.data(), m_bits, [=](unsigned i, unsigned entry) { entries[i] = static_cast<uint16_t>(entry); });
+	}
+
+	void Chunk::StoreEntries(const uint16_t* entries) noexcept
+	{
+		m_bits = BitsFor(m_palette.size());
+
+		size_t	runs{ 0 };
+		for (unsigned column{ 0 }; column < COLUMNS; ++column)
+		{
+			const unsigned	base{ (column & Coords::Mask) | (column >> Coords::Shift) << (Coords::Shift * 2) };
+			++runs;
+			for (unsigned y{ 1 }; y < static_cast<unsigned>(Coords::Size); ++y)
+				runs += entries[base + (y << Coords::Shift)] != entries[base + ((y - 1) << Coords::Shift)];
+		}
+
+		// The column starts cost a fixed 2 KB, so only long runs make it worth it
+		const size_t	paletteBytes{ WordCount(m_bits) * sizeof(uint64_t) };
+		const size_t	rleBytes{ (runs + COLUMNS + 1) * sizeof(uint16_t) };
+		if (m_bits == 0 || m_palette.size() > MAX_RLE_PALETTE || rleBytes >= paletteBytes)
+		{
+			m_storage = EChunkStorage::PALETTE;
+			m_runs.clear();
+			m_runs.shrink_to_fit();
+			m_columnStarts.clear();
+			m_columnStarts.shrink_to_fit();
+			m_words.assign(WordCount(m_bits), 0);
+			m_words.shrink_to_fit();
+			if (m_bits != 0)
+				PackIndices(entries, m_bits, m_words.data());
+			return;
+		}
+
+		m_storage = EChunkStorage::RLE;
+		m_words.clear();
+		m_words.shrink_to_fit();
+		m_runs.clear();
+		m_runs.reserve(runs);
+		m_columnStarts.resize(COLUMNS + 1);
+		for (unsigned column{ 0 }; column < COLUMNS; ++column)
+		{
+			const unsigned	base{ (column & Coords::Mask) | (column >> Coords::Shift) << (Coords::Shift * 2) };
+			m_columnStarts[column] = static_cast<uint16_t>(m_runs.size());
+			for (unsigned y{ 0 }; y < static_cast<unsigned>(Coords::Size); ++y)
+			{
+				const uint16_t	entry{ entries[base + (y << Coords::Shift)] };
+				const bool		last{ y == Coords::Mask || entries[base + ((y + 1) << Coords::Shift)] != entry };
+				if (last)
+					m_runs.push_back(static_cast<uint16_t>(entry << RUN_ENTRY_SHIFT | y));
+			}
+		}
+		m_columnStarts[COLUMNS] = static_cast<uint16_t>(m_runs.size());
+	}
+
+	void Chunk::Set(unsigned index, BlockId block) noexcept
+	{
+		if (Get(index) == block)
+			return;
+
+		// Editing runs would shift every column after, the indices are unpacked instead
+		if (m_storage == EChunkStorage::RLE)
+		{
+			std::vector<uint16_t>	entries(VOLUME);
+			ReadEntries(entries.data());
+			m_storage = EChunkStorage::PALETTE;
+			m_runs.clear();
+			m_runs.shrink_to_fit();
+			m_columnStarts.clear();
+			m_columnStarts.shrink_to_fit();
+			m_words.assign(WordCount(m_bits), 0);
+			PackIndices(entries.data(), m_bits, m_words.data());
+		}
+
+		const unsigned	previous{ m_bits == 0 ? 0 : ReadIndex(index) };
+
+		// Looked up first, as adding an entry may widen the indices
+		const unsigned	entry{ FindOrAdd(block) };
+		if (--m_counts[previous] == 0)
+			++m_unusedEntries;
+		++m_counts[entry];
+		WriteIndex(index, entry);
+	}
+
+	void Chunk::Fill(BlockId block) noexcept
+	{
+		m_palette.assign(1, block);
+		m_counts.assign(1, static_cast<uint16_t>(VOLUME));
+		m_words.clear();
+		m_words.shrink_to_fit();
+		m_runs.clear();
+		m_runs.shrink_to_fit();
+		m_columnStarts.clear();
+		m_columnStarts.shrink_to_fit();
+		m_storage = EChunkStorage::PALETTE;
+		m_bits = 0;
+		m_unusedEntries = 0;
+	}
+
+	void Chunk::Fill(std::span<const BlockId> voxels) noexcept
+	{
+		ZoneScoped
+		// Sorted palette of the distinct blocks, from one bit per possible block
+		// Terrain comes in runs, skipping them avoids a chain of dependent updates
+		uint64_t	present[(UINT16_MAX + 1) / 64]{};
+		BlockId		last{ voxels[0] };
+		present[last >> 6] |= uint64_t{ 1 } << (last & 63);
+		for (const BlockId block : voxels)
+		{
+			if (block != last)
+			{
+				last = block;
+				present[block >> 6] |= uint64_t{ 1 } << (block & 63);
+			}
+		}
+
+		m_palette.clear();
+		for (unsigned word{ 0 }; word < std::size(present); ++word)
+		{
+			for (uint64_t bits{ present[word] }; bits != 0; bits &= bits - 1)
+				m_palette.push_back(static_cast<BlockId>(word * 64 + std::countr_zero(bits)));
+		}
+		m_counts.assign(m_palette.size(), 0);
+		m_unusedEntries = 0;
+
+		if (m_palette.size() == 1)
+		{
+			Fill(m_palette[0]);
+			return;
+		}
+
+		// Entry of each block id, only the ids of the palette are ever read
+		thread_local uint16_t	lookup[UINT16_MAX + 1];
+		for (size_t entry{ 0 }; entry < m_palette.size(); ++entry)
+			lookup[m_palette[entry]] = static_cast<uint16_t>(entry);
+
+		std::vector<uint16_t>	entries(VOLUME);
+		unsigned				runStart{ 0 };
+		for (unsigned i{ 0 }; i < VOLUME; ++i)
+		{
+			entries[i] = lookup[voxels[i]];
+			if (voxels[i] != voxels[runStart])
+			{
+				m_counts[entries[runStart]] += static_cast<uint16_t>(i - runStart);
+				runStart = i;
+			}
+		}
+		m_counts[entries[runStart]] += static_cast<uint16_t>(VOLUME - runStart);
+
+		StoreEntries(entries.data());
+	}
+
+	void Chunk::Read(std::span<BlockId> voxels) const noexcept
+	{
+		ZoneScoped
+		if (m_bits == 0)
+		{
+			std::fill_n(voxels.begin(), VOLUME, m_palette[0]);
+			return;
+		}
+
+		const BlockId*	palette{ m_palette.data() };
+		BlockId*		out{ voxels.data() };
+		if (m_storage == EChunkStorage::RLE)
+		{
+			ForEachRun([=](int x, int z, int begin, int end, BlockId block)
+			{
+				for (int y{ begin }; y < end; ++y)
+					out[Coords::LocalIndex(Maths::IVec3(x, y, z))] = block;
+			});
+			return;
+		}
+		ForEachIndex(m_words.data(), m_bits, [=](unsigned i, unsigned entry) { out[i] = palette[entry]; });
+	}
+
+	void Chunk::Compact() noexcept
+	{
+		if (m_bits == 0)
+			return;
+
+		ZoneScoped
+		std::vector<uint16_t>	entries(VOLUME);
+		ReadEntries(entries.data());
+
+		std::vector<uint16_t>	remap(m_palette.size(), 0);
+		size_t					kept{ 0 };
+		for (size_t entry{ 0 }; entry < m_palette.size(); ++entry)
+		{
+			if (m_counts[entry] == 0)
+				continue;
+			remap[entry] = static_cast<uint16_t>(kept);
+			m_palette[kept] = m_palette[entry];
+			m_counts[kept] = m_counts[entry];
+			++kept;
+		}
+		m_palette.resize(kept);
+		m_palette.shrink_to_fit();
+		m_counts.resize(kept);
+		m_counts.shrink_to_fit();
+		if (m_unusedEntries != 0)
+		{
+			for (uint16_t& entry : entries)
+				entry = remap[entry];
+			m_unusedEntries = 0;
+		}
+
+		if (kept == 1)
+			Fill(m_palette[0]);
+		else
+			StoreEntries(entries.data());
+	}
+
+	size_t Chunk::GetMemoryUsage() const noexcept
+	{
+		return sizeof(*this) + m_palette.capacity() * sizeof(BlockId) + m_counts.capacity() * sizeof(uint16_t)
+			 + m_words.capacity() * sizeof(uint64_t) + (m_runs.capacity() + m_columnStarts.capacity()) * sizeof(uint16_t);
+	}
+}
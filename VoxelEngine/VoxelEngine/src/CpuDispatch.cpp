@@ -0,0 +1,164 @@
+#include "CpuDispatch.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+namespace Core::Platform
+{
+	namespace
+	{
+		void Cpuid(unsigned leaf, unsigned subleaf, unsigned (&regs)[4]) noexcept
+		{
+#ifdef _MSC_VER
+			int	r[4];
+			__cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+			for (unsigned i{ 0 }; i < 4; ++i)
+				regs[i] = static_cast<unsigned>(r[i]);
+#else
+			__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+		}
+
+		uint64_t Xgetbv() noexcept
+		{
+#ifdef _MSC_VER
+			return _xgetbv(0);
+#else
+			unsigned	eax, edx;
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return static_cast<uint64_t>(edx) << 32 | eax;
+#endif
+		}
+
+		CpuFeatures DetectFeatures() noexcept
+		{
+			CpuFeatures	features;
+			unsigned	regs[4];
+
+			Cpuid(0, 0, regs);
+			const unsigned	maxLeaf{ regs[0] };
+			if (maxLeaf < 1)
+				return features;
+
+			Cpuid(1, 0, regs);
+			features.sse2 = (regs[3] & (1u << 26)) != 0;
+			features.sse4_1 = (regs[2] & (1u << 19)) != 0;
+			features.fma = (regs[2] & (1u << 12)) != 0;
+			features.f16c = (regs[2] & (1u << 29)) != 0;
+
+			// The wide registers are usable only if the OS saves them on context switches
+			const bool		osxsave{ (regs[2] & (1u << 27)) != 0 };
+			const uint64_t	xcr0{ osxsave ? Xgetbv() : 0 };
+			const bool		ymmSaved{ (xcr0 & 0x6) == 0x6 };
+			const bool		zmmSaved{ (xcr0 & 0xe6) == 0xe6 };
+
+			features.avx = ymmSaved && (regs[2] & (1u << 28)) != 0;
+			features.fma = features.fma && ymmSaved;
+			features.f16c = features.f16c && ymmSaved;
+
+			if (maxLeaf >= 7)
+			{
+				Cpuid(7, 0, regs);
+				features.avx2 = features.avx && (regs[1] & (1u << 5)) != 0;
+				features.bmi2 = (regs[1] & (1u << 8)) != 0;
+				features.avx512f = zmmSaved && (regs[1] & (1u << 16)) != 0;
+				features.avx512bw = features.avx512f && (regs[1] & (1u << 30)) != 0;
+				features.avx512vl = features.avx512f && (regs[1] & (1u << 31)) != 0;
+			}
+			return features;
+		}
+
+		ESimdLevel SupportedLevel(const CpuFeatures& f) noexcept
+		{
+			if (f.avx512f && f.avx512bw && f.avx512vl && f.avx2 && f.fma)
+				return ESimdLevel::AVX512;
+			if (f.avx2 && f.fma)
+				return ESimdLevel::AVX2;
+			if (f.sse4_1)
+				return ESimdLevel::SSE4_1;
+			if (f.sse2)
+				return ESimdLevel::SSE2;
+			return ESimdLevel::SCALAR;
+		}
+
+		/**
+		 * Reads the level asked by VOXEL_SIMD, returns false if it is not set or unknown
+		 */
+		bool OverrideLevel(ESimdLevel& level) noexcept
+		{
+			char	value[16]{};
+#ifdef _MSC_VER
+			size_t	size{ 0 };
+			if (getenv_s(&size, value, sizeof(value), "VOXEL_SIMD") != 0 || size == 0)
+				return false;
+#else
+			const char*	env{ std::getenv("VOXEL_SIMD") };
+			if (env == nullptr)
+				return false;
+			std::strncpy(value, env, sizeof(value) - 1);
+#endif
+			for (ESimdLevel l : { ESimdLevel::SCALAR, ESimdLevel::SSE2, ESimdLevel::SSE4_1, ESimdLevel::AVX2, ESimdLevel::AVX512 })
+			{
+				if (std::strcmp(value, ToString(l)) == 0)
+				{
+					level = l;
+					return true;
+				}
+			}
+			return false;
+		}
+	}
+
+	const char* ToString(ESimdLevel level) noexcept
+	{
+		switch (level)
+		{
+		case ESimdLevel::SSE2:
+			return "sse2";
+		case ESimdLevel::SSE4_1:
+			return "sse4.1";
+		case ESimdLevel::AVX2:
+			return "avx2";
+		case ESimdLevel::AVX512:
+			return "avx512";
+		default:
+			return "scalar";
+		}
+	}
+
+	CpuDispatch::CpuDispatch() noexcept : m_features{ DetectFeatures() }
+	{
+		m_supported = SupportedLevel(m_features);
+		m_level = m_supported;
+
+		std::string	message{ std::string("CPU dispatch: ") + ToString(m_supported) + " supported" };
+
+		ESimdLevel	requested;
+		if (OverrideLevel(requested))
+		{
+			// A level the CPU can't run is clamped instead of crashing
+			m_level = requested < m_supported ? requested : m_supported;
+			message += std::string(", VOXEL_SIMD=") + ToString(requested);
+		}
+		message += std::string(", using ") + ToString(m_level);
+		TracyMessage(message.c_str(), message.size());
+	}
+
+	const CpuDispatch& CpuDispatch::Get() noexcept
+	{
+		static const CpuDispatch	dispatch;
+		return dispatch;
+	}
+
+	void CpuDispatch::Init() noexcept
+	{
+		Get();
+	}
+}
@@ -1,4 +1,5 @@
 #include "EngineCore.h"
+#include "CpuDispatch.h"
 #include <iostream>
 
 namespace Core::Datastructure
@@ -9,6 +10,7 @@ namespace Core::Datastructure
 
 	bool EngineCore::Init() noexcept
 	{
+		Core::Platform::CpuDispatch::Init();
 		return m_window.Init() && m_input.Init();
 	}
 	void EngineCore::MainLoop() noexcept
@@ -0,0 +1,45 @@
+#include "HalfFloats.h"
+
+#include "CpuDispatch.h"
+
+namespace Core::Renderer
+{
+	// Compiled with AVX2 in HalfFloatsF16c.cpp, convert the largest multiple of 8 and return it
+	size_t	FloatsToHalvesF16c(const float* floats, uint16_t* result, size_t count) noexcept;
+	size_t	HalvesToFloatsF16c(const uint16_t* halves, float* result, size_t count) noexcept;
+
+	namespace
+	{
+		size_t FloatsToHalvesScalar(const float*, uint16_t*, size_t) noexcept
+		{
+			return 0;
+		}
+
+		size_t HalvesToFloatsScalar(const uint16_t*, float*, size_t) noexcept
+		{
+			return 0;
+		}
+
+		using Platform::ESimdLevel;
+
+		// F16C is on every CPU with AVX2, so it is dispatched with it
+		Platform::DispatchedKernel<size_t(const float*, uint16_t*, size_t)>
+			s_floatsToHalves{ "FloatsToHalves", { { ESimdLevel::SCALAR, &FloatsToHalvesScalar }, { ESimdLevel::AVX2, &FloatsToHalvesF16c } } };
+
+		Platform::DispatchedKernel<size_t(const uint16_t*, float*, size_t)>
+			s_halvesToFloats{ "HalvesToFloats", { { ESimdLevel::SCALAR, &HalvesToFloatsScalar }, { ESimdLevel::AVX2, &HalvesToFloatsF16c } } };
+	}
+
+	void FloatsToHalves(std::span<const float> floats, std::span<uint16_t> result) noexcept
+	{
+		// The remainder is converted here, so the inline scalar conversion is never compiled with AVX2
+		for (size_t i{ s_floatsToHalves(floats.data(), result.data(), floats.size()) }; i < floats.size(); ++i)
+			result[i] = Maths::Packing::FloatToHalf(floats[i]);
+	}
+
+	void HalvesToFloats(std::span<const uint16_t> halves, std::span<float> result) noexcept
+	{
+		for (size_t i{ s_halvesToFloats(halves.data(), result.data(), halves.size()) }; i < halves.size(); ++i)
+			result[i] = Maths::Packing::HalfToFloat(halves[i]);
+	}
+}
@@ -0,0 +1,38 @@
+/*
+ * Compiled with /arch:AVX2 (see the project file) and only called when
+ * CpuDispatch selected AVX2. Only intrinsics are used here, the remainder
+ * is left to HalfFloats.cpp so no inline function shared with the other
+ * files is compiled with AVX2
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include "Maths/MathMinimal.h"
+
+#if MATHS_F16C
+#include <immintrin.h>
+#endif
+
+namespace Core::Renderer
+{
+	size_t FloatsToHalvesF16c(const float* floats, uint16_t* result, size_t count) noexcept
+	{
+		size_t	i{ 0 };
+#if MATHS_F16C
+		for (; i + 8 <= count; i += 8)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(result + i),
+							 _mm256_cvtps_ph(_mm256_loadu_ps(floats + i), _MM_FROUND_TO_NEAREST_INT));
+#endif
+		return i;
+	}
+
+	size_t HalvesToFloatsF16c(const uint16_t* halves, float* result, size_t count) noexcept
+	{
+		size_t	i{ 0 };
+#if MATHS_F16C
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(result + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(halves + i))));
+#endif
+		return i;
+	}
+}
@@ -0,0 +1,63 @@
+#include "NoiseGrid.h"
+
+#include "CpuDispatch.h"
+
+namespace Core::Procedural
+{
+	// Compiled with AVX2 in NoiseGridAvx2.cpp
+	void	FillNoise3DAvx2(const Maths::Noise::Settings& settings, const Maths::Vec3& origin, float step,
+							const Maths::IVec3& size, float* result) noexcept;
+	void	FillNoise2DAvx2(const Maths::Noise::Settings& settings, const Maths::Vec2& origin, float step,
+							const Maths::IVec2& size, float* result) noexcept;
+
+	namespace
+	{
+		void FillNoise3DScalar(const Maths::Noise::Settings& settings, const Maths::Vec3& origin, float step,
+							   const Maths::IVec3& size, float* result) noexcept
+		{
+			Maths::Noise::FillGrid3_IMPL<float>(settings, origin, step, size, result);
+		}
+
+		void FillNoise2DScalar(const Maths::Noise::Settings& settings, const Maths::Vec2& origin, float step,
+							   const Maths::IVec2& size, float* result) noexcept
+		{
+			Maths::Noise::FillGrid2_IMPL<float>(settings, origin, step, size, result);
+		}
+
+		using Platform::ESimdLevel;
+
+		Platform::DispatchedKernel<void(const Maths::Noise::Settings&, const Maths::Vec3&, float, const Maths::IVec3&, float*)>
+			s_fill3D{ "FillNoise3D", { { ESimdLevel::SCALAR, &FillNoise3DScalar }, { ESimdLevel::AVX2, &FillNoise3DAvx2 } } };
+
+		Platform::DispatchedKernel<void(const Maths::Noise::Settings&, const Maths::Vec2&, float, const Maths::IVec2&, float*)>
+			s_fill2D{ "FillNoise2D", { { ESimdLevel::SCALAR, &FillNoise2DScalar }, { ESimdLevel::AVX2, &FillNoise2DAvx2 } } };
+	}
+
+	void FillNoise(const Maths::Noise::Settings& settings, const Maths::Vec3& origin, float step,
+				   const Maths::IVec3& size, std::span<float> result) noexcept
+	{
+		ZoneScoped
+		s_fill3D(settings, origin, step, size, result.data());
+	}
+
+	void FillNoise(const Maths::Noise::Settings& settings, const Maths::Vec2& origin, float step,
+				   const Maths::IVec2& size, std::span<float> result) noexcept
+	{
+		ZoneScoped
+		s_fill2D(settings, origin, step, size, result.data());
+	}
+
+	void FillNoise(const Maths::Noise::Settings& settings, const Maths::Vec3& origin, float step,
+				   const Maths::IVec3& size, std::span<float> result, Platform::ESimdLevel level) noexcept
+	{
+		ZoneScoped
+		s_fill3D.GetFunction(level)(settings, origin, step, size, result.data());
+	}
+
+	void FillNoise(const Maths::Noise::Settings& settings, const Maths::Vec2& origin, float step,
+				   const Maths::IVec2& size, std::span<float> result, Platform::ESimdLevel level) noexcept
+	{
+		ZoneScoped
+		s_fill2D.GetFunction(level)(settings, origin, step, size, result.data());
+	}
+}
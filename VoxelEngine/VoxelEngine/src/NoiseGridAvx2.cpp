@@ -0,0 +1,27 @@
+/*
+ * Compiled with /arch:AVX2 (see the project file) and only called when
+ * CpuDispatch selected AVX2. Only the Float8 kernels are instantiated here,
+ * so no inline function shared with the other files is compiled with AVX2
+ */
+#include "Maths/Noise.hpp"
+
+namespace Core::Procedural
+{
+#if MATHS_AVX2
+	using Lane = Maths::Noise::Float8;
+#else
+	using Lane = float;
+#endif
+
+	void FillNoise3DAvx2(const Maths::Noise::Settings& settings, const Maths::Vec3& origin, float step,
+						 const Maths::IVec3& size, float* result) noexcept
+	{
+		Maths::Noise::FillGrid3_IMPL<Lane>(settings, origin, step, size, result);
+	}
+
+	void FillNoise2DAvx2(const Maths::Noise::Settings& settings, const Maths::Vec2& origin, float step,
+						 const Maths::IVec2& size, float* result) noexcept
+	{
+		Maths::Noise::FillGrid2_IMPL<Lane>(settings, origin, step, size, result);
+	}
+}
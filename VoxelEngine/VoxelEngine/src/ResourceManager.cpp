@@ -28,5 +28,6 @@ namespace Core::Resources
 				++it;
 		}
 		std::cout << "Removed " << i << " total resources" << std::endl;
+		return i;
 	}
 }
@@ -0,0 +1,140 @@
+#include "SimdKernels.h"
+
+#include "CpuDispatch.h"
+
+namespace Maths::Simd
+{
+	// Compiled with AVX2 in SimdKernelsAvx2.cpp
+	size_t	CullAabbSoAAvx2(const float (&planes)[6][4], const float* const min[3], const float* const max[3],
+							size_t count, unsigned* visible) noexcept;
+	size_t	CullSphereSoAAvx2(const float (&planes)[6][4], const float* const center[3], const float* radius,
+							  size_t count, unsigned* visible) noexcept;
+	size_t	RayAabbSoAAvx2(const float (&origin)[3], const float (&invDirection)[3], float maxDistance,
+						   const float* const min[3], const float* const max[3], size_t count,
+						   unsigned* hits, float* distances) noexcept;
+	size_t	SphereAabbSoAAvx2(const float (&center)[3], float radius, const float* const min[3], const float* const max[3],
+							  size_t count, unsigned* hits) noexcept;
+	size_t	AabbAabbSoAAvx2(const float (&queryMin)[3], const float (&queryMax)[3], const float* const min[3],
+							const float* const max[3], size_t count, unsigned* hits) noexcept;
+
+	namespace
+	{
+		using Core::Platform::ESimdLevel;
+
+		using CullAabbFunction = size_t(const float (&)[6][4], const float* const*, const float* const*, size_t, unsigned*);
+		using CullSphereFunction = size_t(const float (&)[6][4], const float* const*, const float*, size_t, unsigned*);
+		using RayAabbFunction = size_t(const float (&)[3], const float (&)[3], float, const float* const*, const float* const*,
+									   size_t, unsigned*, float*);
+		using SphereAabbFunction = size_t(const float (&)[3], float, const float* const*, const float* const*, size_t, unsigned*);
+		using AabbAabbFunction = size_t(const float (&)[3], const float (&)[3], const float* const*, const float* const*,
+										size_t, unsigned*);
+
+		// SSE2 is part of x64, so the SCALAR path is only picked through VOXEL_SIMD
+		Core::Platform::DispatchedKernel<CullAabbFunction>	s_cullAabb{ "CullAabbSoA", {
+			{ ESimdLevel::SCALAR, &CullAabbSoA_IMPL<float> },
+#if MATHS_SSE
+			{ ESimdLevel::SSE2, &CullAabbSoA_IMPL<__m128> },
+#endif
+			{ ESimdLevel::AVX2, &CullAabbSoAAvx2 } } };
+
+		Core::Platform::DispatchedKernel<CullSphereFunction>	s_cullSphere{ "CullSphereSoA", {
+			{ ESimdLevel::SCALAR, &CullSphereSoA_IMPL<float> },
+#if MATHS_SSE
+			{ ESimdLevel::SSE2, &CullSphereSoA_IMPL<__m128> },
+#endif
+			{ ESimdLevel::AVX2, &CullSphereSoAAvx2 } } };
+
+		Core::Platform::DispatchedKernel<RayAabbFunction>	s_rayAabb{ "RayAabbSoA", {
+			{ ESimdLevel::SCALAR, &RayAabbSoA_IMPL<float> },
+#if MATHS_SSE
+			{ ESimdLevel::SSE2, &RayAabbSoA_IMPL<__m128> },
+#endif
+			{ ESimdLevel::AVX2, &RayAabbSoAAvx2 } } };
+
+		Core::Platform::DispatchedKernel<SphereAabbFunction>	s_sphereAabb{ "SphereAabbSoA", {
+			{ ESimdLevel::SCALAR, &SphereAabbSoA_IMPL<float> },
+#if MATHS_SSE
+			{ ESimdLevel::SSE2, &SphereAabbSoA_IMPL<__m128> },
+#endif
+			{ ESimdLevel::AVX2, &SphereAabbSoAAvx2 } } };
+
+		Core::Platform::DispatchedKernel<AabbAabbFunction>	s_aabbAabb{ "AabbAabbSoA", {
+			{ ESimdLevel::SCALAR, &AabbAabbSoA_IMPL<float> },
+#if MATHS_SSE
+			{ ESimdLevel::SSE2, &AabbAabbSoA_IMPL<__m128> },
+#endif
+			{ ESimdLevel::AVX2, &AabbAabbSoAAvx2 } } };
+	}
+
+	size_t CullAabbSoA(const float (&planes)[6][4], const float* const min[3], const float* const max[3],
+					   size_t count, unsigned* visible) noexcept
+	{
+		ZoneScoped
+		return s_cullAabb(planes, min, max, count, visible);
+	}
+
+	size_t CullSphereSoA(const float (&planes)[6][4], const float* const center[3], const float* radius,
+						 size_t count, unsigned* visible) noexcept
+	{
+		ZoneScoped
+		return s_cullSphere(planes, center, radius, count, visible);
+	}
+
+	size_t RayAabbSoA(const float (&origin)[3], const float (&invDirection)[3], float maxDistance,
+					  const float* const min[3], const float* const max[3], size_t count,
+					  unsigned* hits, float* distances) noexcept
+	{
+		ZoneScoped
+		return s_rayAabb(origin, invDirection, maxDistance, min, max, count, hits, distances);
+	}
+
+	size_t SphereAabbSoA(const float (&center)[3], float radius, const float* const min[3], const float* const max[3],
+						 size_t count, unsigned* hits) noexcept
+	{
+		ZoneScoped
+		return s_sphereAabb(center, radius, min, max, count, hits);
+	}
+
+	size_t AabbAabbSoA(const float (&queryMin)[3], const float (&queryMax)[3], const float* const min[3],
+					   const float* const max[3], size_t count, unsigned* hits) noexcept
+	{
+		ZoneScoped
+		return s_aabbAabb(queryMin, queryMax, min, max, count, hits);
+	}
+
+	size_t CullAabbSoA(const float (&planes)[6][4], const float* const min[3], const float* const max[3],
+					   size_t count, unsigned* visible, ESimdLevel level) noexcept
+	{
+		ZoneScoped
+		return s_cullAabb.GetFunction(level)(planes, min, max, count, visible);
+	}
+
+	size_t CullSphereSoA(const float (&planes)[6][4], const float* const center[3], const float* radius,
+						 size_t count, unsigned* visible, ESimdLevel level) noexcept
+	{
+		ZoneScoped
+		return s_cullSphere.GetFunction(level)(planes, center, radius, count, visible);
+	}
+
+	size_t RayAabbSoA(const float (&origin)[3], const float (&invDirection)[3], float maxDistance,
+					  const float* const min[3], const float* const max[3], size_t count,
+					  unsigned* hits, float* distances, ESimdLevel level) noexcept
+	{
+		ZoneScoped
+		return s_rayAabb.GetFunction(level)(origin, invDirection, maxDistance, min, max, count, hits, distances);
+	}
+
+	size_t SphereAabbSoA(const float (&center)[3], float radius, const float* const min[3], const float* const max[3],
+						 size_t count, unsigned* hits, ESimdLevel level) noexcept
+	{
+		ZoneScoped
+		return s_sphereAabb.GetFunction(level)(center, radius, min, max, count, hits);
+	}
+
+	size_t AabbAabbSoA(const float (&queryMin)[3], const float (&queryMax)[3], const float* const min[3],
+					   const float* const max[3], size_t count, unsigned* hits, ESimdLevel level) noexcept
+	{
+		ZoneScoped
+		return s_aabbAabb.GetFunction(level)(queryMin, queryMax, min, max, count, hits);
+	}
+}
@@ -0,0 +1,46 @@
+/*
+ * Compiled with /arch:AVX2 (see the project file) and only called when
+ * CpuDispatch selected AVX2. Only the __m256 kernels are instantiated here,
+ * so no inline function shared with the other files is compiled with AVX2
+ */
+#include "Maths/Simd.hpp"
+
+namespace Maths::Simd
+{
+#if MATHS_AVX2
+	using Block = __m256;
+#else
+	using Block = float;
+#endif
+
+	size_t CullAabbSoAAvx2(const float (&planes)[6][4], const float* const min[3], const float* const max[3],
+						   size_t count, unsigned* visible) noexcept
+	{
+		return CullAabbSoA_IMPL<Block>(planes, min, max, count, visible);
+	}
+
+	size_t CullSphereSoAAvx2(const float (&planes)[6][4], const float* const center[3], const float* radius,
+							 size_t count, unsigned* visible) noexcept
+	{
+		return CullSphereSoA_IMPL<Block>(planes, center, radius, count, visible);
+	}
+
+	size_t RayAabbSoAAvx2(const float (&origin)[3], const float (&invDirection)[3], float maxDistance,
+						  const float* const min[3], const float* const max[3], size_t count,
+						  unsigned* hits, float* distances) noexcept
+	{
+		return RayAabbSoA_IMPL<Block>(origin, invDirection, maxDistance, min, max, count, hits, distances);
+	}
+
+	size_t SphereAabbSoAAvx2(const float (&center)[3], float radius, const float* const min[3], const float* const max[3],
+							 size_t count, unsigned* hits) noexcept
+	{
+		return SphereAabbSoA_IMPL<Block>(center, radius, min, max, count, hits);
+	}
+
+	size_t AabbAabbSoAAvx2(const float (&queryMin)[3], const float (&queryMax)[3], const float* const min[3],
+						   const float* const max[3], size_t count, unsigned* hits) noexcept
+	{
+		return AabbAabbSoA_IMPL<Block>(queryMin, queryMax, min, max, count, hits);
+	}
+}
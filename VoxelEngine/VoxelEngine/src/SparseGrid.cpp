@@ -0,0 +1,349 @@
+#include "SparseGrid.h"
+
+#include <algorithm>
+
+namespace Core::Datastructure
+{
+	namespace
+	{
+		template <class T>
+		uint32_t Allocate(std::vector<std::unique_ptr<T>>& pool, std::vector<uint32_t>& freeList) noexcept
+		{
+			if (!freeList.empty())
+			{
+				const uint32_t	index{ freeList.back() };
+				freeList.pop_back();
+				return index;
+			}
+			pool.push_back(std::make_unique<T>());
+			return static_cast<uint32_t>(pool.size() - 1);
+		}
+
+		/**
+		 * Slots of a node overlapping a box, on one axis
+		 */
+		void SlotRange(int min, int max, int nodeMin, unsigned childShift, unsigned log2, int& first, int& last) noexcept
+		{
+			const int	nodeMax{ nodeMin + (1 << (childShift + log2)) - 1 };
+			first = (std::max(min, nodeMin) - nodeMin) >> childShift;
+			last = (std::min(max, nodeMax) - nodeMin) >> childShift;
+		}
+
+		bool Inside(const Maths::IVec3& min, const Maths::IVec3& max, const Maths::IVec3& cube, int size) noexcept
+		{
+			return cube.x >= min.x && cube.y >= min.y && cube.z >= min.z
+				&& cube.x + size - 1 <= max.x && cube.y + size - 1 <= max.y && cube.z + size - 1 <= max.z;
+		}
+	}
+
+	SparseGrid::UpperNode& SparseGrid::TouchUpper(const Maths::IVec3& voxel) noexcept
+	{
+		const Maths::IVec3	key{ voxel & ~((1 << UPPER_SHIFT) - 1) };
+		const auto			found{ m_root.find(key) };
+		if (found != m_root.end())
+			return *m_uppers[found->second];
+
+		const uint32_t	index{ Allocate(m_uppers, m_freeUppers) };
+		UpperNode&		upper{ *m_uppers[index] };
+		std::fill(std::begin(upper.childMask), std::end(upper.childMask), 0);
+		std::fill(std::begin(upper.valueMask), std::end(upper.valueMask), 0);
+		std::fill(std::begin(upper.slots), std::end(upper.slots), BACKGROUND);
+		upper.origin = key;
+		m_root.emplace(key, index);
+		return upper;
+	}
+
+	SparseGrid::LowerNode& SparseGrid::TouchLower(UpperNode& upper, const Maths::IVec3& voxel) noexcept
+	{
+		const unsigned	slot{ UpperOffset(voxel) };
+		if (TestBit(upper.childMask, slot))
+			return *m_lowers[upper.slots[slot]];
+
+		// The child starts as the tile it replaces
+		const bool		active{ TestBit(upper.valueMask, slot) };
+		const uint32_t	index{ Allocate(m_lowers, m_freeLowers) };
+		LowerNode&		lower{ *m_lowers[index] };
+		std::fill(std::begin(lower.childMask), std::end(lower.childMask), 0);
+		std::fill(std::begin(lower.valueMask), std::end(lower.valueMask), active ? ~uint64_t{ 0 } : 0);
+		std::fill(std::begin(lower.slots), std::end(lower.slots), upper.slots[slot]);
+		lower.origin = voxel & ~((1 << LOWER_SHIFT) - 1);
+
+		SetBit(upper.childMask, slot);
+		ClearBit(upper.valueMask, slot);
+		upper.slots[slot] = index;
+		return lower;
+	}
+
+	SparseGrid::LeafNode& SparseGrid::TouchLeaf(LowerNode& lower, const Maths::IVec3& voxel) noexcept
+	{
+		const unsigned	slot{ LowerOffset(voxel) };
+		if (TestBit(lower.childMask, slot))
+			return *m_leaves[lower.slots[slot]];
+
+		const bool		active{ TestBit(lower.valueMask, slot) };
+		const uint32_t	index{ Allocate(m_leaves, m_freeLeaves) };
+		LeafNode&		leaf{ *m_leaves[index] };
+		std::fill(std::begin(leaf.activeMask), std::end(leaf.activeMask), active ? ~uint64_t{ 0 } : 0);
+		std::fill(std::begin(leaf.values), std::end(leaf.values), static_cast<BlockId>(lower.slots[slot]));
+		leaf.origin = voxel & ~((1 << LEAF_SHIFT) - 1);
+
+		SetBit(lower.childMask, slot);
+		ClearBit(lower.valueMask, slot);
+		lower.slots[slot] = index;
+		return leaf;
+	}
+
+	void SparseGrid::FreeLeaf(uint32_t leaf) noexcept
+	{
+		m_freeLeaves.push_back(leaf);
+		++m_generation;
+	}
+
+	void SparseGrid::FreeLower(uint32_t lower) noexcept
+	{
+		const LowerNode&	node{ *m_lowers[lower] };
+		for (unsigned word{ 0 }; word < LowerNode::SIZE / 64; ++word)
+		{
+			for (uint64_t bits{ node.childMask[word] }; bits != 0; bits &= bits - 1)
+				FreeLeaf(node.slots[word * 64 + std::countr_zero(bits)]);
+		}
+		m_freeLowers.push_back(lower);
+		++m_generation;
+	}
+
+	void SparseGrid::SetTile(UpperNode& upper, unsigned slot, BlockId value, bool active) noexcept
+	{
+		if (TestBit(upper.childMask, slot))
+		{
+			FreeLower(upper.slots[slot]);
+			ClearBit(upper.childMask, slot);
+		}
+		upper.slots[slot] = active ? value : BACKGROUND;
+		if (active)
+			SetBit(upper.valueMask, slot);
+		else
+			ClearBit(upper.valueMask, slot);
+	}
+
+	void SparseGrid::SetTile(LowerNode& lower, unsigned slot, BlockId value, bool active) noexcept
+	{
+		if (TestBit(lower.childMask, slot))
+		{
+			FreeLeaf(lower.slots[slot]);
+			ClearBit(lower.childMask, slot);
+		}
+		lower.slots[slot] = active ? value : BACKGROUND;
+		if (active)
+			SetBit(lower.valueMask, slot);
+		else
+			ClearBit(lower.valueMask, slot);
+	}
+
+	void SparseGrid::Fill(const Maths::IVec3& min, const Maths::IVec3& max, BlockId value) noexcept
+	{
+		if (max.x < min.x || max.y < min.y || max.z < min.z)
+			return;
+
+		ZoneScoped
+		constexpr int	upperMask{ ~((1 << UPPER_SHIFT) - 1) };
+		for (int uz{ min.z & upperMask }; uz <= max.z; uz += 1 << UPPER_SHIFT)
+		for (int uy{ min.y & upperMask }; uy <= max.y; uy += 1 << UPPER_SHIFT)
+		for (int ux{ min.x & upperMask }; ux <= max.x; ux += 1 << UPPER_SHIFT)
+		{
+			UpperNode&	upper{ TouchUpper(Maths::IVec3(ux, uy, uz)) };
+			int			first[3], last[3];
+			SlotRange(min.x, max.x, ux, LOWER_SHIFT, 5, first[0], last[0]);
+			SlotRange(min.y, max.y, uy, LOWER_SHIFT, 5, first[1], last[1]);
+			SlotRange(min.z, max.z, uz, LOWER_SHIFT, 5, first[2], last[2]);
+
+			for (int z{ first[2] }; z <= last[2]; ++z)
+			for (int y{ first[1] }; y <= last[1]; ++y)
+			for (int x{ first[0] }; x <= last[0]; ++x)
+			{
+				const unsigned		upperSlot{ static_cast<unsigned>(x | y << 5 | z << 10) };
+				const Maths::IVec3	lowerMin{ upper.origin + Maths::IVec3(x, y, z) * (1 << LOWER_SHIFT) };
+				if (Inside(min, max, lowerMin, 1 << LOWER_SHIFT))
+				{
+					SetTile(upper, upperSlot, value, true);
+					continue;
+				}
+
+				LowerNode&	lower{ TouchLower(upper, lowerMin) };
+				int			lowerFirst[3], lowerLast[3];
+				SlotRange(min.x, max.x, lowerMin.x, LEAF_SHIFT, 4, lowerFirst[0], lowerLast[0]);
+				SlotRange(min.y, max.y, lowerMin.y, LEAF_SHIFT, 4, lowerFirst[1], lowerLast[1]);
+				SlotRange(min.z, max.z, lowerMin.z, LEAF_SHIFT, 4, lowerFirst[2], lowerLast[2]);
+
+				for (int lz{ lowerFirst[2] }; lz <= lowerLast[2]; ++lz)
+				for (int ly{ lowerFirst[1] }; ly <= lowerLast[1]; ++ly)
+				for (int lx{ lowerFirst[0] }; lx <= lowerLast[0]; ++lx)
+				{
+					const unsigned		lowerSlot{ static_cast<unsigned>(lx | ly << 4 | lz << 8) };
+					const Maths::IVec3	leafMin{ lowerMin + Maths::IVec3(lx, ly, lz) * (1 << LEAF_SHIFT) };
+					if (Inside(min, max, leafMin, 1 << LEAF_SHIFT))
+					{
+						SetTile(lower, lowerSlot, value, true);
+						continue;
+					}
+
+					LeafNode&			leaf{ TouchLeaf(lower, leafMin) };
+					const Maths::IVec3	from{ std::max(min.x, leafMin.x), std::max(min.y, leafMin.y), std::max(min.z, leafMin.z) };
+					const Maths::IVec3	to{ std::min(max.x, leafMin.x + 7), std::min(max.y, leafMin.y + 7), std::min(max.z, leafMin.z + 7) };
+					for (int vz{ from.z }; vz <= to.z; ++vz)
+					for (int vy{ from.y }; vy <= to.y; ++vy)
+					for (int vx{ from.x }; vx <= to.x; ++vx)
+					{
+						const unsigned	offset{ LeafOffset(Maths::IVec3(vx, vy, vz)) };
+						leaf.values[offset] = value;
+						SetBit(leaf.activeMask, offset);
+					}
+				}
+			}
+		}
+	}
+
+	void SparseGrid::InsertChunk(const Maths::ChunkPos& pos, std::span<const BlockId> voxels) noexcept
+	{
+		ZoneScoped
+		constexpr int	leavesPerSide{ Maths::ChunkPos::Size >> LEAF_SHIFT };
+		const Maths::IVec3	origin{ pos.Origin() };
+
+		for (int lz{ 0 }; lz < leavesPerSide; ++lz)
+		for (int ly{ 0 }; ly < leavesPerSide; ++ly)
+		for (int lx{ 0 }; lx < leavesPerSide; ++lx)
+		{
+			const Maths::IVec3	leafMin{ origin + Maths::IVec3(lx, ly, lz) * (1 << LEAF_SHIFT) };
+			BlockId				values[LeafNode::SIZE];
+			uint64_t			activeMask[LeafNode::SIZE / 64]{};
+			for (unsigned offset{ 0 }; offset < LeafNode::SIZE; ++offset)
+			{
+				const Maths::IVec3	local{ leafMin - origin + SlotOffset<3>(offset, 0) };
+				values[offset] = voxels[Maths::ChunkPos::LocalIndex(local)];
+				if (values[offset] != BACKGROUND)
+					SetBit(activeMask, offset);
+			}
+
+			const bool	empty{ std::all_of(std::begin(activeMask), std::end(activeMask), [](uint64_t w) { return w == 0; }) };
+			if (empty)
+			{
+				// An empty leaf is stored as an inactive tile, and only if something was there
+				const auto	found{ m_root.find(leafMin & ~((1 << UPPER_SHIFT) - 1)) };
+				if (found == m_root.end())
+					continue;
+				UpperNode&		upper{ *m_uppers[found->second] };
+				const unsigned	upperSlot{ UpperOffset(leafMin) };
+				if (!TestBit(upper.childMask, upperSlot) && !TestBit(upper.valueMask, upperSlot))
+					continue;
+				SetTile(TouchLower(upper, leafMin), LowerOffset(leafMin), BACKGROUND, false);
+				continue;
+			}
+
+			LeafNode&	leaf{ TouchLeaf(TouchLower(TouchUpper(leafMin), leafMin), leafMin) };
+			std::copy(std::begin(values), std::end(values), leaf.values);
+			std::copy(std::begin(activeMask), std::end(activeMask), leaf.activeMask);
+		}
+	}
+
+	void SparseGrid::InsertChunk(const Maths::ChunkPos& pos, const Chunk& chunk) noexcept
+	{
+		std::vector<BlockId>	voxels(Chunk::VOLUME);
+		chunk.Read(voxels);
+		InsertChunk(pos, voxels);
+	}
+
+	void SparseGrid::Prune() noexcept
+	{
+		ZoneScoped
+		for (auto it{ m_root.begin() }; it != m_root.end();)
+		{
+			UpperNode&	upper{ *m_uppers[it->second] };
+			for (unsigned upperSlot{ 0 }; upperSlot < UpperNode::SIZE; ++upperSlot)
+			{
+				if (!TestBit(upper.childMask, upperSlot))
+					continue;
+
+				LowerNode&	lower{ *m_lowers[upper.slots[upperSlot]] };
+				for (unsigned lowerSlot{ 0 }; lowerSlot < LowerNode::SIZE; ++lowerSlot)
+				{
+					if (!TestBit(lower.childMask, lowerSlot))
+						continue;
+
+					const LeafNode&	leaf{ *m_leaves[lower.slots[lowerSlot]] };
+					const bool		allOff{ std::all_of(std::begin(leaf.activeMask), std::end(leaf.activeMask), [](uint64_t w) { return w == 0; }) };
+					const bool		allOn{ std::all_of(std::begin(leaf.activeMask), std::end(leaf.activeMask), [](uint64_t w) { return w == ~uint64_t{ 0 }; }) };
+					if (allOff)
+						SetTile(lower, lowerSlot, BACKGROUND, false);
+					else if (allOn && std::all_of(std::begin(leaf.values), std::end(leaf.values), [&](BlockId v) { return v == leaf.values[0]; }))
+						SetTile(lower, lowerSlot, leaf.values[0], true);
+				}
+
+				// A lower node of tiles only, all with the same state, becomes a tile
+				const bool	noChild{ std::all_of(std::begin(lower.childMask), std::end(lower.childMask), [](uint64_t w) { return w == 0; }) };
+				const bool	allOff{ std::all_of(std::begin(lower.valueMask), std::end(lower.valueMask), [](uint64_t w) { return w == 0; }) };
+				const bool	allOn{ std::all_of(std::begin(lower.valueMask), std::end(lower.valueMask), [](uint64_t w) { return w == ~uint64_t{ 0 }; }) };
+				if (noChild && allOff)
+					SetTile(upper, upperSlot, BACKGROUND, false);
+				else if (noChild && allOn && std::all_of(std::begin(lower.slots), std::end(lower.slots), [&](uint32_t v) { return v == lower.slots[0]; }))
+					SetTile(upper, upperSlot, static_cast<BlockId>(lower.slots[0]), true);
+			}
+
+			const bool	empty{ std::all_of(std::begin(upper.childMask), std::end(upper.childMask), [](uint64_t w) { return w == 0; })
+							   && std::all_of(std::begin(upper.valueMask), std::end(upper.valueMask), [](uint64_t w) { return w == 0; }) };
+			if (empty)
+			{
+				m_freeUppers.push_back(it->second);
+				++m_generation;
+				it = m_root.erase(it);
+			}
+			else
+				++it;
+		}
+	}
+
+	void SparseGrid::Clear() noexcept
+	{
+		m_root.clear();
+		m_uppers.clear();
+		m_lowers.clear();
+		m_leaves.clear();
+		m_freeUppers.clear();
+		m_freeLowers.clear();
+		m_freeLeaves.clear();
+		++m_generation;
+	}
+
+	uint64_t SparseGrid::CountActive() const noexcept
+	{
+		uint64_t	count{ 0 };
+		for (const auto& [key, upperIndex] : m_root)
+		{
+			const UpperNode&	upper{ *m_uppers[upperIndex] };
+			for (unsigned word{ 0 }; word < UpperNode::SIZE / 64; ++word)
+			{
+				count += static_cast<uint64_t>(std::popcount(upper.valueMask[word])) << (LOWER_SHIFT * 3);
+				for (uint64_t bits{ upper.childMask[word] }; bits != 0; bits &= bits - 1)
+				{
+					const LowerNode&	lower{ *m_lowers[upper.slots[word * 64 + std::countr_zero(bits)]] };
+					for (unsigned lowerWord{ 0 }; lowerWord < LowerNode::SIZE / 64; ++lowerWord)
+					{
+						count += static_cast<uint64_t>(std::popcount(lower.valueMask[lowerWord])) << (LEAF_SHIFT * 3);
+						for (uint64_t leafBits{ lower.childMask[lowerWord] }; leafBits != 0; leafBits &= leafBits - 1)
+						{
+							const LeafNode&	leaf{ *m_leaves[lower.slots[lowerWord * 64 + std::countr_zero(leafBits)]] };
+							for (const uint64_t mask : leaf.activeMask)
+								count += std::popcount(mask);
+						}
+					}
+				}
+			}
+		}
+		return count;
+	}
+
+	size_t SparseGrid::GetMemoryUsage() const noexcept
+	{
+		return sizeof(*this) + m_uppers.size() * sizeof(UpperNode) + m_lowers.size() * sizeof(LowerNode)
+			 + m_leaves.size() * sizeof(LeafNode) + m_root.size() * (sizeof(Maths::IVec3) + sizeof(uint32_t) + 2 * sizeof(void*))
+			 + m_root.bucket_count() * sizeof(void*);
+	}
+}
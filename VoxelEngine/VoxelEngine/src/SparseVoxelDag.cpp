@@ -0,0 +1,291 @@
+#include "SparseVoxelDag.h"
+#include "VoxelTraversal.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace Core::Datastructure
+{
+	using VoxelTraversal::ChildIndex;
+	using VoxelTraversal::ChildOffset;
+
+	namespace
+	{
+		constexpr uint32_t	NO_NODE{ ~0u };
+
+		size_t HashNode(const SparseVoxelDag::Node& node) noexcept
+		{
+			uint64_t	h{ 0 };
+			for (const uint32_t child : node.children)
+				h = (h ^ child) * 0x9E3779B97F4A7C15ull;
+			return static_cast<size_t>(h ^ h >> 29);
+		}
+	}
+
+	SparseVoxelDag::SparseVoxelDag(unsigned depth, const Maths::IVec3& origin) noexcept :
+		m_origin{ origin }, m_depth{ std::min(depth, MAX_DEPTH) }
+	{
+	}
+
+	void SparseVoxelDag::Rehash(size_t size) noexcept
+	{
+		m_table.assign(size, NO_NODE);
+		m_tableCount = 0;
+
+		std::vector<uint8_t>	isFree(m_nodes.size(), 0);
+		for (const uint32_t node : m_freeNodes)
+			isFree[node] = 1;
+
+		const size_t	mask{ size - 1 };
+		for (uint32_t node{ 0 }; node < m_nodes.size(); ++node)
+		{
+			if (isFree[node])
+				continue;
+			size_t	slot{ HashNode(m_nodes[node]) & mask };
+			while (m_table[slot] != NO_NODE)
+				slot = (slot + 1) & mask;
+			m_table[slot] = node;
+			++m_tableCount;
+		}
+	}
+
+	uint32_t SparseVoxelDag::Intern(const Node& node) noexcept
+	{
+		if (IsValue(node.children[0])
+			&& std::all_of(std::begin(node.children), std::end(node.children), [&](uint32_t c) { return c == node.children[0]; }))
+			return node.children[0];
+
+		// Kept under half full so the probes stay short
+		if ((m_tableCount + 1) * 2 > m_table.size())
+			Rehash(std::max<size_t>(1024, m_table.size() * 2));
+
+		const size_t	mask{ m_table.size() - 1 };
+		size_t			slot{ HashNode(node) & mask };
+		for (; m_table[slot] != NO_NODE; slot = (slot + 1) & mask)
+		{
+			if (m_nodes[m_table[slot]] == node)
+				return m_table[slot];
+		}
+
+		uint32_t	index;
+		if (!m_freeNodes.empty())
+		{
+			index = m_freeNodes.back();
+			m_freeNodes.pop_back();
+			m_nodes[index] = node;
+		}
+		else
+		{
+			index = static_cast<uint32_t>(m_nodes.size());
+			m_nodes.push_back(node);
+		}
+		m_table[slot] = index;
+		++m_tableCount;
+		return index;
+	}
+
+	uint32_t SparseVoxelDag::BuildDense(const BlockId* voxels, unsigned stride, const Maths::IVec3& min, unsigned size) noexcept
+	{
+		if (size == 1)
+			return VALUE_BIT | voxels[min.x + (min.y + min.z * stride) * stride];
+
+		const unsigned	half{ size / 2 };
+		Node			node;
+		for (unsigned child{ 0 }; child < 8; ++child)
+			node.children[child] = BuildDense(voxels, stride, min + ChildOffset(child, static_cast<int>(half)), half);
+		return Intern(node);
+	}
+
+	uint32_t SparseVoxelDag::BuildOctree(const std::vector<SparseVoxelOctree::Node>& nodes, uint32_t node) noexcept
+	{
+		const uint32_t	group{ nodes[node].children };
+		if (group == SparseVoxelOctree::NO_CHILDREN)
+			return VALUE_BIT | nodes[node].block;
+
+		Node	built;
+		for (unsigned child{ 0 }; child < 8; ++child)
+			built.children[child] = BuildOctree(nodes, group + child);
+		return Intern(built);
+	}
+
+	void SparseVoxelDag::ReplaceCube(const Maths::IVec3& local, unsigned level, uint32_t child) noexcept
+	{
+		uint32_t	path[MAX_DEPTH + 1];
+		unsigned	count{ 0 };
+		uint32_t	current{ m_root };
+		for (unsigned l{ m_depth }; l > level; --l)
+		{
+			path[count++] = current;
+			if (!IsValue(current))
+				current = m_nodes[current].children[ChildIndex(local, l)];
+		}
+
+		// The nodes above are shared, each one on the path is copied with the new child
+		for (unsigned l{ level + 1 }; count-- > 0; ++l)
+		{
+			Node	node;
+			if (IsValue(path[count]))
+				std::fill(std::begin(node.children), std::end(node.children), path[count]);
+			else
+				node = m_nodes[path[count]];
+			node.children[ChildIndex(local, l)] = child;
+			child = Intern(node);
+		}
+		m_root = child;
+	}
+
+	bool SparseVoxelDag::Contains(const Maths::IVec3& voxel) const noexcept
+	{
+		const Maths::IVec3	local{ voxel - m_origin };
+		const unsigned		size{ 1u << m_depth };
+		return static_cast<unsigned>(local.x) < size && static_cast<unsigned>(local.y) < size
+			&& static_cast<unsigned>(local.z) < size;
+	}
+
+	BlockId SparseVoxelDag::Get(const Maths::IVec3& voxel) const noexcept
+	{
+		if (!Contains(voxel))
+			return EMPTY;
+
+		const Maths::IVec3	local{ voxel - m_origin };
+		uint32_t			current{ m_root };
+		for (unsigned level{ m_depth }; !IsValue(current); --level)
+			current = m_nodes[current].children[ChildIndex(local, level)];
+		return ValueOf(current);
+	}
+
+	void SparseVoxelDag::Set(const Maths::IVec3& voxel, BlockId block) noexcept
+	{
+		if (!Contains(voxel) || Get(voxel) == block)
+			return;
+
+		ReplaceCube(voxel - m_origin, 0, VALUE_BIT | block);
+	}
+
+	void SparseVoxelDag::InsertChunk(const Maths::ChunkPos& pos, const Chunk& chunk) noexcept
+	{
+		if (chunk.IsUniform())
+		{
+			const Maths::IVec3	local{ pos.Origin() - m_origin };
+			if (VoxelTraversal::IsChunkCube(local, m_depth))
+				ReplaceCube(local, Maths::ChunkPos::Shift, VALUE_BIT | chunk.Get(0u));
+			return;
+		}
+
+		std::vector<BlockId>	voxels(Chunk::VOLUME);
+		chunk.Read(voxels);
+		InsertChunk(pos, voxels);
+	}
+
+	void SparseVoxelDag::InsertChunk(const Maths::ChunkPos& pos, std::span<const BlockId> voxels) noexcept
+	{
+		const Maths::IVec3	local{ pos.Origin() - m_origin };
+		if (!VoxelTraversal::IsChunkCube(local, m_depth))
+			return;
+
+		ZoneScoped
+		const uint32_t	built{ BuildDense(voxels.data(), Maths::ChunkPos::Size, Maths::IVec3(), Maths::ChunkPos::Size) };
+		ReplaceCube(local, Maths::ChunkPos::Shift, built);
+	}
+
+	void SparseVoxelDag::Build(const SparseVoxelOctree& octree) noexcept
+	{
+		ZoneScoped
+		Clear();
+		m_depth = octree.GetDepth();
+		m_origin = octree.GetOrigin();
+		m_root = BuildOctree(octree.GetNodes(), 0);
+	}
+
+	bool SparseVoxelDag::Raycast(const Maths::Ray& ray, RayHit& hit, float maxDistance) const noexcept
+	{
+		return VoxelTraversal::Raycast<MAX_DEPTH>(ray, m_origin, m_depth, m_root, maxDistance, hit,
+			[](uint32_t child, BlockId& block)
+			{
+				block = ValueOf(child);
+				return IsValue(child);
+			},
+			[this](uint32_t node, unsigned child) { return m_nodes[node].children[child]; });
+	}
+
+	size_t SparseVoxelDag::CollectGarbage() noexcept
+	{
+		ZoneScoped
+		std::vector<uint8_t>	reachable(m_nodes.size(), 0);
+		std::vector<uint32_t>	stack;
+		if (!IsValue(m_root))
+		{
+			reachable[m_root] = 1;
+			stack.push_back(m_root);
+		}
+		while (!stack.empty())
+		{
+			const uint32_t	node{ stack.back() };
+			stack.pop_back();
+			for (const uint32_t child : m_nodes[node].children)
+			{
+				if (!IsValue(child) && !reachable[child])
+				{
+					reachable[child] = 1;
+					stack.push_back(child);
+				}
+			}
+		}
+
+		// Nodes already free are marked too, so they aren't freed twice
+		for (const uint32_t node : m_freeNodes)
+			reachable[node] = 1;
+
+		size_t	freed{ 0 };
+		for (uint32_t node{ 0 }; node < m_nodes.size(); ++node)
+		{
+			if (!reachable[node])
+			{
+				m_freeNodes.push_back(node);
+				++freed;
+			}
+		}
+
+		if (freed > 0)
+			Rehash(std::max<size_t>(1024, std::bit_ceil((m_nodes.size() - m_freeNodes.size()) * 2 + 1)));
+		return freed;
+	}
+
+	void SparseVoxelDag::Clear() noexcept
+	{
+		m_nodes.clear();
+		m_nodes.shrink_to_fit();
+		m_freeNodes.clear();
+		m_freeNodes.shrink_to_fit();
+		m_table.clear();
+		m_table.shrink_to_fit();
+		m_tableCount = 0;
+		m_root = VALUE_BIT | EMPTY;
+	}
+
+	uint64_t SparseVoxelDag::CountOctreeNodes() const noexcept
+	{
+		// Nodes are counted once each, a shared node weighs as many times as it is referenced
+		std::vector<uint64_t>	counts(m_nodes.size(), 0);
+		const auto				count = [&](auto&& self, uint32_t child) -> uint64_t
+		{
+			if (IsValue(child))
+				return 1;
+			if (counts[child] == 0)
+			{
+				uint64_t	total{ 1 };
+				for (const uint32_t c : m_nodes[child].children)
+					total += self(self, c);
+				counts[child] = total;
+			}
+			return counts[child];
+		};
+		return count(count, m_root);
+	}
+
+	size_t SparseVoxelDag::GetMemoryUsage() const noexcept
+	{
+		return sizeof(*this) + m_nodes.capacity() * sizeof(Node) + m_freeNodes.capacity() * sizeof(uint32_t)
+			 + m_table.capacity() * sizeof(uint32_t);
+	}
+}
@@ -0,0 +1,265 @@
+#include "SparseVoxelOctree.h"
+#include "VoxelTraversal.h"
+
+#include <algorithm>
+
+namespace Core::Datastructure
+{
+	using VoxelTraversal::ChildIndex;
+	using VoxelTraversal::ChildOffset;
+
+	SparseVoxelOctree::SparseVoxelOctree(unsigned depth, const Maths::IVec3& origin) noexcept :
+		m_origin{ origin }, m_depth{ std::min(depth, MAX_DEPTH) }
+	{
+		Clear();
+	}
+
+	uint32_t SparseVoxelOctree::AllocateGroup(BlockId block) noexcept
+	{
+		uint32_t	group;
+		if (!m_freeGroups.empty())
+		{
+			group = m_freeGroups.back();
+			m_freeGroups.pop_back();
+		}
+		else
+		{
+			group = static_cast<uint32_t>(m_nodes.size());
+			m_nodes.resize(m_nodes.size() + 8);
+		}
+
+		for (unsigned child{ 0 }; child < 8; ++child)
+			m_nodes[group + child] = Node{ NO_CHILDREN, block };
+		return group;
+	}
+
+	void SparseVoxelOctree::FreeSubtree(uint32_t node) noexcept
+	{
+		const uint32_t	group{ m_nodes[node].children };
+		if (group == NO_CHILDREN)
+			return;
+
+		for (unsigned child{ 0 }; child < 8; ++child)
+			FreeSubtree(group + child);
+		m_freeGroups.push_back(group);
+		m_nodes[node].children = NO_CHILDREN;
+	}
+
+	bool SparseVoxelOctree::TryCollapse(uint32_t node) noexcept
+	{
+		const uint32_t	group{ m_nodes[node].children };
+		if (group == NO_CHILDREN)
+			return true;
+
+		const BlockId	block{ m_nodes[group].block };
+		for (unsigned child{ 0 }; child < 8; ++child)
+		{
+			const Node&	n{ m_nodes[group + child] };
+			if (n.children != NO_CHILDREN || n.block != block)
+				return false;
+		}
+
+		m_freeGroups.push_back(group);
+		m_nodes[node] = Node{ NO_CHILDREN, block };
+		return true;
+	}
+
+	SparseVoxelOctree::Node SparseVoxelOctree::BuildDense(const BlockId* voxels, unsigned stride,
+														  const Maths::IVec3& min, unsigned size) noexcept
+	{
+		if (size == 1)
+			return Node{ NO_CHILDREN, voxels[min.x + (min.y + min.z * stride) * stride] };
+
+		const unsigned	half{ size / 2 };
+		Node			children[8];
+		bool			uniform{ true };
+		for (unsigned child{ 0 }; child < 8; ++child)
+		{
+			children[child] = BuildDense(voxels, stride, min + ChildOffset(child, static_cast<int>(half)), half);
+			uniform = uniform && children[child].children == NO_CHILDREN && children[child].block == children[0].block;
+		}
+		if (uniform)
+			return children[0];
+
+		// Only the groups that survive the collapse are allocated
+		const uint32_t	group{ AllocateGroup(EMPTY) };
+		std::copy(std::begin(children), std::end(children), m_nodes.begin() + group);
+		return Node{ group, EMPTY };
+	}
+
+	unsigned SparseVoxelOctree::Descend(const Maths::IVec3& local, unsigned level, uint32_t (&path)[MAX_DEPTH + 1]) noexcept
+	{
+		uint32_t	node{ 0 };
+		unsigned	count{ 0 };
+		for (unsigned l{ m_depth }; l > level; --l)
+		{
+			path[count++] = node;
+			if (m_nodes[node].children == NO_CHILDREN)
+			{
+				// The pool may grow, so the node is indexed again afterwards
+				const uint32_t	group{ AllocateGroup(m_nodes[node].block) };
+				m_nodes[node].children = group;
+			}
+			node = m_nodes[node].children + ChildIndex(local, l);
+		}
+		path[count++] = node;
+		return count;
+	}
+
+	bool SparseVoxelOctree::Contains(const Maths::IVec3& voxel) const noexcept
+	{
+		const Maths::IVec3	local{ voxel - m_origin };
+		const unsigned		size{ 1u << m_depth };
+		return static_cast<unsigned>(local.x) < size && static_cast<unsigned>(local.y) < size
+			&& static_cast<unsigned>(local.z) < size;
+	}
+
+	BlockId SparseVoxelOctree::Get(const Maths::IVec3& voxel) const noexcept
+	{
+		if (!Contains(voxel))
+			return EMPTY;
+
+		const Maths::IVec3	local{ voxel - m_origin };
+		uint32_t			node{ 0 };
+		for (unsigned level{ m_depth }; m_nodes[node].children != NO_CHILDREN; --level)
+			node = m_nodes[node].children + ChildIndex(local, level);
+		return m_nodes[node].block;
+	}
+
+	void SparseVoxelOctree::Set(const Maths::IVec3& voxel, BlockId block) noexcept
+	{
+		if (!Contains(voxel) || Get(voxel) == block)
+			return;
+
+		uint32_t		path[MAX_DEPTH + 1];
+		const unsigned	count{ Descend(voxel - m_origin, 0, path) };
+		m_nodes[path[count - 1]].block = block;
+
+		for (unsigned i{ count - 1 }; i-- > 0;)
+		{
+			if (!TryCollapse(path[i]))
+				break;
+		}
+	}
+
+	void SparseVoxelOctree::Fill(const Maths::IVec3& voxel, unsigned level, BlockId block) noexcept
+	{
+		if (!Contains(voxel))
+			return;
+
+		level = std::min(level, m_depth);
+		uint32_t		path[MAX_DEPTH + 1];
+		const unsigned	count{ Descend(voxel - m_origin, level, path) };
+		FreeSubtree(path[count - 1]);
+		m_nodes[path[count - 1]].block = block;
+
+		for (unsigned i{ count - 1 }; i-- > 0;)
+		{
+			if (!TryCollapse(path[i]))
+				break;
+		}
+	}
+
+	void SparseVoxelOctree::InsertChunk(const Maths::ChunkPos& pos, const Chunk& chunk) noexcept
+	{
+		if (chunk.IsUniform())
+		{
+			// Same guard as the span overload, Fill would clamp the level to the whole octree
+			if (VoxelTraversal::IsChunkCube(pos.Origin() - m_origin, m_depth))
+				Fill(pos.Origin(), Maths::ChunkPos::Shift, chunk.Get(0u));
+			return;
+		}
+
+		std::vector<BlockId>	voxels(Chunk::VOLUME);
+		chunk.Read(voxels);
+		InsertChunk(pos, voxels);
+	}
+
+	void SparseVoxelOctree::InsertChunk(const Maths::ChunkPos& pos, std::span<const BlockId> voxels) noexcept
+	{
+		const Maths::IVec3	local{ pos.Origin() - m_origin };
+		if (!VoxelTraversal::IsChunkCube(local, m_depth))
+			return;
+
+		ZoneScoped
+		uint32_t		path[MAX_DEPTH + 1];
+		const unsigned	count{ Descend(local, Maths::ChunkPos::Shift, path) };
+
+		// Freed first so the build reuses the groups of the old subtree
+		FreeSubtree(path[count - 1]);
+		const Node		built{ BuildDense(voxels.data(), Maths::ChunkPos::Size, Maths::IVec3(), Maths::ChunkPos::Size) };
+		m_nodes[path[count - 1]] = built;
+
+		for (unsigned i{ count - 1 }; i-- > 0;)
+		{
+			if (!TryCollapse(path[i]))
+				break;
+		}
+	}
+
+	void SparseVoxelOctree::QueryBox(const Maths::IVec3& min, const Maths::IVec3& max, std::vector<Cell>& cells) const noexcept
+	{
+		struct Entry
+		{
+			uint32_t		node;
+			Maths::IVec3	min;
+			unsigned		level;
+		};
+
+		const Maths::IVec3	boxMin{ min - m_origin };
+		const Maths::IVec3	boxMax{ max - m_origin };
+		const int			size{ GetSize() };
+		if (boxMax.x < 0 || boxMax.y < 0 || boxMax.z < 0 || boxMin.x >= size || boxMin.y >= size || boxMin.z >= size)
+			return;
+
+		Entry		stack[7 * MAX_DEPTH + 1];
+		unsigned	top{ 0 };
+		stack[top++] = Entry{ 0, Maths::IVec3(), m_depth };
+
+		while (top > 0)
+		{
+			const Entry	entry{ stack[--top] };
+			const Node&	node{ m_nodes[entry.node] };
+			if (node.children == NO_CHILDREN)
+			{
+				if (node.block != EMPTY)
+					cells.push_back(Cell{ entry.min + m_origin, 1 << entry.level, node.block });
+				continue;
+			}
+
+			const int	half{ 1 << (entry.level - 1) };
+			for (unsigned child{ 0 }; child < 8; ++child)
+			{
+				const Maths::IVec3	childMin{ entry.min + ChildOffset(child, half) };
+				if (childMin.x > boxMax.x || childMin.y > boxMax.y || childMin.z > boxMax.z
+					|| childMin.x + half <= boxMin.x || childMin.y + half <= boxMin.y || childMin.z + half <= boxMin.z)
+					continue;
+				stack[top++] = Entry{ node.children + child, childMin, entry.level - 1 };
+			}
+		}
+	}
+
+	bool SparseVoxelOctree::Raycast(const Maths::Ray& ray, RayHit& hit, float maxDistance) const noexcept
+	{
+		return VoxelTraversal::Raycast<MAX_DEPTH>(ray, m_origin, m_depth, 0, maxDistance, hit,
+			[this](uint32_t node, BlockId& block)
+			{
+				block = m_nodes[node].block;
+				return m_nodes[node].children == NO_CHILDREN;
+			},
+			[this](uint32_t node, unsigned child) { return m_nodes[node].children + child; });
+	}
+
+	void SparseVoxelOctree::Clear() noexcept
+	{
+		m_nodes.assign(1, Node{ NO_CHILDREN, EMPTY });
+		m_nodes.shrink_to_fit();
+		m_freeGroups.clear();
+		m_freeGroups.shrink_to_fit();
+	}
+
+	size_t SparseVoxelOctree::GetMemoryUsage() const noexcept
+	{
+		return sizeof(*this) + m_nodes.capacity() * sizeof(Node) + m_freeGroups.capacity() * sizeof(uint32_t);
+	}
+}
@@ -0,0 +1,161 @@
+#include "TransformHierarchy.h"
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+
+namespace Core::Datastructure
+{
+	unsigned TransformHierarchy::Add(unsigned parent, const Maths::Vec3& position,
+									 const Maths::Quaternion& rotation, const Maths::Vec3& scale) noexcept
+	{
+		const unsigned	node{ static_cast<unsigned>(m_parents.size()) };
+		// Parents come before their children, the update relies on it
+		assert(parent == NO_PARENT || parent < node);
+
+		m_parents.push_back(parent);
+		m_depths.push_back(parent == NO_PARENT ? 0 : m_depths[parent] + 1);
+		m_positions.push_back(position);
+		m_rotations.push_back(rotation);
+		m_scales.push_back(scale);
+		m_worldMatrices.emplace_back();
+		m_dirty.push_back(0);
+
+		MarkDirty(node);
+		return node;
+	}
+
+	void TransformHierarchy::Reserve(size_t count) noexcept
+	{
+		m_parents.reserve(count);
+		m_depths.reserve(count);
+		m_positions.reserve(count);
+		m_rotations.reserve(count);
+		m_scales.reserve(count);
+		m_worldMatrices.reserve(count);
+		m_dirty.reserve(count);
+	}
+
+	void TransformHierarchy::Clear() noexcept
+	{
+		m_parents.clear();
+		m_depths.clear();
+		m_positions.clear();
+		m_rotations.clear();
+		m_scales.clear();
+		m_worldMatrices.clear();
+		m_dirty.clear();
+		m_firstDirty = NO_PARENT;
+	}
+
+	void TransformHierarchy::MarkDirty(unsigned node) noexcept
+	{
+		m_dirty[node] = 1;
+		if (m_firstDirty == NO_PARENT || node < m_firstDirty)
+			m_firstDirty = node;
+	}
+
+	void TransformHierarchy::SetLocalPosition(unsigned node, const Maths::Vec3& position) noexcept
+	{
+		m_positions[node] = position;
+		MarkDirty(node);
+	}
+
+	void TransformHierarchy::SetLocalRotation(unsigned node, const Maths::Quaternion& rotation) noexcept
+	{
+		m_rotations[node] = rotation;
+		MarkDirty(node);
+	}
+
+	void TransformHierarchy::SetLocalScale(unsigned node, const Maths::Vec3& scale) noexcept
+	{
+		m_scales[node] = scale;
+		MarkDirty(node);
+	}
+
+	void TransformHierarchy::SetLocal(unsigned node, const Maths::Vec3& position,
+									  const Maths::Quaternion& rotation, const Maths::Vec3& scale) noexcept
+	{
+		m_positions[node] = position;
+		m_rotations[node] = rotation;
+		m_scales[node] = scale;
+		MarkDirty(node);
+	}
+
+	Maths::Mat4 TransformHierarchy::GetLocalMatrix(unsigned node) const noexcept
+	{
+		Maths::Mat4			m{ m_rotations[node].GetMatUnit() };
+		const Maths::Vec3&	scale{ m_scales[node] };
+		const Maths::Vec3&	position{ m_positions[node] };
+
+		for (unsigned line{ 0 }; line < 3; ++line)
+		{
+			m.Set(line, 0, m.Get(line, 0) * scale.x);
+			m.Set(line, 1, m.Get(line, 1) * scale.y);
+			m.Set(line, 2, m.Get(line, 2) * scale.z);
+		}
+		m.Set(0, 3, position.x);
+		m.Set(1, 3, position.y);
+		m.Set(2, 3, position.z);
+		return m;
+	}
+
+	void TransformHierarchy::ComputeWorldMatrix(unsigned node) noexcept
+	{
+		const unsigned	parent{ m_parents[node] };
+		if (parent == NO_PARENT)
+			m_worldMatrices[node] = GetLocalMatrix(node);
+		else
+			m_worldMatrices[node] = m_worldMatrices[parent] * GetLocalMatrix(node);
+	}
+
+	void TransformHierarchy::Update(bool parallel) noexcept
+	{
+		if (!IsDirty())
+			return;
+
+		ZoneScoped
+		const unsigned	count{ static_cast<unsigned>(m_parents.size()) };
+
+		// Parents are before their children, so one pass flags every descendant
+		for (unsigned node{ m_firstDirty }; node < count; ++node)
+		{
+			const unsigned	parent{ m_parents[node] };
+			if (parent != NO_PARENT && m_dirty[parent])
+				m_dirty[node] = 1;
+		}
+
+		if (!parallel)
+		{
+			for (unsigned node{ m_firstDirty }; node < count; ++node)
+			{
+				if (m_dirty[node])
+				{
+					ComputeWorldMatrix(node);
+					m_dirty[node] = 0;
+				}
+			}
+		}
+		else
+		{
+			// The nodes of a same depth only read the matrices of the depth above
+			for (std::vector<unsigned>& level : m_levels)
+				level.clear();
+			for (unsigned node{ m_firstDirty }; node < count; ++node)
+			{
+				if (!m_dirty[node])
+					continue;
+				if (m_depths[node] >= m_levels.size())
+					m_levels.resize(m_depths[node] + 1);
+				m_levels[m_depths[node]].push_back(node);
+				m_dirty[node] = 0;
+			}
+
+			for (const std::vector<unsigned>& level : m_levels)
+				std::for_each(std::execution::par, level.begin(), level.end(),
+							  [this](unsigned node) { ComputeWorldMatrix(node); });
+		}
+
+		m_firstDirty = NO_PARENT;
+	}
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+/**
+ * Minimal test and benchmark runner. Tests run on every launch, benchmarks only
+ * with --bench. A name filter can be given as the last argument:
+ *
+ *		VoxelEngineTests.exe --bench Chunk
+ */
+namespace Tests
+{
+	using TestFunction = void(*)();
+
+	struct TestCase
+	{
+		const char*		name;
+		TestFunction	function;
+		bool			benchmark;
+	};
+
+	/**
+	 * Tests registered by TEST and BENCHMARK, in the order of the static initialization
+	 */
+	std::vector<TestCase>&	GetTests() noexcept;
+
+	struct Registrar
+	{
+		Registrar(const char* name, TestFunction function, bool benchmark) noexcept
+		{
+			GetTests().push_back({ name, function, benchmark });
+		}
+	};
+
+	/**
+	 * Reports a failed CHECK, the test keeps running
+	 */
+	void	ReportFailure(const char* file, int line, const char* expression) noexcept;
+
+	/**
+	 * Number of failed CHECK since the start
+	 */
+	unsigned	GetFailureCount() noexcept;
+
+	// Written by DoNotOptimize, private variable you're not supposed to use
+	inline volatile unsigned char	g_sink_IMPL;
+
+	/**
+	 * Keeps a value alive so that the optimizer can't remove the code computing it
+	 */
+	template <typename T>
+	inline void	DoNotOptimize(const T& value) noexcept
+	{
+		unsigned char	bytes[sizeof(T)];
+		std::memcpy(bytes, &value, sizeof(T));
+		for (unsigned char byte : bytes)
+			g_sink_IMPL = byte;
+	}
+
+	/**
+	 * Times a function, calling it until at least 100 ms elapsed
+	 * @param function: Function to time
+	 * @return Average nanoseconds per call
+	 */
+	template <typename Function>
+	inline double	MeasureNs(Function&& function) noexcept
+	{
+		using Clock = std::chrono::steady_clock;
+
+		function();
+		size_t				calls{ 0 };
+		const Clock::time_point	start{ Clock::now() };
+		Clock::time_point	end;
+		do
+		{
+			function();
+			++calls;
+			end = Clock::now();
+		} while (end - start < std::chrono::milliseconds(100));
+
+		return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(calls);
+	}
+
+	/**
+	 * Prints the result of a benchmark
+	 * @param label: What was measured
+	 * @param nanoseconds: Time of one call, from MeasureNs
+	 * @param items: Number of items processed by one call, to print the throughput
+	 */
+	inline void		Report(const char* label, double nanoseconds, double items = 1.0) noexcept
+	{
+		std::printf("    %-48s %12.2f ns %10.2f M/s\n", label, nanoseconds, items * 1e3 / nanoseconds);
+	}
+}
+
+#define TEST_REGISTER_IMPL(name, benchmark)									\
+	static void name();														\
+	static const Tests::Registrar	name##_registrar{ #name, &name, benchmark };	\
+	static void name()
+
+/**
+ * Declares a test, run on every launch
+ */
+#define TEST(name) TEST_REGISTER_IMPL(name, false)
+
+/**
+ * Declares a benchmark, run with --bench
+ */
+#define BENCHMARK(name) TEST_REGISTER_IMPL(name, true)
+
+#define CHECK(expression) ((expression) ? (void)0 : Tests::ReportFailure(__FILE__, __LINE__, #expression))
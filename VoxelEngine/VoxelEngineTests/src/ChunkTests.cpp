@@ -0,0 +1,351 @@
+#include "TestFramework.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Chunk.h"
+
+namespace
+{
+	using Core::Datastructure::BlockId;
+	using Core::Datastructure::Chunk;
+	using Core::Datastructure::EChunkStorage;
+
+	/**
+	 * Voxels drawn at random among the given number of blocks
+	 */
+	std::vector<BlockId>	RandomVoxels(const unsigned blocks, std::mt19937& random)
+	{
+		std::uniform_int_distribution<unsigned>	distribution(0, blocks - 1);
+		std::vector<BlockId>					voxels(Chunk::VOLUME);
+		for (BlockId& voxel : voxels)
+			voxel = static_cast<BlockId>(distribution(random) * 7 + 3);
+		return voxels;
+	}
+
+	/**
+	 * Checks every voxel of the chunk, through Get and Read
+	 */
+	bool	Matches(const Chunk& chunk, const std::vector<BlockId>& voxels)
+	{
+		std::vector<BlockId>	read(Chunk::VOLUME);
+		chunk.Read(read);
+		for (unsigned i{ 0 }; i < Chunk::VOLUME; ++i)
+		{
+			if (chunk.Get(i) != voxels[i] || read[i] != voxels[i])
+				return false;
+		}
+		return true;
+	}
+
+	unsigned	BitsFor(const size_t paletteSize)
+	{
+		return paletteSize <= 1 ? 0 : static_cast<unsigned>(std::bit_width(paletteSize - 1));
+	}
+
+	/**
+	 * Bedrock, stone, dirt and grass under air, from a random height map.
+	 * The stone changes with the column, 13 kinds, so that the palette needs
+	 * 5 bits per voxel as in real terrain
+	 */
+	std::vector<BlockId>	TerrainVoxels(std::mt19937& random)
+	{
+		std::uniform_int_distribution<int>	height(8, 24);
+		std::vector<BlockId>				voxels(Chunk::VOLUME);
+		for (int z{ 0 }; z < Maths::ChunkPos::Size; ++z)
+			for (int x{ 0 }; x < Maths::ChunkPos::Size; ++x)
+			{
+				const int		h{ height(random) };
+				const BlockId	stone{ static_cast<BlockId>(10 + (x / 4 + z / 4 * 8) % 13) };
+				for (int y{ 0 }; y < Maths::ChunkPos::Size; ++y)
+					voxels[Maths::ChunkPos::LocalIndex(Maths::IVec3(x, y, z))] = y > h ? 0 : y == h ? 3 : y > h - 3 ? 2 : y == 0 ? 4 : stone;
+			}
+		return voxels;
+	}
+
+	/**
+	 * Vertical runs of a chunk, as listed by ForEachRun
+	 */
+	struct Run
+	{
+		int		x, z, begin, end;
+		BlockId	block;
+
+		bool	operator== (const Run& r) const = default;
+	};
+
+	std::vector<Run>	Runs(const Chunk& chunk)
+	{
+		std::vector<Run>	runs;
+		chunk.ForEachRun([&](int x, int z, int begin, int end, BlockId block) { runs.push_back({ x, z, begin, end, block }); });
+		return runs;
+	}
+
+	/**
+	 * Checks that the runs cover every voxel with its block, each run being as long as possible
+	 */
+	bool	RunsMatch(const std::vector<Run>& runs, const std::vector<BlockId>& voxels)
+	{
+		std::vector<unsigned>	covered(Chunk::VOLUME, 0);
+		for (size_t r{ 0 }; r < runs.size(); ++r)
+		{
+			const Run&	run{ runs[r] };
+			if (run.begin >= run.end || (r > 0 && runs[r - 1].x == run.x && runs[r - 1].z == run.z && runs[r - 1].block == run.block))
+				return false;
+			for (int y{ run.begin }; y < run.end; ++y)
+			{
+				const unsigned	i{ Maths::ChunkPos::LocalIndex(Maths::IVec3(run.x, y, run.z)) };
+				if (voxels[i] != run.block)
+					return false;
+				++covered[i];
+			}
+		}
+		return std::all_of(covered.begin(), covered.end(), [](unsigned c) { return c == 1; });
+	}
+}
+
+TEST(Chunk_PaletteRoundTrips)
+{
+	std::mt19937	random(21);
+
+	// Every width of the indices, the widths that don't divide 64 straddling words
+	for (const unsigned blocks : { 1u, 2u, 3u, 5u, 16u, 17u, 100u, 1000u, 4097u, 20000u })
+	{
+		const std::vector<BlockId>	voxels{ RandomVoxels(blocks, random) };
+		Chunk						chunk;
+		chunk.Fill(voxels);
+
+		std::vector<BlockId>	distinct{ voxels };
+		std::sort(distinct.begin(), distinct.end());
+		distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+
+		CHECK(chunk.GetPalette() == distinct);
+		CHECK(chunk.GetPaletteSize() == distinct.size() && chunk.GetBitsPerVoxel() == BitsFor(distinct.size()));
+		CHECK(chunk.IsUniform() == (distinct.size() == 1));
+		CHECK(chunk.GetStorage() == EChunkStorage::PALETTE);
+		CHECK(Matches(chunk, voxels));
+	}
+
+	// A chunk with every voxel different
+	std::vector<BlockId>	voxels(Chunk::VOLUME);
+	for (unsigned i{ 0 }; i < Chunk::VOLUME; ++i)
+		voxels[i] = static_cast<BlockId>(UINT16_MAX - i);
+	Chunk	chunk;
+	chunk.Fill(voxels);
+	CHECK(chunk.GetBitsPerVoxel() == 15 && Matches(chunk, voxels));
+
+	chunk.Fill(BlockId{ 9 });
+	CHECK(chunk.IsUniform() && chunk.Get(Maths::IVec3(31, 31, 31)) == 9);
+}
+
+TEST(Chunk_SetGrowsAndCompactNarrows)
+{
+	std::mt19937							random(22);
+	std::uniform_int_distribution<unsigned>	index(0, Chunk::VOLUME - 1);
+
+	Chunk					chunk(BlockId{ 1 });
+	std::vector<BlockId>	voxels(Chunk::VOLUME, 1);
+	CHECK(chunk.IsUniform() && chunk.GetBitsPerVoxel() == 0 && Matches(chunk, voxels));
+
+	// The indices widen one bit at a time as the palette grows
+	for (BlockId block{ 2 }; block <= 300; ++block)
+	{
+		for (unsigned n{ 0 }; n < 20; ++n)
+		{
+			const unsigned	i{ index(random) };
+			chunk.Set(i, block);
+			voxels[i] = block;
+		}
+		CHECK(chunk.GetBitsPerVoxel() == BitsFor(chunk.GetPalette().size()));
+	}
+	CHECK(chunk.GetBitsPerVoxel() == 9 && Matches(chunk, voxels));
+
+	// Removing a block and adding it back reuses its entry, without repacking
+	const size_t	paletteSize{ chunk.GetPalette().size() }, used{ chunk.GetPaletteSize() };
+	for (unsigned i{ 0 }; i < Chunk::VOLUME; ++i)
+	{
+		if (voxels[i] == 7)
+		{
+			chunk.Set(i, 1);
+			voxels[i] = 1;
+		}
+	}
+	CHECK(chunk.GetPaletteSize() == used - 1 && chunk.GetPalette().size() == paletteSize);
+	chunk.Set(Maths::IVec3(4, 5, 6), 1000);
+	voxels[Maths::ChunkPos::LocalIndex(Maths::IVec3(4, 5, 6))] = 1000;
+	CHECK(chunk.GetPalette().size() == paletteSize && chunk.GetBitsPerVoxel() == 9 && Matches(chunk, voxels));
+
+	// Back to a few blocks, Compact drops the unused entries and narrows the indices
+	for (unsigned i{ 0 }; i < Chunk::VOLUME; ++i)
+	{
+		const BlockId	block{ static_cast<BlockId>(i % 3 == 0 ? 1 : 2 + (i & 1)) };
+		chunk.Set(i, block);
+		voxels[i] = block;
+	}
+	CHECK(chunk.GetBitsPerVoxel() == 9 && chunk.GetPaletteSize() == 3);
+	chunk.Compact();
+	CHECK(chunk.GetPalette().size() == 3 && chunk.GetBitsPerVoxel() == 2 && Matches(chunk, voxels));
+
+	// A single block left makes the chunk uniform
+	for (unsigned i{ 0 }; i < Chunk::VOLUME; ++i)
+		chunk.Set(i, 5);
+	chunk.Compact();
+	CHECK(chunk.IsUniform() && chunk.GetPalette().size() == 1 && chunk.Get(0) == 5);
+	CHECK(chunk.GetMemoryUsage() < 256);
+}
+
+BENCHMARK(Chunk_Palette)
+{
+	std::mt19937							random(23);
+	std::uniform_int_distribution<unsigned>	index(0, Chunk::VOLUME - 1);
+	std::vector<unsigned>					indices(4096);
+	for (unsigned& i : indices)
+		i = index(random);
+
+	std::vector<BlockId>	read(Chunk::VOLUME);
+	for (const unsigned blocks : { 2u, 16u, 1000u })
+	{
+		const std::vector<BlockId>	voxels{ RandomVoxels(blocks, random) };
+		Chunk						chunk;
+		chunk.Fill(voxels);
+
+		char	label[64];
+		std::snprintf(label, sizeof(label), "%u blocks, %u bits: memory", blocks, chunk.GetBitsPerVoxel());
+		std::printf("    %-48s %12zu bytes, %zu for a plain array\n", label, chunk.GetMemoryUsage(), Chunk::VOLUME * sizeof(BlockId));
+
+		std::snprintf(label, sizeof(label), "%u blocks: Fill", blocks);
+		Tests::Report(label, Tests::MeasureNs([&]
+		{
+			chunk.Fill(voxels);
+		}), Chunk::VOLUME);
+		std::snprintf(label, sizeof(label), "%u blocks: Read", blocks);
+		Tests::Report(label, Tests::MeasureNs([&]
+		{
+			chunk.Read(read);
+			Tests::DoNotOptimize(read[Chunk::VOLUME / 2]);
+		}), Chunk::VOLUME);
+		std::snprintf(label, sizeof(label), "%u blocks: random Get", blocks);
+		Tests::Report(label, Tests::MeasureNs([&]
+		{
+			unsigned	sum{ 0 };
+			for (const unsigned i : indices)
+				sum += chunk.Get(i);
+			Tests::DoNotOptimize(sum);
+		}), static_cast<double>(indices.size()));
+		std::snprintf(label, sizeof(label), "%u blocks: random Set", blocks);
+		Tests::Report(label, Tests::MeasureNs([&]
+		{
+			for (const unsigned i : indices)
+				chunk.Set(i, voxels[i ^ 1]);
+			Tests::DoNotOptimize(chunk.Get(0));
+		}), static_cast<double>(indices.size()));
+	}
+}
+
+TEST(Chunk_RunLengthRoundTrips)
+{
+	std::mt19937				random(24);
+	const std::vector<BlockId>	voxels{ TerrainVoxels(random) };
+
+	// Terrain columns are picked as runs, five per column at most
+	Chunk	chunk;
+	chunk.Fill(voxels);
+	CHECK(chunk.GetStorage() == EChunkStorage::RLE && chunk.GetRunCount() <= 5 * Chunk::COLUMNS);
+	CHECK(chunk.GetPaletteSize() == 17 && Matches(chunk, voxels));
+	const std::vector<Run>	runs{ Runs(chunk) };
+	CHECK(runs.size() == chunk.GetRunCount() && RunsMatch(runs, voxels));
+	const size_t	rleMemory{ chunk.GetMemoryUsage() };
+
+	// An edit goes back to the palette storage, with the same voxels and runs
+	const unsigned	edited{ Maths::ChunkPos::LocalIndex(Maths::IVec3(3, 31, 7)) };
+	chunk.Set(edited, voxels[edited]);
+	CHECK(chunk.GetStorage() == EChunkStorage::RLE);
+	chunk.Set(edited, 5);
+	std::vector<BlockId>	editedVoxels{ voxels };
+	editedVoxels[edited] = 5;
+	CHECK(chunk.GetStorage() == EChunkStorage::PALETTE && chunk.GetBitsPerVoxel() == 5 && chunk.GetRunCount() == 0);
+	CHECK(Matches(chunk, editedVoxels) && RunsMatch(Runs(chunk), editedVoxels));
+	CHECK(chunk.GetMemoryUsage() > rleMemory);
+
+	// Compact picks the runs again
+	chunk.Set(edited, voxels[edited]);
+	chunk.Compact();
+	CHECK(chunk.GetStorage() == EChunkStorage::RLE && chunk.GetPaletteSize() == 17);
+	CHECK(Matches(chunk, voxels) && Runs(chunk) == runs);
+
+	// Noise has too many runs to be worth it
+	chunk.Fill(RandomVoxels(17, random));
+	CHECK(chunk.GetStorage() == EChunkStorage::PALETTE);
+
+	// A run keeps its palette entry on the bits above y, which limits the palette
+	for (const unsigned blocks : { Chunk::MAX_RLE_PALETTE, Chunk::MAX_RLE_PALETTE + 1 })
+	{
+		std::vector<BlockId>	columns(Chunk::VOLUME, 0);
+		for (unsigned i{ 0 }; i < Chunk::VOLUME; ++i)
+		{
+			const Maths::IVec3	local{ Maths::ChunkPos::FromLocalIndex(i) };
+			const unsigned		column{ static_cast<unsigned>(local.x + local.z * Maths::ChunkPos::Size) };
+			if (local.y < 16)
+				columns[i] = static_cast<BlockId>(1 + (column * 2 + (local.y >= 8 ? 1 : 0)) % (blocks - 1));
+		}
+		chunk.Fill(columns);
+		CHECK(chunk.GetPaletteSize() == blocks);
+		CHECK(chunk.GetStorage() == (blocks <= Chunk::MAX_RLE_PALETTE ? EChunkStorage::RLE : EChunkStorage::PALETTE));
+		CHECK(Matches(chunk, columns) && RunsMatch(Runs(chunk), columns));
+	}
+}
+
+BENCHMARK(Chunk_RunLength)
+{
+	std::mt19937							random(25);
+	const std::vector<BlockId>				voxels{ TerrainVoxels(random) };
+	std::uniform_int_distribution<unsigned>	index(0, Chunk::VOLUME - 1);
+	std::vector<unsigned>					indices(4096);
+	for (unsigned& i : indices)
+		i = index(random);
+
+	// The same terrain in both storages, an edit forcing the palette
+	Chunk	rle, palette;
+	rle.Fill(voxels);
+	palette.Fill(voxels);
+	palette.Set(0, 5);
+	palette.Set(0, voxels[0]);
+
+	std::vector<BlockId>	read(Chunk::VOLUME);
+	for (const Chunk* chunk : { &rle, &palette })
+	{
+		const char*	storage{ chunk->GetStorage() == EChunkStorage::RLE ? "runs" : "palette" };
+		char		label[64];
+		std::snprintf(label, sizeof(label), "Terrain in %s: memory", storage);
+		std::printf("    %-48s %12zu bytes\n", label, chunk->GetMemoryUsage());
+
+		std::snprintf(label, sizeof(label), "Terrain in %s: Read", storage);
+		Tests::Report(label, Tests::MeasureNs([&]
+		{
+			chunk->Read(read);
+			Tests::DoNotOptimize(read[Chunk::VOLUME / 2]);
+		}), Chunk::VOLUME);
+		std::snprintf(label, sizeof(label), "Terrain in %s: random Get", storage);
+		Tests::Report(label, Tests::MeasureNs([&]
+		{
+			unsigned	sum{ 0 };
+			for (const unsigned i : indices)
+				sum += chunk->Get(i);
+			Tests::DoNotOptimize(sum);
+		}), static_cast<double>(indices.size()));
+		std::snprintf(label, sizeof(label), "Terrain in %s: ForEachRun", storage);
+		Tests::Report(label, Tests::MeasureNs([&]
+		{
+			int	sum{ 0 };
+			chunk->ForEachRun([&](int, int, int begin, int end, BlockId block) { sum += (end - begin) * block; });
+			Tests::DoNotOptimize(sum);
+		}), Chunk::VOLUME);
+	}
+	Tests::Report("Terrain Fill, picking the runs", Tests::MeasureNs([&]
+	{
+		rle.Fill(voxels);
+	}), Chunk::VOLUME);
+}
@@ -0,0 +1,54 @@
+#include "TestFramework.h"
+
+#include <vector>
+
+#include "Maths/Mat4.hpp"
+#include "Maths/Quaternion.hpp"
+#include "Maths/Vec3.hpp"
+
+namespace
+{
+	constexpr size_t	COUNT{ 1 << 16 };
+}
+
+TEST(Copy_MathsTypesAreTriviallyCopyable)
+{
+	static_assert(std::is_trivially_copyable_v<Maths::Vec<3>> && std::is_trivially_copyable_v<Maths::Mat<3, 3>>);
+	static_assert(Maths::BitwiseCopyable<Maths::Vec3> && Maths::BitwiseCopyable<Maths::Mat4> && Maths::BitwiseCopyable<Maths::Quaternion>);
+
+	// Assignments return the object itself, so chains keep working
+	Maths::Vec3	a, b;
+	a = b = Maths::Vec3(1.f, 2.f, 3.f);
+	CHECK(a.x == 1.f && a.y == 2.f && a.z == 3.f);
+
+	std::vector<Maths::Mat4>	matrices(16, Maths::Mat4::Identity());
+	matrices[3](0, 3) = 5.f;
+	const std::vector<Maths::Mat4>	copy{ matrices };
+	CHECK(copy[3](0, 3) == 5.f && copy[3](3, 3) == 1.f && copy[15](2, 2) == 1.f);
+}
+
+BENCHMARK(Copy_BulkCopies)
+{
+	std::vector<Maths::Mat4>	matrices(COUNT, Maths::Mat4::Identity());
+	std::vector<Maths::Mat4>	copy(COUNT);
+
+	Tests::Report("Mat4 element by element copy", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			for (unsigned j{ 0 }; j < 16; ++j)
+				copy[i](j) = matrices[i](j);
+		Tests::DoNotOptimize(copy[COUNT / 2]);
+	}), COUNT);
+	Tests::Report("std::vector<Mat4> copy assignment", Tests::MeasureNs([&]
+	{
+		copy = matrices;
+		Tests::DoNotOptimize(copy[COUNT / 2]);
+	}), COUNT);
+	Tests::Report("std::vector<Vec3> growth, push_back", Tests::MeasureNs([&]
+	{
+		std::vector<Maths::Vec3>	points;
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			points.push_back(Maths::Vec3(static_cast<float>(i), 0.f, 1.f));
+		Tests::DoNotOptimize(points[COUNT / 2]);
+	}), COUNT);
+}
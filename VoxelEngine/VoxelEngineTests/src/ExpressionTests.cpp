@@ -0,0 +1,116 @@
+#include "TestFramework.h"
+
+#include <random>
+#include <vector>
+
+#include "Maths/Expression.hpp"
+
+namespace
+{
+	constexpr size_t	PARTICLES{ 1 << 14 };
+
+	constexpr float LazyChain() noexcept
+	{
+		Maths::Vec<3>	a(1.f), b(2.f), c(0.5f);
+		Maths::Vec<3>	r = Maths::Expr::Lazy(a) * 3.f + b - c;
+		return r[2];
+	}
+
+	// The expressions are also usable in constant evaluation
+	static_assert(LazyChain() == 4.5f);
+
+	template <typename T>
+	float MaxDifference(const T& a, const T& b) noexcept
+	{
+		float	difference{ 0.f };
+		for (unsigned i{ 0 }; i < Maths::Expr::Storage<T>::Size; ++i)
+			difference = std::fmax(difference, std::fabs(Maths::Expr::Storage<T>::Data(a)[i] - Maths::Expr::Storage<T>::Data(b)[i]));
+		return difference;
+	}
+}
+
+TEST(Expression_MatchesEagerOperators)
+{
+	std::mt19937							random{ 5 };
+	std::uniform_real_distribution<float>	distribution{ -10.f, 10.f };
+	float									difference{ 0.f };
+	for (unsigned i{ 0 }; i < 1000; ++i)
+	{
+		const Maths::Vec3	a{ distribution(random), distribution(random), distribution(random) };
+		const Maths::Vec3	b{ distribution(random), distribution(random), distribution(random) };
+		const float			s{ distribution(random) };
+
+		const Maths::Vec3	eager{ a * s + b - a };
+		const Maths::Vec3	lazy = Maths::Expr::Lazy(a) * s + b - a;
+		difference = std::fmax(difference, MaxDifference(eager, lazy));
+
+		Maths::Vec<8>	u, v;
+		for (int j{ 0 }; j < 8; ++j)
+		{
+			u[j] = distribution(random);
+			v[j] = distribution(random);
+		}
+		const Maths::Vec<8>	eagerN{ (u + v) * Maths::Vec<8>(s) - v / 2.f };
+		const Maths::Vec<8>	lazyN = (Maths::Expr::Lazy(u) + v) * s - v / 2.f;
+		difference = std::fmax(difference, MaxDifference(eagerN, lazyN));
+
+		Maths::Mat<3, 3>	m, n;
+		for (unsigned j{ 0 }; j < 9; ++j)
+		{
+			m(j) = distribution(random);
+			n(j) = distribution(random);
+		}
+		const Maths::Mat<3, 3>	eagerM{ m * s + n };
+		const Maths::Mat<3, 3>	lazyM = Maths::Expr::Lazy(m) * s + n;
+		difference = std::fmax(difference, MaxDifference(eagerM, lazyM));
+	}
+	CHECK(difference == 0.f);
+
+	// The destination may be one of the operands
+	Maths::Vec3	p{ 1.f, 2.f, 3.f };
+	const Maths::Vec3	velocity{ 1.f, 1.f, 1.f };
+	Maths::Expr::Assign(p, Maths::Expr::Lazy(p) + Maths::Expr::Lazy(velocity) * 2.f);
+	CHECK(p.x == 3.f && p.y == 4.f && p.z == 5.f);
+}
+
+BENCHMARK(Expression_ParticleUpdate)
+{
+	std::vector<Maths::Vec3>	positions(PARTICLES), velocities(PARTICLES, Maths::Vec3(1.f, 2.f, 3.f));
+	const Maths::Vec3			gravity{ 0.f, -9.81f, 0.f };
+	const float					dt{ 1.f / 60.f }, drag{ 0.01f };
+
+	Tests::Report("Vec3 particle update, eager operators", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < PARTICLES; ++i)
+		{
+			velocities[i] = velocities[i] + gravity * dt - velocities[i] * drag;
+			positions[i] = positions[i] + velocities[i] * dt;
+		}
+		Tests::DoNotOptimize(positions[PARTICLES / 2]);
+	}), PARTICLES);
+	Tests::Report("Vec3 particle update, expressions", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < PARTICLES; ++i)
+		{
+			Maths::Expr::Assign(velocities[i], Maths::Expr::Lazy(velocities[i]) + Maths::Expr::Lazy(gravity) * dt - Maths::Expr::Lazy(velocities[i]) * drag);
+			Maths::Expr::Assign(positions[i], Maths::Expr::Lazy(positions[i]) + Maths::Expr::Lazy(velocities[i]) * dt);
+		}
+		Tests::DoNotOptimize(positions[PARTICLES / 2]);
+	}), PARTICLES);
+
+	// Vec<Size> has no scalar product, the eager version multiplies by a filled vector
+	std::vector<Maths::Vec<4>>	states(PARTICLES, Maths::Vec<4>(1.f)), rates(PARTICLES, Maths::Vec<4>(0.5f));
+	const Maths::Vec<4>			dtVec(dt), dragVec(drag);
+	Tests::Report("Vec<4> integration, eager operators", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < PARTICLES; ++i)
+			states[i] = states[i] + rates[i] * dtVec - states[i] * dragVec;
+		Tests::DoNotOptimize(states[PARTICLES / 2]);
+	}), PARTICLES);
+	Tests::Report("Vec<4> integration, expressions", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < PARTICLES; ++i)
+			Maths::Expr::Assign(states[i], Maths::Expr::Lazy(states[i]) + Maths::Expr::Lazy(rates[i]) * dt - Maths::Expr::Lazy(states[i]) * drag);
+		Tests::DoNotOptimize(states[PARTICLES / 2]);
+	}), PARTICLES);
+}
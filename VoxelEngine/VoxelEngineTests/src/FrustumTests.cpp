@@ -0,0 +1,223 @@
+#include "TestFramework.h"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CpuDispatch.h"
+#include "SimdKernels.h"
+#include "Maths/Frustum.hpp"
+
+namespace
+{
+	using Core::Platform::ESimdLevel;
+
+	// Levels with their own implementation in SimdKernels.cpp
+	constexpr ESimdLevel	IMPLEMENTED_LEVELS[]{ ESimdLevel::SCALAR, ESimdLevel::SSE2, ESimdLevel::AVX2 };
+
+	// Objects closer than this to a plane may be classified either way, the AVX2 path fuses the multiply adds
+	constexpr float		BORDER{ 1e-3f };
+
+	/**
+	 * OpenGL perspective projection looking down -z, rotated around y by yaw
+	 */
+	Maths::Mat4	ViewProjection(float yaw) noexcept
+	{
+		const float	f{ 1.f / std::tan(0.6f) }, nearZ{ 0.5f }, farZ{ 300.f };
+		Maths::Mat4	projection;
+		projection(0, 0) = f / 1.6f;
+		projection(1, 1) = f;
+		projection(2, 2) = (farZ + nearZ) / (nearZ - farZ);
+		projection(2, 3) = 2.f * farZ * nearZ / (nearZ - farZ);
+		projection(3, 2) = -1.f;
+
+		Maths::Mat4	view{ Maths::Mat4::Identity() };
+		view(0, 0) = std::cos(yaw);
+		view(0, 2) = -std::sin(yaw);
+		view(2, 0) = std::sin(yaw);
+		view(2, 2) = std::cos(yaw);
+		return projection * view;
+	}
+
+	/**
+	 * Planes of a frustum in the layout of the culling kernels
+	 */
+	void	PlanesArray(const Maths::Frustum& frustum, float (&planes)[6][4]) noexcept
+	{
+		for (unsigned side{ 0 }; side < Maths::Frustum::PLANE_COUNT; ++side)
+		{
+			const Maths::Vec4&	plane{ frustum.planes[side] };
+			planes[side][0] = plane.x;
+			planes[side][1] = plane.y;
+			planes[side][2] = plane.z;
+			planes[side][3] = plane.w;
+		}
+	}
+
+	struct Boxes
+	{
+		std::vector<float>	min[3], max[3];
+
+		const float*	Min(unsigned c) const noexcept { return min[c].data(); }
+		const float*	Max(unsigned c) const noexcept { return max[c].data(); }
+	};
+
+	Boxes	RandomBoxes(size_t count, std::mt19937& random)
+	{
+		std::uniform_real_distribution<float>	position(-200.f, 200.f), size(0.f, 8.f);
+		Boxes	boxes;
+		for (unsigned c{ 0 }; c < 3; ++c)
+		{
+			boxes.min[c].resize(count);
+			boxes.max[c].resize(count);
+		}
+		for (size_t i{ 0 }; i < count; ++i)
+			for (unsigned c{ 0 }; c < 3; ++c)
+			{
+				boxes.min[c][i] = position(random);
+				boxes.max[c][i] = boxes.min[c][i] + size(random);
+			}
+		return boxes;
+	}
+
+	/**
+	 * Smallest distance to a plane of the corner tested by IntersectsAabb, in double
+	 */
+	double	AabbMargin(const Maths::Frustum& frustum, const Boxes& boxes, size_t i) noexcept
+	{
+		double	margin{ 1e30 };
+		for (const Maths::Vec4& plane : frustum.planes)
+		{
+			const double	x{ plane.x >= 0.f ? boxes.max[0][i] : boxes.min[0][i] };
+			const double	y{ plane.y >= 0.f ? boxes.max[1][i] : boxes.min[1][i] };
+			const double	z{ plane.z >= 0.f ? boxes.max[2][i] : boxes.min[2][i] };
+			margin = std::fmin(margin, std::fabs(double(plane.x) * x + double(plane.y) * y + double(plane.z) * z + plane.w));
+		}
+		return margin;
+	}
+
+	/**
+	 * Checks that visible holds, in increasing order, the indices for which expected is true,
+	 * except the ones flagged as on the border that may be anywhere
+	 */
+	bool	MatchesReference(const std::vector<unsigned>& visible, size_t visibleCount, const std::vector<bool>& expected,
+							 const std::vector<bool>& border) noexcept
+	{
+		size_t	v{ 0 };
+		for (size_t i{ 0 }; i < expected.size(); ++i)
+		{
+			const bool	found{ v < visibleCount && visible[v] == i };
+			if (found)
+				++v;
+			if (found != expected[i] && !border[i])
+				return false;
+		}
+		return v == visibleCount;
+	}
+}
+
+TEST(Frustum_EveryDispatchLevelMatchesReference)
+{
+	const ESimdLevel	supported{ Core::Platform::CpuDispatch::GetSupportedLevel() };
+	std::mt19937		random(11);
+
+	// Not a multiple of 8 objects
+	constexpr size_t	COUNT{ 4099 };
+	const Boxes			boxes{ RandomBoxes(COUNT, random) };
+	std::vector<float>	radii(COUNT);
+	std::uniform_real_distribution<float>	radius(0.f, 6.f);
+	for (float& r : radii)
+		r = radius(random);
+
+	for (const float yaw : { 0.f, 0.7f, 2.5f })
+	{
+		const Maths::Frustum	frustum{ ViewProjection(yaw) };
+
+		std::vector<bool>	aabbExpected(COUNT), sphereExpected(COUNT), aabbBorder(COUNT), sphereBorder(COUNT);
+		for (size_t i{ 0 }; i < COUNT; ++i)
+		{
+			const Maths::Vec3	min(boxes.min[0][i], boxes.min[1][i], boxes.min[2][i]);
+			const Maths::Vec3	max(boxes.max[0][i], boxes.max[1][i], boxes.max[2][i]);
+			aabbExpected[i] = frustum.IntersectsAabb(min, max);
+			aabbBorder[i] = AabbMargin(frustum, boxes, i) < BORDER;
+
+			sphereExpected[i] = frustum.IntersectsSphere(min, radii[i]);
+			double	margin{ 1e30 };
+			for (unsigned side{ 0 }; side < Maths::Frustum::PLANE_COUNT; ++side)
+				margin = std::fmin(margin, std::fabs(frustum.Distance(static_cast<Maths::Frustum::ESide>(side), min) + radii[i]));
+			sphereBorder[i] = margin < BORDER;
+		}
+
+		const float* const	min[3]{ boxes.Min(0), boxes.Min(1), boxes.Min(2) };
+		const float* const	max[3]{ boxes.Max(0), boxes.Max(1), boxes.Max(2) };
+		float	planes[6][4];
+		PlanesArray(frustum, planes);
+
+		std::vector<unsigned>	visible(COUNT);
+		for (const ESimdLevel level : IMPLEMENTED_LEVELS)
+		{
+			if (level > supported)
+				break;
+
+			// Every size up to two blocks, for the tails
+			for (size_t count{ 0 }; count <= 16; ++count)
+			{
+				const std::vector<bool>	expected(aabbExpected.begin(), aabbExpected.begin() + count);
+				const std::vector<bool>	border(aabbBorder.begin(), aabbBorder.begin() + count);
+				CHECK(MatchesReference(visible, Maths::Simd::CullAabbSoA(planes, min, max, count, visible.data(), level), expected, border));
+			}
+			CHECK(MatchesReference(visible, Maths::Simd::CullAabbSoA(planes, min, max, COUNT, visible.data(), level), aabbExpected, aabbBorder));
+			CHECK(MatchesReference(visible, Maths::Simd::CullSphereSoA(planes, min, radii.data(), COUNT, visible.data(), level),
+								   sphereExpected, sphereBorder));
+		}
+
+		// The default entry points use the level of the dispatcher
+		CHECK(MatchesReference(visible, frustum.CullAabbs(min, max, COUNT, visible), aabbExpected, aabbBorder));
+		CHECK(MatchesReference(visible, frustum.CullSpheres(min, radii.data(), COUNT, visible), sphereExpected, sphereBorder));
+	}
+}
+
+BENCHMARK(Frustum_Culling)
+{
+	const ESimdLevel	supported{ Core::Platform::CpuDispatch::GetSupportedLevel() };
+	std::mt19937		random(12);
+
+	constexpr size_t	COUNT{ 1 << 14 };
+	const Boxes			boxes{ RandomBoxes(COUNT, random) };
+	const float* const	min[3]{ boxes.Min(0), boxes.Min(1), boxes.Min(2) };
+	const float* const	max[3]{ boxes.Max(0), boxes.Max(1), boxes.Max(2) };
+	std::vector<float>	radii(COUNT, 4.f);
+
+	const Maths::Frustum	frustum{ ViewProjection(0.7f) };
+	float	planes[6][4];
+	PlanesArray(frustum, planes);
+
+	std::vector<unsigned>	visible(COUNT);
+	Tests::Report("IntersectsAabb one box at a time", Tests::MeasureNs([&]
+	{
+		size_t	visibleCount{ 0 };
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			if (frustum.IntersectsAabb(Maths::Vec3(min[0][i], min[1][i], min[2][i]), Maths::Vec3(max[0][i], max[1][i], max[2][i])))
+				visible[visibleCount++] = static_cast<unsigned>(i);
+		Tests::DoNotOptimize(visibleCount);
+	}), COUNT);
+
+	for (const ESimdLevel level : IMPLEMENTED_LEVELS)
+	{
+		if (level > supported)
+			break;
+
+		const std::string	aabbs{ std::string("CullAabbSoA, ") + Core::Platform::ToString(level) };
+		Tests::Report(aabbs.c_str(), Tests::MeasureNs([&]
+		{
+			Tests::DoNotOptimize(Maths::Simd::CullAabbSoA(planes, min, max, COUNT, visible.data(), level));
+		}), COUNT);
+
+		const std::string	spheres{ std::string("CullSphereSoA, ") + Core::Platform::ToString(level) };
+		Tests::Report(spheres.c_str(), Tests::MeasureNs([&]
+		{
+			Tests::DoNotOptimize(Maths::Simd::CullSphereSoA(planes, min, radii.data(), COUNT, visible.data(), level));
+		}), COUNT);
+	}
+}
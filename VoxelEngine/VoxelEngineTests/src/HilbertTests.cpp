@@ -0,0 +1,99 @@
+#include "TestFramework.h"
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "Maths/Hilbert.hpp"
+
+namespace
+{
+	constexpr size_t	COUNT{ 1 << 16 };
+
+	int	ManhattanDistance(const Maths::IVec3& a, const Maths::IVec3& b)
+	{
+		return std::abs(a.x - b.x) + std::abs(a.y - b.y) + std::abs(a.z - b.z);
+	}
+}
+
+TEST(Hilbert_RoundTrips)
+{
+	static_assert(Maths::Hilbert::Encode2D(Maths::IVec2(0, 0), 4) == 0);
+	static_assert(Maths::Hilbert::Decode3D(Maths::Hilbert::Encode3D(Maths::IVec3(3, 1, 2), 2), 2) == Maths::IVec3(3, 1, 2));
+
+	// Small curves entirely: every cell has one index, and consecutive indices are neighbours
+	for (unsigned bits{ 1 }; bits <= 6; ++bits)
+	{
+		const uint64_t		cells{ 1ull << (bits * 2) };
+		std::vector<bool>	seen(cells, false);
+		Maths::IVec2		previous{ Maths::Hilbert::Decode2D(0, bits) };
+		for (uint64_t index{ 0 }; index < cells; ++index)
+		{
+			const Maths::IVec2	p{ Maths::Hilbert::Decode2D(index, bits) };
+			CHECK(p.x >= 0 && p.y >= 0 && p.x < (1 << bits) && p.y < (1 << bits));
+			CHECK(Maths::Hilbert::Encode2D(p, bits) == index);
+			CHECK(!seen[p.x + (p.y << bits)]);
+			seen[p.x + (p.y << bits)] = true;
+			CHECK(index == 0 || std::abs(p.x - previous.x) + std::abs(p.y - previous.y) == 1);
+			previous = p;
+		}
+	}
+	for (unsigned bits{ 1 }; bits <= 4; ++bits)
+	{
+		const uint64_t		cells{ 1ull << (bits * 3) };
+		std::vector<bool>	seen(cells, false);
+		Maths::IVec3		previous{ Maths::Hilbert::Decode3D(0, bits) };
+		for (uint64_t index{ 0 }; index < cells; ++index)
+		{
+			const Maths::IVec3	p{ Maths::Hilbert::Decode3D(index, bits) };
+			CHECK(p.x >= 0 && p.y >= 0 && p.z >= 0 && p.x < (1 << bits) && p.y < (1 << bits) && p.z < (1 << bits));
+			CHECK(Maths::Hilbert::Encode3D(p, bits) == index);
+			CHECK(!seen[p.x + (p.y << bits) + (p.z << (bits * 2))]);
+			seen[p.x + (p.y << bits) + (p.z << (bits * 2))] = true;
+			CHECK(index == 0 || ManhattanDistance(p, previous) == 1);
+			previous = p;
+		}
+	}
+
+	// Random positions of the largest curves
+	std::mt19937_64	random(16);
+	for (size_t i{ 0 }; i < COUNT; ++i)
+	{
+		const Maths::IVec2	p2(static_cast<int>(random() & 0x7fffffff), static_cast<int>(random() & 0x7fffffff));
+		CHECK(Maths::Hilbert::Decode2D(Maths::Hilbert::Encode2D(p2, 31), 31) == p2);
+
+		const Maths::IVec3	p3(static_cast<int>(random() & 0x1fffff), static_cast<int>(random() & 0x1fffff), static_cast<int>(random() & 0x1fffff));
+		const uint64_t		index{ Maths::Hilbert::Encode3D(p3, 21) };
+		CHECK(index < (1ull << 63) && Maths::Hilbert::Decode3D(index, 21) == p3);
+		CHECK(index + 1 == (1ull << 63) || ManhattanDistance(Maths::Hilbert::Decode3D(index + 1, 21), p3) == 1);
+	}
+}
+
+BENCHMARK(Hilbert_Encoding)
+{
+	std::mt19937						random(17);
+	std::uniform_int_distribution<int>	coordinate(0, 1023);
+	std::vector<Maths::IVec3>			positions(COUNT);
+	std::vector<uint64_t>				indices(COUNT);
+	for (Maths::IVec3& p : positions)
+		p = Maths::IVec3(coordinate(random), coordinate(random), coordinate(random));
+
+	Tests::Report("Morton Encode64, 10 bits per axis", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			indices[i] = Maths::Morton::Encode64(positions[i].x, positions[i].y, positions[i].z);
+		Tests::DoNotOptimize(indices[COUNT / 2]);
+	}), COUNT);
+	Tests::Report("Hilbert Encode3D, 10 bits per axis", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			indices[i] = Maths::Hilbert::Encode3D(positions[i], 10);
+		Tests::DoNotOptimize(indices[COUNT / 2]);
+	}), COUNT);
+	Tests::Report("Hilbert Decode3D, 10 bits per axis", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			positions[i] = Maths::Hilbert::Decode3D(indices[i], 10);
+		Tests::DoNotOptimize(positions[COUNT / 2]);
+	}), COUNT);
+}
@@ -0,0 +1,168 @@
+#include "TestFramework.h"
+
+#include <climits>
+#include <cmath>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Maths/ChunkPos.hpp"
+#include "Maths/IVec2.hpp"
+#include "Maths/IVec3.hpp"
+
+namespace
+{
+	constexpr size_t	COUNT{ 1 << 16 };
+}
+
+TEST(IVec_FloorDivisionOfNegatives)
+{
+	for (const int b : { 1, 2, 3, 7, 16, 32, 1000 })
+	{
+		for (int a{ -2000 }; a <= 2000; ++a)
+		{
+			const int	q{ Maths::FloorDiv(a, b) }, r{ Maths::FloorMod(a, b) };
+			CHECK(q == static_cast<int>(std::floor(static_cast<double>(a) / b)));
+			CHECK(r >= 0 && r < b && q * b + r == a);
+		}
+		CHECK(Maths::FloorDiv(INT_MIN, b) == static_cast<int>(std::floor(static_cast<double>(INT_MIN) / b)));
+		CHECK(Maths::FloorMod(INT_MIN, b) == static_cast<int>(INT_MIN - std::floor(static_cast<double>(INT_MIN) / b) * b));
+		CHECK(Maths::FloorDiv(INT_MAX, b) == INT_MAX / b && Maths::FloorMod(INT_MAX, b) == INT_MAX % b);
+	}
+
+	static_assert(Maths::FloorDiv(-1, 32) == -1 && Maths::FloorMod(-1, 32) == 31);
+	static_assert(Maths::IVec3(-33, 32, -32).FloorDiv(32) == Maths::IVec3(-2, 1, -1));
+	static_assert(Maths::IVec3(-33, 32, -32).FloorMod(32) == Maths::IVec3(31, 0, 0));
+	static_assert(Maths::IVec2(-1, 5).FloorDiv(4) == Maths::IVec2(-1, 1) && Maths::IVec2(-1, 5).FloorMod(4) == Maths::IVec2(3, 1));
+
+	// The shifts and masks used by the chunk coordinates agree with the divisions
+	for (int a{ -100 }; a <= 100; ++a)
+	{
+		const Maths::IVec3	v(a, -a, a * 7);
+		CHECK((v >> 5) == v.FloorDiv(32) && (v & 31) == v.FloorMod(32));
+	}
+}
+
+TEST(IVec_FloorOfFloats)
+{
+	for (const float f : { -0.f, 0.f, -0.5f, 0.5f, -1.f, 1.f, -1.0000001f, 0.99999994f, -0.99999994f, -16777216.f, 16777215.f, -2147483520.f })
+		CHECK(Maths::FloorToInt(f) == static_cast<int>(std::floor(f)));
+
+	std::mt19937							random(12);
+	std::uniform_real_distribution<float>	distribution(-1e6f, 1e6f);
+	for (size_t i{ 0 }; i < COUNT; ++i)
+	{
+		const float	f{ distribution(random) };
+		CHECK(Maths::FloorToInt(f) == static_cast<int>(std::floor(f)));
+	}
+
+	CHECK(Maths::IVec3::Floor(Maths::Vec3(-0.5f, 0.5f, -32.f)) == Maths::IVec3(-1, 0, -32));
+	CHECK(Maths::IVec2::Floor(Maths::Vec2(-1.5f, 2.5f)) == Maths::IVec2(-2, 2));
+}
+
+TEST(IVec_ChunkPosConversions)
+{
+	using Maths::ChunkPos;
+
+	for (int z{ -70 }; z <= 70; z += 3)
+		for (int y{ -70 }; y <= 70; y += 5)
+			for (int x{ -70 }; x <= 70; ++x)
+			{
+				const Maths::IVec3	voxel(x, y, z);
+				const ChunkPos		chunk{ ChunkPos::FromVoxel(voxel) };
+				const Maths::IVec3	local{ ChunkPos::LocalPos(voxel) };
+				CHECK(chunk.pos == voxel.FloorDiv(ChunkPos::Size) && local == voxel.FloorMod(ChunkPos::Size));
+				CHECK(chunk.ToVoxel(local) == voxel);
+			}
+
+	for (unsigned index{ 0 }; index < ChunkPos::Volume; ++index)
+		CHECK(ChunkPos::LocalIndex(ChunkPos::FromLocalIndex(index)) == index);
+	CHECK(ChunkPos::LocalIndex(Maths::IVec3(1, 2, 3)) == 1 + 2 * 32 + 3 * 32 * 32);
+
+	CHECK(ChunkPos::FromWorld(Maths::Vec3(-0.5f, 31.9f, 32.f)) == ChunkPos(-1, 0, 1));
+	CHECK(ChunkPos::FromWorld(Maths::Vec3(-32.f, -32.5f, -64.f)) == ChunkPos(-1, -2, -2));
+	CHECK(ChunkPos(-1, 2, -3).Origin() == Maths::IVec3(-32, 64, -96));
+	CHECK(Maths::ChunkCoords<4>::FromVoxel(Maths::IVec3(-17, 15, 16)) == Maths::ChunkCoords<4>(-2, 0, 1));
+}
+
+TEST(IVec_HashSpreadsNeighbours)
+{
+	// Neighbouring chunks must neither collide nor share buckets
+	constexpr size_t	BUCKETS{ 1024 };
+	std::unordered_set<size_t>	hashes;
+	std::vector<unsigned>		buckets(BUCKETS, 0);
+	for (int z{ -16 }; z < 16; ++z)
+		for (int y{ -16 }; y < 16; ++y)
+			for (int x{ -16 }; x < 16; ++x)
+			{
+				const size_t	hash{ Maths::ChunkPos(x, y, z).Hash() };
+				hashes.insert(hash);
+				++buckets[hash % BUCKETS];
+			}
+	CHECK(hashes.size() == 32 * 32 * 32);
+
+	// 32 keys per bucket on average
+	unsigned	fullest{ 0 };
+	for (const unsigned count : buckets)
+		fullest = count > fullest ? count : fullest;
+	CHECK(fullest < 64);
+
+	CHECK(std::hash<Maths::IVec3>()(Maths::IVec3(1, 2, 3)) == Maths::IVec3(1, 2, 3).Hash());
+	CHECK(Maths::IVec2(3, -4).Hash() != Maths::IVec2(-4, 3).Hash());
+}
+
+BENCHMARK(IVec_Conversions)
+{
+	std::mt19937							random(13);
+	std::uniform_real_distribution<float>	distribution(-1e5f, 1e5f);
+	std::vector<Maths::Vec3>				points(COUNT);
+	std::vector<Maths::IVec3>				voxels(COUNT);
+	for (Maths::Vec3& point : points)
+		point = Maths::Vec3(distribution(random), distribution(random), distribution(random));
+
+	Tests::Report("Voxel of a point, std::floor", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			voxels[i] = Maths::IVec3(static_cast<int>(std::floor(points[i].x)), static_cast<int>(std::floor(points[i].y)), static_cast<int>(std::floor(points[i].z)));
+		Tests::DoNotOptimize(voxels[COUNT / 2]);
+	}), COUNT);
+	Tests::Report("Voxel of a point, IVec3::Floor", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			voxels[i] = Maths::IVec3::Floor(points[i]);
+		Tests::DoNotOptimize(voxels[COUNT / 2]);
+	}), COUNT);
+
+	std::vector<Maths::IVec3>	chunks(COUNT);
+	Tests::Report("Chunk of a voxel, std::floor of the quotient", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+		{
+			const Maths::IVec3&	v{ voxels[i] };
+			chunks[i] = Maths::IVec3(static_cast<int>(std::floor(v.x / 32.f)), static_cast<int>(std::floor(v.y / 32.f)), static_cast<int>(std::floor(v.z / 32.f)));
+		}
+		Tests::DoNotOptimize(chunks[COUNT / 2]);
+	}), COUNT);
+	Tests::Report("Chunk of a voxel, ChunkPos::FromVoxel", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			chunks[i] = Maths::ChunkPos::FromVoxel(voxels[i]).pos;
+		Tests::DoNotOptimize(chunks[COUNT / 2]);
+	}), COUNT);
+
+	std::unordered_map<Maths::IVec3, unsigned>	map;
+	for (int z{ -8 }; z < 8; ++z)
+		for (int y{ -8 }; y < 8; ++y)
+			for (int x{ -8 }; x < 8; ++x)
+				map.emplace(Maths::IVec3(x, y, z), static_cast<unsigned>(map.size()));
+	Tests::Report("Chunk map lookup of a neighbourhood", Tests::MeasureNs([&]
+	{
+		unsigned	sum{ 0 };
+		for (int z{ -8 }; z < 8; ++z)
+			for (int y{ -8 }; y < 8; ++y)
+				for (int x{ -8 }; x < 8; ++x)
+					sum += map.find(Maths::IVec3(x, y, z))->second;
+		Tests::DoNotOptimize(sum);
+	}), 16 * 16 * 16);
+}
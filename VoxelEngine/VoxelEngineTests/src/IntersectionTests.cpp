@@ -0,0 +1,179 @@
+#include "TestFramework.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CpuDispatch.h"
+#include "SimdKernels.h"
+#include "Maths/Intersection.hpp"
+
+namespace
+{
+	using Core::Platform::ESimdLevel;
+
+	// Levels with their own implementation in SimdKernels.cpp
+	constexpr ESimdLevel	IMPLEMENTED_LEVELS[]{ ESimdLevel::SCALAR, ESimdLevel::SSE2, ESimdLevel::AVX2 };
+
+	// Spheres closer than this to a box may be classified either way, the AVX2 path fuses the multiply adds
+	constexpr float		BORDER{ 1e-3f };
+
+	struct Boxes
+	{
+		std::vector<float>	min[3], max[3];
+
+		Maths::Aabb	Get(size_t i) const noexcept
+		{
+			return Maths::Aabb(Maths::Vec3(min[0][i], min[1][i], min[2][i]), Maths::Vec3(max[0][i], max[1][i], max[2][i]));
+		}
+	};
+
+	Boxes	RandomBoxes(size_t count, std::mt19937& random)
+	{
+		std::uniform_real_distribution<float>	position(-50.f, 50.f), size(0.f, 8.f);
+		Boxes	boxes;
+		for (unsigned c{ 0 }; c < 3; ++c)
+		{
+			boxes.min[c].resize(count);
+			boxes.max[c].resize(count);
+		}
+		for (size_t i{ 0 }; i < count; ++i)
+			for (unsigned c{ 0 }; c < 3; ++c)
+			{
+				boxes.min[c][i] = position(random);
+				boxes.max[c][i] = boxes.min[c][i] + size(random);
+			}
+		return boxes;
+	}
+
+	/**
+	 * Checks that hits holds, in increasing order, the indices for which expected is true,
+	 * except the ones flagged as on the border that may be anywhere
+	 */
+	bool	MatchesReference(const std::vector<unsigned>& hits, size_t hitCount, const std::vector<bool>& expected,
+							 const std::vector<bool>& border) noexcept
+	{
+		size_t	h{ 0 };
+		for (size_t i{ 0 }; i < expected.size(); ++i)
+		{
+			const bool	found{ h < hitCount && hits[h] == i };
+			if (found)
+				++h;
+			if (found != expected[i] && !border[i])
+				return false;
+		}
+		return h == hitCount;
+	}
+}
+
+TEST(Intersection_EveryDispatchLevelMatchesPairwiseTests)
+{
+	const ESimdLevel	supported{ Core::Platform::CpuDispatch::GetSupportedLevel() };
+	std::mt19937		random(16);
+
+	// Not a multiple of 8 boxes
+	constexpr size_t	COUNT{ 2053 };
+	const Boxes			boxes{ RandomBoxes(COUNT, random) };
+	const float* const	min[3]{ boxes.min[0].data(), boxes.min[1].data(), boxes.min[2].data() };
+	const float* const	max[3]{ boxes.max[0].data(), boxes.max[1].data(), boxes.max[2].data() };
+
+	const Maths::Ray	ray{ Maths::Ray::FromPoints(Maths::Vec3(-60.f, -3.f, 2.f), Maths::Vec3(60.f, 4.f, -1.f)) };
+	const Maths::Vec3	inv{ ray.InverseDirection() };
+	constexpr float		MAX_DISTANCE{ 90.f };
+	const Maths::Sphere	sphere(Maths::Vec3(3.f, -2.f, 5.f), 20.f);
+	const Maths::Aabb	query(Maths::Vec3(-15.f, -10.f, -20.f), Maths::Vec3(10.f, 25.f, 5.f));
+
+	std::vector<bool>	rayExpected(COUNT), sphereExpected(COUNT), aabbExpected(COUNT), sphereBorder(COUNT), exact(COUNT);
+	std::vector<float>	rayDistances(COUNT);
+	for (size_t i{ 0 }; i < COUNT; ++i)
+	{
+		const Maths::Aabb	box{ boxes.Get(i) };
+		rayExpected[i] = Maths::Intersection::Raycast(ray, box, rayDistances[i], MAX_DISTANCE);
+		sphereExpected[i] = Maths::Intersection::Intersects(sphere, box);
+		sphereBorder[i] = std::fabs(box.SquaredDistance(sphere.center) - sphere.radius * sphere.radius) < BORDER;
+		aabbExpected[i] = Maths::Intersection::Intersects(query, box);
+	}
+
+	std::vector<unsigned>	hits(COUNT);
+	std::vector<float>		distances(COUNT);
+	for (const ESimdLevel level : IMPLEMENTED_LEVELS)
+	{
+		if (level > supported)
+			break;
+
+		// Every size up to two blocks, for the tails
+		for (size_t count{ 0 }; count <= 16; ++count)
+		{
+			const std::vector<bool>	expected(aabbExpected.begin(), aabbExpected.begin() + count);
+			const std::vector<bool>	none(count);
+			CHECK(MatchesReference(hits, Maths::Simd::AabbAabbSoA(query.min.xyz, query.max.xyz, min, max, count, hits.data(), level),
+								   expected, none));
+		}
+
+		const size_t	rayHits{ Maths::Simd::RayAabbSoA(ray.origin.xyz, inv.xyz, MAX_DISTANCE, min, max, COUNT,
+														 hits.data(), distances.data(), level) };
+		CHECK(MatchesReference(hits, rayHits, rayExpected, exact));
+		for (size_t h{ 0 }; h < rayHits; ++h)
+			CHECK(std::fabs(distances[h] - rayDistances[hits[h]]) < 1e-3f);
+
+		CHECK(MatchesReference(hits, Maths::Simd::SphereAabbSoA(sphere.center.xyz, sphere.radius, min, max, COUNT, hits.data(), level),
+							   sphereExpected, sphereBorder));
+		CHECK(MatchesReference(hits, Maths::Simd::AabbAabbSoA(query.min.xyz, query.max.xyz, min, max, COUNT, hits.data(), level),
+							   aabbExpected, exact));
+	}
+
+	// The default entry points use the level of the dispatcher
+	CHECK(MatchesReference(hits, Maths::Intersection::RaycastAabbs(ray, min, max, COUNT, hits, {}, MAX_DISTANCE), rayExpected, exact));
+	CHECK(MatchesReference(hits, Maths::Intersection::OverlapAabbs(sphere, min, max, COUNT, hits), sphereExpected, sphereBorder));
+	CHECK(MatchesReference(hits, Maths::Intersection::OverlapAabbs(query, min, max, COUNT, hits), aabbExpected, exact));
+}
+
+BENCHMARK(Intersection_SoABatches)
+{
+	const ESimdLevel	supported{ Core::Platform::CpuDispatch::GetSupportedLevel() };
+	std::mt19937		random(17);
+
+	constexpr size_t	COUNT{ 1 << 14 };
+	const Boxes			boxes{ RandomBoxes(COUNT, random) };
+	const float* const	min[3]{ boxes.min[0].data(), boxes.min[1].data(), boxes.min[2].data() };
+	const float* const	max[3]{ boxes.max[0].data(), boxes.max[1].data(), boxes.max[2].data() };
+
+	const Maths::Ray	ray{ Maths::Ray::FromPoints(Maths::Vec3(-60.f, -3.f, 2.f), Maths::Vec3(60.f, 4.f, -1.f)) };
+	const Maths::Vec3	inv{ ray.InverseDirection() };
+	const Maths::Sphere	sphere(Maths::Vec3(3.f, -2.f, 5.f), 20.f);
+	const Maths::Aabb	query(Maths::Vec3(-15.f, -10.f, -20.f), Maths::Vec3(10.f, 25.f, 5.f));
+
+	std::vector<unsigned>	hits(COUNT);
+	std::vector<float>		distances(COUNT);
+	Tests::Report("Raycast one box at a time", Tests::MeasureNs([&]
+	{
+		size_t	hitCount{ 0 };
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			if (Maths::Intersection::Raycast(ray, boxes.Get(i), distances[hitCount]))
+				hits[hitCount++] = static_cast<unsigned>(i);
+		Tests::DoNotOptimize(hitCount);
+	}), COUNT);
+
+	for (const ESimdLevel level : IMPLEMENTED_LEVELS)
+	{
+		if (level > supported)
+			break;
+
+		const std::string	suffix{ std::string(", ") + Core::Platform::ToString(level) };
+		Tests::Report(("RayAabbSoA" + suffix).c_str(), Tests::MeasureNs([&]
+		{
+			Tests::DoNotOptimize(Maths::Simd::RayAabbSoA(ray.origin.xyz, inv.xyz, std::numeric_limits<float>::infinity(), min, max,
+														 COUNT, hits.data(), distances.data(), level));
+		}), COUNT);
+		Tests::Report(("SphereAabbSoA" + suffix).c_str(), Tests::MeasureNs([&]
+		{
+			Tests::DoNotOptimize(Maths::Simd::SphereAabbSoA(sphere.center.xyz, sphere.radius, min, max, COUNT, hits.data(), level));
+		}), COUNT);
+		Tests::Report(("AabbAabbSoA" + suffix).c_str(), Tests::MeasureNs([&]
+		{
+			Tests::DoNotOptimize(Maths::Simd::AabbAabbSoA(query.min.xyz, query.max.xyz, min, max, COUNT, hits.data(), level));
+		}), COUNT);
+	}
+}
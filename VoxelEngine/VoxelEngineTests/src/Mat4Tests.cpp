@@ -0,0 +1,205 @@
+#include "TestFramework.h"
+
+#include <cmath>
+#include <random>
+
+#include "Maths/Mat4.hpp"
+#include "Maths/Ref3D.hpp"
+
+namespace
+{
+	/**
+	 * Well conditioned random matrix, the diagonal dominates
+	 */
+	Maths::Mat4 RandomMat4(std::mt19937& random) noexcept
+	{
+		std::uniform_real_distribution<float>	distribution{ -1.f, 1.f };
+		Maths::Mat4	m;
+		for (unsigned i{ 0 }; i < 16; ++i)
+			m(i) = distribution(random) + (i % 5 == 0 ? 4.f : 0.f);
+		return m;
+	}
+
+	/**
+	 * Plain triple loop, the reference the SIMD kernels are compared to
+	 */
+	Maths::Mat4 ReferenceMultiply(const Maths::Mat4& a, const Maths::Mat4& b) noexcept
+	{
+		Maths::Mat4	result;
+		for (unsigned line{ 0 }; line < 4; ++line)
+			for (unsigned column{ 0 }; column < 4; ++column)
+			{
+				float	sum{ 0.f };
+				for (unsigned k{ 0 }; k < 4; ++k)
+					sum += a(line, k) * b(k, column);
+				result(line, column) = sum;
+			}
+		return result;
+	}
+
+	float MaxDifference(const Maths::Mat4& a, const Maths::Mat4& b) noexcept
+	{
+		float	difference{ 0.f };
+		for (unsigned i{ 0 }; i < 16; ++i)
+			difference = std::fmax(difference, std::fabs(a(i) - b(i)));
+		return difference;
+	}
+
+	/**
+	 * Rotation around z, so that chained products stay bounded
+	 */
+	Maths::Mat4 RotationZ(float angle) noexcept
+	{
+		Maths::Mat4	m{ Maths::Mat4::Identity() };
+		m(0, 0) = std::cos(angle);
+		m(0, 1) = -std::sin(angle);
+		m(1, 0) = std::sin(angle);
+		m(1, 1) = std::cos(angle);
+		return m;
+	}
+
+	/**
+	 * Random rotation with a random origin, scaled on each axis if scaled is set
+	 */
+	Maths::Ref3D RandomRef(std::mt19937& random, bool scaled) noexcept
+	{
+		std::uniform_real_distribution<float>	distribution{ -1.f, 1.f };
+		std::uniform_real_distribution<float>	scale{ 0.5f, 2.f };
+
+		const Maths::Vec3	origin{ distribution(random) * 100.f, distribution(random) * 100.f, distribution(random) * 100.f };
+		Maths::Vec3			i{ Maths::Vec3(distribution(random), distribution(random), distribution(random) + 2.f).Normalized() };
+		Maths::Vec3			j{ i.Cross(Maths::Vec3(distribution(random), distribution(random) + 2.f, distribution(random))).Normalized() };
+		Maths::Vec3			k{ i.Cross(j) };
+		if (scaled)
+		{
+			i = i * scale(random);
+			j = j * scale(random);
+			k = k * scale(random);
+		}
+		return Maths::Ref3D(origin, i, j, k);
+	}
+
+	constexpr Maths::Mat4 ConstantMat4(float offset) noexcept
+	{
+		Maths::Mat4	m;
+		for (unsigned i{ 0 }; i < 16; ++i)
+			m(i) = static_cast<float>(i % 7) * 0.25f - offset + (i % 5 == 0 ? 3.f : 0.f);
+		return m;
+	}
+}
+
+TEST(Mat4_SimdMatchesReference)
+{
+	std::mt19937	random{ 1 };
+	float			multiplyError{ 0.f }, vectorError{ 0.f }, inverseError{ 0.f };
+	for (unsigned i{ 0 }; i < 10000; ++i)
+	{
+		const Maths::Mat4	a{ RandomMat4(random) }, b{ RandomMat4(random) };
+		multiplyError = std::fmax(multiplyError, MaxDifference(a * b, ReferenceMultiply(a, b)));
+
+		const Maths::Vec4	v{ a(1), b(2), a(7), b(11) };
+		const Maths::Vec4	product{ a * v };
+		for (unsigned line{ 0 }; line < 4; ++line)
+		{
+			const float	expected{ a(line, 0) * v.x + a(line, 1) * v.y + a(line, 2) * v.z + a(line, 3) * v.w };
+			vectorError = std::fmax(vectorError, std::fabs(product.xyzw[line] - expected));
+		}
+
+		inverseError = std::fmax(inverseError, MaxDifference(ReferenceMultiply(a, a.Inversed()), Maths::Mat4::Identity()));
+	}
+
+	CHECK(multiplyError < 1e-4f);
+	CHECK(vectorError < 1e-5f);
+	CHECK(inverseError < 1e-5f);
+}
+
+TEST(Mat4_ConstantEvaluationMatchesRuntime)
+{
+	// The constant evaluated products go through the scalar code, the runtime ones through the SIMD kernels
+	constexpr Maths::Mat4	a{ ConstantMat4(0.5f) }, b{ ConstantMat4(1.f) };
+	constexpr Maths::Mat4	product{ a * b };
+	constexpr Maths::Mat4	inverse{ a.Inversed() };
+
+	Maths::Mat4	runtimeA{ a }, runtimeB{ b };
+	Tests::DoNotOptimize(runtimeA);
+	CHECK(MaxDifference(product, runtimeA * runtimeB) < 1e-4f);
+	CHECK(MaxDifference(inverse, runtimeA.Inversed()) < 1e-5f);
+}
+
+TEST(Mat4_AffineInversesMatchGeneralInverse)
+{
+	std::mt19937	random{ 3 };
+	float			affineError{ 0.f }, orthonormalError{ 0.f };
+	for (unsigned i{ 0 }; i < 10000; ++i)
+	{
+		const Maths::Ref3D	rotation{ RandomRef(random, false) }, scaled{ RandomRef(random, true) };
+		CHECK(rotation.IsOrthonormal());
+		CHECK(!scaled.IsOrthonormal());
+
+		const Maths::Mat4	rotationMatrix{ rotation.LocalToWorldMatrix() }, scaledMatrix{ scaled.LocalToWorldMatrix() };
+		orthonormalError = std::fmax(orthonormalError, MaxDifference(rotationMatrix.InversedOrthonormal(), rotationMatrix.Inversed()));
+		affineError = std::fmax(affineError, MaxDifference(scaledMatrix.InversedAffine(), scaledMatrix.Inversed()));
+		affineError = std::fmax(affineError, MaxDifference(scaled.WorldToLocalMatrix(), scaledMatrix.Inversed()));
+	}
+
+	// The translations are up to 100, so the errors are relative to that
+	CHECK(orthonormalError < 1e-4f);
+	CHECK(affineError < 1e-4f);
+}
+
+BENCHMARK(Mat4_Operations)
+{
+	std::mt19937	random{ 2 };
+	Maths::Mat4		a{ RandomMat4(random) }, b{ RotationZ(0.1f) };
+	Maths::Vec4		v{ 1.f, 2.f, 3.f, 1.f };
+
+	Tests::Report("Mat4 * Mat4, reference loop", Tests::MeasureNs([&]
+	{
+		for (unsigned i{ 0 }; i < 1000; ++i)
+			a = ReferenceMultiply(a, b);
+		Tests::DoNotOptimize(a);
+	}) / 1000);
+	Tests::Report("Mat4 * Mat4", Tests::MeasureNs([&]
+	{
+		for (unsigned i{ 0 }; i < 1000; ++i)
+			a = a * b;
+		Tests::DoNotOptimize(a);
+	}) / 1000);
+	Tests::Report("Mat4 * Vec4", Tests::MeasureNs([&]
+	{
+		for (unsigned i{ 0 }; i < 1000; ++i)
+			v = b * v;
+		Tests::DoNotOptimize(v);
+	}) / 1000);
+	Tests::Report("Mat4::Inversed", Tests::MeasureNs([&]
+	{
+		for (unsigned i{ 0 }; i < 1000; ++i)
+			b = b.Inversed();
+		Tests::DoNotOptimize(b);
+	}) / 1000);
+}
+
+BENCHMARK(Mat4_AffineInverses)
+{
+	std::mt19937	random{ 4 };
+	Maths::Mat4		m{ RandomRef(random, false).LocalToWorldMatrix() };
+
+	Tests::Report("Mat4::Inversed", Tests::MeasureNs([&]
+	{
+		for (unsigned i{ 0 }; i < 1000; ++i)
+			m = m.Inversed();
+		Tests::DoNotOptimize(m);
+	}) / 1000);
+	Tests::Report("Mat4::InversedAffine", Tests::MeasureNs([&]
+	{
+		for (unsigned i{ 0 }; i < 1000; ++i)
+			m = m.InversedAffine();
+		Tests::DoNotOptimize(m);
+	}) / 1000);
+	Tests::Report("Mat4::InversedOrthonormal", Tests::MeasureNs([&]
+	{
+		for (unsigned i{ 0 }; i < 1000; ++i)
+			m = m.InversedOrthonormal();
+		Tests::DoNotOptimize(m);
+	}) / 1000);
+}
@@ -0,0 +1,200 @@
+#include "TestFramework.h"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "Maths/Mat.hpp"
+
+namespace
+{
+	/**
+	 * Well conditioned random matrix, the diagonal dominates
+	 */
+	template <unsigned N>
+	Maths::Mat<N, N>	RandomMat(std::mt19937& random) noexcept
+	{
+		std::uniform_real_distribution<float>	distribution{ -1.f, 1.f };
+		Maths::Mat<N, N>	m;
+		for (unsigned i{ 0 }; i < N; ++i)
+			for (unsigned j{ 0 }; j < N; ++j)
+				m(i, j) = distribution(random) + (i == j ? static_cast<float>(N) : 0.f);
+		return m;
+	}
+
+	template <unsigned Line, unsigned Column>
+	float	MaxDifference(const Maths::Mat<Line, Column>& a, const Maths::Mat<Line, Column>& b) noexcept
+	{
+		float	difference{ 0.f };
+		for (unsigned i{ 0 }; i < Line * Column; ++i)
+			difference = std::fmax(difference, std::fabs(a(i) - b(i)));
+		return difference;
+	}
+
+	/**
+	 * Plain triple loop, Mat's own product only handles square matrices
+	 */
+	template <unsigned N, unsigned Column>
+	Maths::Mat<N, Column>	Multiply(const Maths::Mat<N, N>& a, const Maths::Mat<N, Column>& b) noexcept
+	{
+		Maths::Mat<N, Column>	result;
+		for (unsigned line{ 0 }; line < N; ++line)
+			for (unsigned column{ 0 }; column < Column; ++column)
+			{
+				float	sum{ 0.f };
+				for (unsigned k{ 0 }; k < N; ++k)
+					sum += a(line, k) * b(k, column);
+				result(line, column) = sum;
+			}
+		return result;
+	}
+
+	template <unsigned N>
+	Maths::Mat<N, N>	SwapLines(Maths::Mat<N, N> m, unsigned a, unsigned b) noexcept
+	{
+		for (unsigned j{ 0 }; j < N; ++j)
+			std::swap(m(a, j), m(b, j));
+		return m;
+	}
+
+	/**
+	 * Laplace expansion along the first line, what Det() did from 5x5 up before the LU decomposition
+	 */
+	template <unsigned N>
+	float	CofactorDet(const Maths::Mat<N, N>& m) noexcept
+	{
+		if constexpr (N <= 4)
+			return m.Det();
+		else
+		{
+			float	det{ 0.f };
+			for (unsigned c{ 0 }; c < N; ++c)
+				det += (c % 2 == 0 ? 1.f : -1.f) * m(0, c) * CofactorDet<N - 1>(m.GetSubMatrix(0, c));
+			return det;
+		}
+	}
+
+	/**
+	 * Transposed cofactor matrix over the determinant, what Inversed() did from 4x4 up before the LU decomposition
+	 */
+	template <unsigned N>
+	Maths::Mat<N, N>	CofactorInversed(const Maths::Mat<N, N>& m) noexcept
+	{
+		const float	det{ CofactorDet(m) };
+		if (det == 0)
+			return Maths::Mat<N, N>();
+
+		Maths::Mat<N, N>	result;
+		for (unsigned i{ 0 }; i < N; ++i)
+			for (unsigned j{ 0 }; j < N; ++j)
+				result(j, i) = ((i + j) % 2 == 0 ? 1.f : -1.f) * CofactorDet<N - 1>(m.GetSubMatrix(i, j)) / det;
+		return result;
+	}
+
+	template <unsigned N>
+	void	CheckSize(std::mt19937& random)
+	{
+		std::uniform_real_distribution<float>	distribution{ -10.f, 10.f };
+		for (unsigned sample{ 0 }; sample < 64; ++sample)
+		{
+			const Maths::Mat<N, N>	a{ RandomMat<N>(random) };
+
+			Maths::Mat<N, 1>	b;
+			for (unsigned i{ 0 }; i < N; ++i)
+				b(i) = distribution(random);
+			CHECK(MaxDifference(Multiply(a, a.Solve(b)), b) < 1e-4f);
+
+			const Maths::Mat<N, N>	inversed{ a.Inversed() };
+			CHECK(MaxDifference(Multiply(a, inversed), a.Identity()) < 1e-5f);
+			CHECK(MaxDifference(inversed, CofactorInversed(a)) < 1e-5f);
+
+			const float	det{ a.Det() };
+			CHECK(std::fabs(det - CofactorDet(a)) <= std::fabs(det) * 1e-5f);
+
+			// Each swap of two lines flips the sign of the determinant
+			const Maths::Mat<N, N>	swapped{ SwapLines(a, 0, N - 1) };
+			CHECK(std::fabs(swapped.Det() + det) <= std::fabs(det) * 1e-5f);
+			CHECK(std::fabs(SwapLines(swapped, 1, N - 1).Det() - det) <= std::fabs(det) * 1e-5f);
+		}
+
+		// A permutation matrix has the sign of its permutation as determinant, and pivots recover it
+		const Maths::Mat<N, N>	identity{ Maths::Mat<N, N>().Identity() };
+		const Maths::Mat<N, N>	permutation{ SwapLines(SwapLines(identity, 0, 1), 1, N - 1) };
+		Maths::Mat<N, N>		lu;
+		unsigned				pivots[N]{};
+		CHECK(permutation.LUDecomposition(lu, pivots) == 1.f && permutation.Det() == 1.f);
+		CHECK(MaxDifference(lu, identity) == 0.f);
+		for (unsigned i{ 0 }; i < N; ++i)
+			CHECK(permutation(pivots[i], i) == 1.f);
+		const Maths::Mat<N, N>	swap{ SwapLines(identity, 0, N - 1) };
+		CHECK(swap.LUDecomposition(lu, pivots) == -1.f && swap.Det() == -1.f);
+
+		// Singular inputs: two equal lines, then a zero column
+		Maths::Mat<N, N>	singular{ RandomMat<N>(random) };
+		for (unsigned j{ 0 }; j < N; ++j)
+			singular(N - 1, j) = singular(1, j);
+		const Maths::Mat<N, N>	zero;
+		const Maths::Mat<N, 1>	zeroColumn;
+		Maths::Mat<N, 1>		b;
+		b(0) = 1.f;
+		CHECK(singular.LUDecomposition(lu, pivots) == 0.f && singular.Det() == 0.f);
+		CHECK(singular.Inversed() == zero && singular.Solve(b) == zeroColumn);
+
+		singular = RandomMat<N>(random);
+		for (unsigned i{ 0 }; i < N; ++i)
+			singular(i, N / 2) = 0.f;
+		CHECK(singular.LUDecomposition(lu, pivots) == 0.f && singular.Det() == 0.f);
+		CHECK(singular.Inversed() == zero && singular.Solve(b) == zeroColumn);
+
+		bool	thrown{ false };
+		try
+		{
+			singular.Inverse();
+		}
+		catch (const char*)
+		{
+			thrown = true;
+		}
+		CHECK(thrown);
+	}
+
+	template <unsigned N>
+	void	BenchmarkSize(std::mt19937& random)
+	{
+		const Maths::Mat<N, N>	a{ RandomMat<N>(random) };
+		Maths::Mat<N, 1>		b;
+		for (unsigned i{ 0 }; i < N; ++i)
+			b(i) = static_cast<float>(i);
+
+		const std::string	size{ std::to_string(N) + "x" + std::to_string(N) };
+		Tests::Report((size + " Det, cofactors").c_str(), Tests::MeasureNs([&] { Tests::DoNotOptimize(CofactorDet(a)); }));
+		Tests::Report((size + " Det").c_str(), Tests::MeasureNs([&] { Tests::DoNotOptimize(a.Det()); }));
+		Tests::Report((size + " Inversed, cofactors").c_str(), Tests::MeasureNs([&] { Tests::DoNotOptimize(CofactorInversed(a)); }));
+		Tests::Report((size + " Inversed").c_str(), Tests::MeasureNs([&] { Tests::DoNotOptimize(a.Inversed()); }));
+		Tests::Report((size + " Solve, cofactor inverse").c_str(), Tests::MeasureNs([&] { Tests::DoNotOptimize(Multiply(CofactorInversed(a), b)); }));
+		Tests::Report((size + " Solve").c_str(), Tests::MeasureNs([&] { Tests::DoNotOptimize(a.Solve(b)); }));
+	}
+}
+
+TEST(Mat_LUDecompositionSolvesAndInverses)
+{
+	std::mt19937	random(4);
+	CheckSize<3>(random);
+	CheckSize<4>(random);
+	CheckSize<5>(random);
+	CheckSize<6>(random);
+	CheckSize<7>(random);
+	CheckSize<8>(random);
+}
+
+BENCHMARK(Mat_LUDecomposition)
+{
+	std::mt19937	random(5);
+	BenchmarkSize<3>(random);
+	BenchmarkSize<4>(random);
+	BenchmarkSize<5>(random);
+	BenchmarkSize<6>(random);
+	BenchmarkSize<7>(random);
+	BenchmarkSize<8>(random);
+}
@@ -0,0 +1,119 @@
+#include "TestFramework.h"
+
+#include <random>
+#include <vector>
+
+#include "Maths/Morton.hpp"
+
+namespace
+{
+	constexpr size_t	COUNT{ 1 << 16 };
+
+#if MATHS_BMI2
+	constexpr bool		BMI2{ true };
+#else
+	constexpr bool		BMI2{ false };
+#endif
+
+	/**
+	 * Wraps a coordinate to the bits of an axis of a code
+	 */
+	constexpr int	Wrap(const int v, const unsigned bits)
+	{
+		return v & ((1 << bits) - 1);
+	}
+}
+
+TEST(Morton_RoundTrips)
+{
+	static_assert(Maths::Morton::Encode32(1, 0, 0) == 1 && Maths::Morton::Encode32(0, 1, 0) == 2 && Maths::Morton::Encode32(0, 0, 1) == 4);
+	static_assert(Maths::Morton::Encode32(1023, 1023, 1023) == (1u << 30) - 1);
+	static_assert(Maths::Morton::Encode64(0x1fffff, 0x1fffff, 0x1fffff) == (1ull << 63) - 1);
+	static_assert(Maths::Morton::Decode32(Maths::Morton::Encode32(5, 700, 1023)) == Maths::IVec3(5, 700, 1023));
+
+	// Every x and y of a few z planes, through the runtime path (pdep/pext with BMI2)
+	for (uint32_t z : { 0u, 1u, 511u, 512u, 1023u })
+		for (uint32_t y{ 0 }; y < 1024; ++y)
+			for (uint32_t x{ 0 }; x < 1024; ++x)
+			{
+				const uint32_t	code{ Maths::Morton::Encode32(x, y, z) };
+				CHECK(code == (Maths::Morton::Spread32_IMPL(x) | Maths::Morton::Spread32_IMPL(y) << 1 | Maths::Morton::Spread32_IMPL(z) << 2));
+				CHECK(Maths::Morton::Decode32(code) == Maths::IVec3(static_cast<int>(x), static_cast<int>(y), static_cast<int>(z)));
+			}
+
+	std::mt19937_64	random(13);
+	for (size_t i{ 0 }; i < COUNT; ++i)
+	{
+		const uint32_t		code32{ static_cast<uint32_t>(random()) & ((1u << 30) - 1) };
+		const Maths::IVec3	p32{ Maths::Morton::Decode32(code32) };
+		CHECK(Maths::Morton::Encode32(p32.x, p32.y, p32.z) == code32);
+		CHECK(p32 == Maths::IVec3(static_cast<int>(Maths::Morton::Compact32_IMPL(code32)), static_cast<int>(Maths::Morton::Compact32_IMPL(code32 >> 1)),
+								  static_cast<int>(Maths::Morton::Compact32_IMPL(code32 >> 2))));
+
+		const uint64_t		code64{ random() & ((1ull << 63) - 1) };
+		const Maths::IVec3	p64{ Maths::Morton::Decode64(code64) };
+		CHECK(Maths::Morton::Encode64(p64.x, p64.y, p64.z) == code64);
+		CHECK(p64 == Maths::IVec3(static_cast<int>(Maths::Morton::Compact64_IMPL(code64)), static_cast<int>(Maths::Morton::Compact64_IMPL(code64 >> 1)),
+								  static_cast<int>(Maths::Morton::Compact64_IMPL(code64 >> 2))));
+	}
+
+	// Only the lower bits of each coordinate are used
+	CHECK(Maths::Morton::Encode32(1024 + 3, 0, 0) == Maths::Morton::Encode32(3, 0, 0));
+	CHECK(Maths::Morton::Encode64(1u << 21, 1, 0) == Maths::Morton::Encode64(0, 1, 0));
+}
+
+TEST(Morton_NeighboursWrapAround)
+{
+	std::mt19937						random(14);
+	std::uniform_int_distribution<int>	coordinate(0, 1023), offset(-3, 3);
+	for (size_t i{ 0 }; i < COUNT; ++i)
+	{
+		const Maths::IVec3	p(coordinate(random), coordinate(random), coordinate(random));
+		const Maths::IVec3	o(offset(random), offset(random), offset(random));
+		const uint32_t		code{ Maths::Morton::Encode32(p.x, p.y, p.z) };
+
+		const Maths::IVec3	expected(Wrap(p.x + o.x, 10), Wrap(p.y + o.y, 10), Wrap(p.z + o.z, 10));
+		CHECK(Maths::Morton::Decode32(Maths::Morton::Neighbour32(code, o)) == expected);
+		CHECK(Maths::Morton::Sub(Maths::Morton::Neighbour32(code, o), code) == Maths::Morton::Encode32(o.x, o.y, o.z));
+
+		const uint64_t		code64{ Maths::Morton::Encode64(p.x << 8, p.y << 8, p.z << 8) };
+		const Maths::IVec3	expected64(Wrap((p.x << 8) + o.x, 21), Wrap((p.y << 8) + o.y, 21), Wrap((p.z << 8) + o.z, 21));
+		CHECK(Maths::Morton::Decode64(Maths::Morton::Neighbour64(code64, o)) == expected64);
+	}
+	CHECK(Maths::Morton::Decode32(Maths::Morton::Neighbour32(0, Maths::IVec3(-1, 0, 1))) == Maths::IVec3(1023, 0, 1));
+}
+
+BENCHMARK(Morton_Encoding)
+{
+	std::mt19937						random(15);
+	std::uniform_int_distribution<int>	coordinate(0, 1023);
+	std::vector<Maths::IVec3>			positions(COUNT);
+	std::vector<uint32_t>				codes(COUNT);
+	for (Maths::IVec3& p : positions)
+		p = Maths::IVec3(coordinate(random), coordinate(random), coordinate(random));
+
+	Tests::Report(BMI2 ? "Encode32, pdep" : "Encode32, masks", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			codes[i] = Maths::Morton::Encode32(positions[i].x, positions[i].y, positions[i].z);
+		Tests::DoNotOptimize(codes[COUNT / 2]);
+	}), COUNT);
+	Tests::Report("Encode32 with masks", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			codes[i] = Maths::Morton::Spread32_IMPL(positions[i].x) | Maths::Morton::Spread32_IMPL(positions[i].y) << 1 | Maths::Morton::Spread32_IMPL(positions[i].z) << 2;
+		Tests::DoNotOptimize(codes[COUNT / 2]);
+	}), COUNT);
+	Tests::Report(BMI2 ? "Decode32, pext" : "Decode32, masks", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			positions[i] = Maths::Morton::Decode32(codes[i]);
+		Tests::DoNotOptimize(positions[COUNT / 2]);
+	}), COUNT);
+	Tests::Report("Neighbour32, without decoding", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			codes[i] = Maths::Morton::Neighbour32(codes[i], Maths::IVec3(1, -1, 0));
+		Tests::DoNotOptimize(codes[COUNT / 2]);
+	}), COUNT);
+}
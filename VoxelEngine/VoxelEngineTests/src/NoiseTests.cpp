@@ -0,0 +1,111 @@
+#include "TestFramework.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CpuDispatch.h"
+#include "NoiseGrid.h"
+
+namespace
+{
+	using Core::Platform::ESimdLevel;
+
+	constexpr ESimdLevel	LEVELS[]{ ESimdLevel::SCALAR, ESimdLevel::SSE2, ESimdLevel::SSE4_1, ESimdLevel::AVX2, ESimdLevel::AVX512 };
+
+	// Levels with their own implementation in NoiseGrid.cpp
+	constexpr ESimdLevel	IMPLEMENTED_LEVELS[]{ ESimdLevel::SCALAR, ESimdLevel::AVX2 };
+
+	/**
+	 * Settings of every noise, alone and with each fractal
+	 */
+	std::vector<Maths::Noise::Settings>	AllSettings()
+	{
+		std::vector<Maths::Noise::Settings>	all;
+		for (const Maths::Noise::ENoiseType type : { Maths::Noise::ENoiseType::PERLIN, Maths::Noise::ENoiseType::SIMPLEX,
+													 Maths::Noise::ENoiseType::OPEN_SIMPLEX2, Maths::Noise::ENoiseType::CELLULAR })
+		{
+			for (const Maths::Noise::EFractalType fractal : { Maths::Noise::EFractalType::NONE, Maths::Noise::EFractalType::FBM,
+															  Maths::Noise::EFractalType::RIDGED })
+			{
+				Maths::Noise::Settings	settings;
+				settings.type = type;
+				settings.fractal = fractal;
+				settings.frequency = 0.037f;
+				all.push_back(settings);
+			}
+		}
+		return all;
+	}
+}
+
+TEST(Noise_EveryDispatchLevelMatchesScalar)
+{
+	const ESimdLevel	supported{ Core::Platform::CpuDispatch::GetSupportedLevel() };
+
+	// Not a multiple of 8 samples, and negative coordinates
+	const Maths::IVec3	size3(13, 7, 5);
+	const Maths::IVec2	size2(29, 11);
+	const Maths::Vec3	origin3(-40.5f, 3.25f, -7.f);
+	const Maths::Vec2	origin2(-100.f, 12.5f);
+	const float			step{ 0.75f };
+
+	for (const Maths::Noise::Settings& settings : AllSettings())
+	{
+		std::vector<float>	reference3(static_cast<size_t>(size3.x * size3.y * size3.z));
+		std::vector<float>	reference2(static_cast<size_t>(size2.x * size2.y));
+		Core::Procedural::FillNoise(settings, origin3, step, size3, reference3, ESimdLevel::SCALAR);
+		Core::Procedural::FillNoise(settings, origin2, step, size2, reference2, ESimdLevel::SCALAR);
+
+		// The scalar grid is the scalar noise of each sample
+		CHECK(reference3[0] == Maths::Noise::Evaluate(settings, origin3));
+		CHECK(reference3.back() == Maths::Noise::Evaluate(settings, origin3 + Maths::Vec3(12.f * step, 6.f * step, 4.f * step)));
+		CHECK(reference2[30] == Maths::Noise::Evaluate(settings, origin2 + Maths::Vec2(step, step)));
+
+		for (const ESimdLevel level : LEVELS)
+		{
+			if (level > supported)
+				break;
+
+			std::vector<float>	result3(reference3.size()), result2(reference2.size());
+			Core::Procedural::FillNoise(settings, origin3, step, size3, result3, level);
+			Core::Procedural::FillNoise(settings, origin2, step, size2, result2, level);
+
+			// Bit for bit, NaN included
+			CHECK(std::memcmp(result3.data(), reference3.data(), reference3.size() * sizeof(float)) == 0);
+			CHECK(std::memcmp(result2.data(), reference2.data(), reference2.size() * sizeof(float)) == 0);
+		}
+
+		// The default entry point uses the level of the dispatcher
+		std::vector<float>	dispatched(reference3.size());
+		Core::Procedural::FillNoise(settings, origin3, step, size3, dispatched);
+		CHECK(std::memcmp(dispatched.data(), reference3.data(), reference3.size() * sizeof(float)) == 0);
+	}
+}
+
+BENCHMARK(Noise_FillChunk)
+{
+	const ESimdLevel	supported{ Core::Platform::CpuDispatch::GetSupportedLevel() };
+	const Maths::IVec3	size(32, 32, 32);
+	std::vector<float>	result(32 * 32 * 32);
+
+	for (const Maths::Noise::Settings& settings : AllSettings())
+	{
+		if (settings.fractal != Maths::Noise::EFractalType::FBM)
+			continue;
+
+		constexpr const char*	NAMES[]{ "Perlin", "Simplex", "OpenSimplex2", "Cellular" };
+		for (const ESimdLevel level : IMPLEMENTED_LEVELS)
+		{
+			if (level > supported)
+				break;
+
+			const std::string	label{ std::string(NAMES[static_cast<int>(settings.type)]) + " fBm 32^3, " + Core::Platform::ToString(level) };
+			Tests::Report(label.c_str(), Tests::MeasureNs([&]
+			{
+				Core::Procedural::FillNoise(settings, Maths::Vec3(0.f), 1.f, size, result, level);
+				Tests::DoNotOptimize(result[result.size() / 2]);
+			}), result.size());
+		}
+	}
+}
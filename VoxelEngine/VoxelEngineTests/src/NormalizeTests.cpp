@@ -0,0 +1,172 @@
+#include "TestFramework.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Maths/Quaternion.hpp"
+#include "Maths/Vec.hpp"
+#include "Maths/Vec2.hpp"
+#include "Maths/Vec3.hpp"
+#include "Maths/Vec4.hpp"
+
+namespace
+{
+	constexpr size_t	COUNT{ 1 << 16 };
+
+	/**
+	 * Bounds of the normalizations, in ULP of each component. The exact and safe
+	 * versions divide by a rounded length, the fast ones follow Simd::RsqrtFast
+	 */
+	constexpr int64_t	EXACT_ULP{ 3 };
+	constexpr int64_t	FAST_ULP{ 6 };
+
+	/**
+	 * Distance between two floats of the same sign in units in the last place
+	 */
+	int64_t	UlpDistance(const float a, const float b)
+	{
+		const int64_t	ia{ std::bit_cast<int32_t>(a) }, ib{ std::bit_cast<int32_t>(b) };
+		return ia > ib ? ia - ib : ib - ia;
+	}
+
+	/**
+	 * Largest distance between the given components and the correctly
+	 * rounded components of the normalized input
+	 */
+	int64_t	MaxUlp(const float* input, const float* normalized, const unsigned size)
+	{
+		double	sqrLength{ 0 };
+		for (unsigned i{ 0 }; i < size; ++i)
+			sqrLength += static_cast<double>(input[i]) * input[i];
+
+		int64_t	worst{ 0 };
+		for (unsigned i{ 0 }; i < size; ++i)
+		{
+			const int64_t	distance{ UlpDistance(normalized[i], static_cast<float>(input[i] / std::sqrt(sqrLength))) };
+			worst = distance > worst ? distance : worst;
+		}
+		return worst;
+	}
+
+	/**
+	 * Components of a vector or quaternion, all laid out as a float array
+	 */
+	template <typename T>
+	float*	Components(T& value)
+	{
+		return reinterpret_cast<float*>(&value);
+	}
+
+	template <typename T>
+	const float*	Components(const T& value)
+	{
+		return reinterpret_cast<const float*>(&value);
+	}
+
+	/**
+	 * Random components spread over many magnitudes, keeping the
+	 * squared length a normal float
+	 */
+	std::vector<float>	RandomComponents(const size_t count, std::mt19937& random)
+	{
+		std::uniform_real_distribution<float>	mantissa(-1.f, 1.f);
+		std::uniform_int_distribution<int>		exponent(-15, 15);
+		std::vector<float>						components(count);
+		for (float& component : components)
+			component = mantissa(random) * std::pow(10.f, static_cast<float>(exponent(random) / 3 * 3));
+		return components;
+	}
+
+	/**
+	 * Checks the three normalizations of a vector or quaternion type
+	 * over groups of components of the same magnitude
+	 */
+	template <typename T, unsigned Size>
+	void	CheckNormalizations(std::mt19937& random, const char* name)
+	{
+		std::uniform_real_distribution<float>	mantissa(-1.f, 1.f);
+		std::uniform_int_distribution<int>		exponent(-15, 15);
+
+		int64_t	worst[3]{ 0, 0, 0 };
+		for (size_t n{ 0 }; n < COUNT; ++n)
+		{
+			const float	scale{ std::pow(10.f, static_cast<float>(exponent(random))) };
+			float		components[Size];
+			for (float& component : components)
+				component = mantissa(random) * scale;
+
+			T	value;
+			std::copy(components, components + Size, Components(value));
+			const T	normalized[3]{ value.Normalized(), value.NormalizedFast(), value.NormalizedSafe() };
+			for (unsigned tier{ 0 }; tier < 3; ++tier)
+			{
+				const int64_t	ulp{ MaxUlp(components, Components(normalized[tier]), Size) };
+				worst[tier] = ulp > worst[tier] ? ulp : worst[tier];
+			}
+		}
+
+		CHECK(worst[0] <= EXACT_ULP && worst[1] <= FAST_ULP && worst[2] <= EXACT_ULP);
+		if (worst[0] > EXACT_ULP || worst[1] > FAST_ULP || worst[2] > EXACT_ULP)
+			std::printf("    %s: %lld, %lld and %lld ULP\n", name, static_cast<long long>(worst[0]), static_cast<long long>(worst[1]), static_cast<long long>(worst[2]));
+
+		// Below NORMALIZE_EPSILON, zero and denormals included, the safe version
+		// gives the default value: a zero vector or the identity quaternion
+		T	zero, denormal;
+		for (unsigned i{ 0 }; i < Size; ++i)
+			Components(zero)[i] = Components(denormal)[i] = 0.f;
+		Components(denormal)[0] = 1e-20f;
+		for (const T& tiny : { zero, denormal })
+		{
+			T	safe{ tiny.NormalizedSafe() }, expected;
+			for (unsigned i{ 0 }; i < Size; ++i)
+				CHECK(Components(safe)[i] == Components(expected)[i]);
+		}
+	}
+}
+
+TEST(Normalize_WithinUlpBounds)
+{
+	std::mt19937	random(10);
+	CheckNormalizations<Maths::Vec2, 2>(random, "Vec2");
+	CheckNormalizations<Maths::Vec3, 3>(random, "Vec3");
+	CheckNormalizations<Maths::Vec4, 4>(random, "Vec4");
+	CheckNormalizations<Maths::Vec<5>, 5>(random, "Vec<5>");
+	CheckNormalizations<Maths::Quaternion, 4>(random, "Quaternion");
+
+	// Only the safe version is defined for these, see Simd::RsqrtFast
+	CHECK(std::isnan(Maths::Vec3(0.f, 0.f, 0.f).NormalizedFast().x));
+	CHECK(!std::isfinite(Maths::Vec3(1e-20f, 0.f, 0.f).NormalizedFast().x));
+}
+
+BENCHMARK(Normalize_Tiers)
+{
+	std::mt19937				random(11);
+	const std::vector<float>	components{ RandomComponents(COUNT * 3, random) };
+	std::vector<Maths::Vec3>	vectors(COUNT), result(COUNT);
+	for (size_t i{ 0 }; i < COUNT; ++i)
+		vectors[i] = Maths::Vec3(components[i * 3], components[i * 3 + 1], components[i * 3 + 2]);
+
+	Tests::Report("Vec3 Normalized", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			result[i] = vectors[i].Normalized();
+		Tests::DoNotOptimize(result[COUNT / 2]);
+	}), COUNT);
+	Tests::Report("Vec3 NormalizedFast", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			result[i] = vectors[i].NormalizedFast();
+		Tests::DoNotOptimize(result[COUNT / 2]);
+	}), COUNT);
+	Tests::Report("Vec3 NormalizedSafe", Tests::MeasureNs([&]
+	{
+		for (size_t i{ 0 }; i < COUNT; ++i)
+			result[i] = vectors[i].NormalizedSafe();
+		Tests::DoNotOptimize(result[COUNT / 2]);
+	}), COUNT);
+}
@@ -0,0 +1,194 @@
+#include "TestFramework.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "Maths/Quaternion.hpp"
+
+namespace
+{
+	constexpr size_t	COUNT{ 4099 };
+
+	/**
+	 * Random unit quaternions stored as separate w, x, y, z arrays
+	 */
+	struct QuaternionArrays
+	{
+		std::vector<float>	components[4];
+
+		QuaternionArrays(const size_t count, std::mt19937* random)
+		{
+			std::uniform_real_distribution<float>	distribution(-1.f, 1.f);
+			for (std::vector<float>& component : components)
+				component.resize(count);
+			for (size_t i{ 0 }; i < count && random; ++i)
+			{
+				const Maths::Quaternion	q{ Maths::Quaternion(distribution(*random), distribution(*random), distribution(*random), distribution(*random)).Normalized() };
+				for (unsigned c{ 0 }; c < 4; ++c)
+					components[c][i] = q.m_vec[c];
+			}
+		}
+
+		Maths::Quaternion	Get(const size_t i) const
+		{
+			return Maths::Quaternion(components[0][i], components[1][i], components[2][i], components[3][i]);
+		}
+
+		void	Pointers(const float* pointers[4]) const
+		{
+			for (unsigned c{ 0 }; c < 4; ++c)
+				pointers[c] = components[c].data();
+		}
+
+		void	Pointers(float* pointers[4])
+		{
+			for (unsigned c{ 0 }; c < 4; ++c)
+				pointers[c] = components[c].data();
+		}
+	};
+
+	/**
+	 * Slerp computed in double, taking the shortest path
+	 */
+	Maths::Quaternion	ReferenceSlerp(const Maths::Quaternion& a, const Maths::Quaternion& b, const float progress)
+	{
+		double	dot{ 0 };
+		for (unsigned c{ 0 }; c < 4; ++c)
+			dot += static_cast<double>(a.m_vec[c]) * b.m_vec[c];
+		const double	sign{ dot < 0 ? -1. : 1. };
+		const double	theta{ std::acos(std::fmin(dot * sign, 1.)) };
+
+		Maths::Quaternion	result;
+		for (unsigned c{ 0 }; c < 4; ++c)
+		{
+			if (theta < 1e-6)
+				result.m_vec[c] = a.m_vec[c];
+			else
+				result.m_vec[c] = static_cast<float>((std::sin((1 - progress) * theta) * a.m_vec[c] + std::sin(progress * theta) * sign * b.m_vec[c]) / std::sin(theta));
+		}
+		return result;
+	}
+
+	/**
+	 * Largest component difference, q and -q being the same rotation
+	 */
+	float	RotationDifference(const Maths::Quaternion& a, const Maths::Quaternion& b)
+	{
+		const float	sign{ a.Dot(b) < 0.f ? -1.f : 1.f };
+		float		difference{ 0.f };
+		for (unsigned c{ 0 }; c < 4; ++c)
+			difference = std::fmax(difference, std::fabs(a.m_vec[c] - sign * b.m_vec[c]));
+		return difference;
+	}
+
+	/**
+	 * Runs NlerpMany or SlerpMany over the arrays
+	 */
+	void	LerpMany(const QuaternionArrays& from, const QuaternionArrays& to, const std::vector<float>& progress, QuaternionArrays& result, const bool slerp)
+	{
+		const float*	f[4];
+		const float*	t[4];
+		float*			r[4];
+		from.Pointers(f);
+		to.Pointers(t);
+		result.Pointers(r);
+		if (slerp)
+			Maths::Quaternion::SlerpMany(f, t, progress, r);
+		else
+			Maths::Quaternion::NlerpMany(f, t, progress, r);
+	}
+}
+
+TEST(Quaternion_SlerpMatchesReference)
+{
+	std::mt19937							random(5);
+	std::uniform_real_distribution<float>	distribution(0.f, 1.f);
+	const QuaternionArrays					from(COUNT, &random), to(COUNT, &random);
+
+	for (size_t i{ 0 }; i < COUNT; ++i)
+	{
+		const Maths::Quaternion	a{ from.Get(i) }, b{ to.Get(i) };
+		const float				progress{ distribution(random) };
+		CHECK(RotationDifference(a.Slerp(b, progress), ReferenceSlerp(a, b, progress)) < 1e-5f);
+
+		// The ends are the inputs, whatever the sign of b
+		CHECK(RotationDifference(a.Slerp(b, 0.f), a) < 1e-5f && RotationDifference(a.Slerp(b, 1.f), b) < 1e-5f);
+		CHECK(RotationDifference(a.Nlerp(b, 0.f), a) < 1e-6f && RotationDifference(a.Nlerp(b, 1.f), b) < 1e-6f);
+	}
+
+	// Shortest path: interpolating towards -b gives the same rotations as towards b
+	const Maths::Quaternion	a{ from.Get(0) }, b{ to.Get(0) }, minusB{ b * -1.f };
+	CHECK(RotationDifference(a.Slerp(b, 0.3f), a.Slerp(minusB, 0.3f)) < 1e-6f);
+	CHECK(RotationDifference(a.Nlerp(b, 0.3f), a.Nlerp(minusB, 0.3f)) < 1e-6f);
+	CHECK(a.Slerp(minusB, 0.3f).Dot(a) > 0.f && a.Nlerp(minusB, 0.3f).Dot(a) > 0.f);
+
+	// Nearly identical rotations take the nlerp path and stay normalized
+	const Maths::Quaternion	close{ Maths::Quaternion(a.w + 1e-4f, a.x, a.y, a.z).Normalized() };
+	CHECK(std::fabs(a.Slerp(close, 0.5f).Length() - 1.f) < 1e-6f);
+}
+
+TEST(Quaternion_BatchesMatchScalar)
+{
+	std::mt19937							random(6);
+	std::uniform_real_distribution<float>	distribution(0.f, 1.f);
+
+	// Every size up to a few SIMD widths, to reach each remainder
+	for (size_t count{ 0 }; count < 37; ++count)
+	{
+		const QuaternionArrays	from(count, &random), to(count, &random);
+		QuaternionArrays		nlerp(count, nullptr), slerp(count, nullptr);
+		std::vector<float>		progress(count);
+		for (float& p : progress)
+			p = distribution(random);
+
+		LerpMany(from, to, progress, nlerp, false);
+		LerpMany(from, to, progress, slerp, true);
+		for (size_t i{ 0 }; i < count; ++i)
+		{
+			const Maths::Quaternion	a{ from.Get(i) }, b{ to.Get(i) };
+			CHECK(RotationDifference(nlerp.Get(i), a.Nlerp(b, progress[i])) < 1e-6f);
+			// Bound documented on SlerpMany
+			CHECK(RotationDifference(slerp.Get(i), ReferenceSlerp(a, b, progress[i])) < 4e-4f);
+		}
+	}
+
+	// The result may be one of the inputs
+	QuaternionArrays		from(COUNT, &random);
+	const QuaternionArrays	to(COUNT, &random), copy{ from };
+	std::vector<float>		progress(COUNT, 0.25f);
+	LerpMany(from, to, progress, from, false);
+	for (size_t i{ 0 }; i < COUNT; ++i)
+		CHECK(RotationDifference(from.Get(i), copy.Get(i).Nlerp(to.Get(i), 0.25f)) < 1e-6f);
+}
+
+BENCHMARK(Quaternion_Interpolation)
+{
+	std::mt19937							random(7);
+	std::uniform_real_distribution<float>	distribution(0.f, 1.f);
+	const QuaternionArrays					from(COUNT, &random), to(COUNT, &random);
+	QuaternionArrays						result(COUNT, nullptr);
+	std::vector<float>						progress(COUNT);
+	for (float& p : progress)
+		p = distribution(random);
+
+	for (const bool slerp : { false, true })
+	{
+		Tests::Report(slerp ? "Slerp, one at a time" : "Nlerp, one at a time", Tests::MeasureNs([&]
+		{
+			for (size_t i{ 0 }; i < COUNT; ++i)
+			{
+				const Maths::Quaternion	a{ from.Get(i) }, b{ to.Get(i) };
+				const Maths::Quaternion	q{ slerp ? a.Slerp(b, progress[i]) : a.Nlerp(b, progress[i]) };
+				for (unsigned c{ 0 }; c < 4; ++c)
+					result.components[c][i] = q.m_vec[c];
+			}
+			Tests::DoNotOptimize(result.components[0][COUNT / 2]);
+		}), COUNT);
+		Tests::Report(slerp ? "SlerpMany" : "NlerpMany", Tests::MeasureNs([&]
+		{
+			LerpMany(from, to, progress, result, slerp);
+			Tests::DoNotOptimize(result.components[0][COUNT / 2]);
+		}), COUNT);
+	}
+}
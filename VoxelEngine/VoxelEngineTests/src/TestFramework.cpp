@@ -0,0 +1,26 @@
+#include "TestFramework.h"
+
+namespace Tests
+{
+	namespace
+	{
+		unsigned	s_failures{ 0 };
+	}
+
+	std::vector<TestCase>& GetTests() noexcept
+	{
+		static std::vector<TestCase>	tests;
+		return tests;
+	}
+
+	void ReportFailure(const char* file, int line, const char* expression) noexcept
+	{
+		++s_failures;
+		std::printf("    %s(%d): CHECK(%s) failed\n", file, line, expression);
+	}
+
+	unsigned GetFailureCount() noexcept
+	{
+		return s_failures;
+	}
+}
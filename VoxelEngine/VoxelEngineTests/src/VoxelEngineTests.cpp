@@ -0,0 +1,36 @@
+#include <cstdio>
+#include <cstring>
+
+#include "TestFramework.h"
+
+int main(int argc, char** argv)
+{
+	bool		benchmarks{ false };
+	const char*	filter{ nullptr };
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--bench") == 0)
+			benchmarks = true;
+		else
+			filter = argv[i];
+	}
+
+	unsigned	run{ 0 };
+	for (const Tests::TestCase& test : Tests::GetTests())
+	{
+		if (test.benchmark && !benchmarks)
+			continue;
+		if (filter != nullptr && std::strstr(test.name, filter) == nullptr)
+			continue;
+
+		std::printf("%s %s\n", test.benchmark ? "[bench]" : "[test] ", test.name);
+		const unsigned	failures{ Tests::GetFailureCount() };
+		test.function();
+		if (Tests::GetFailureCount() != failures)
+			std::printf("    FAILED\n");
+		++run;
+	}
+
+	std::printf("%u run, %u failed checks\n", run, Tests::GetFailureCount());
+	return Tests::GetFailureCount() == 0 ? 0 : 1;
+}